@@ -32,7 +32,7 @@ fi
 
 # Check if required libraries are available
 echo "Checking required libraries..."
-REQUIRED_LIBS=("Adafruit GFX Library" "Adafruit ST7735 and ST7789 Library" "Adafruit NeoPixel" "Adafruit NeoMatrix")
+REQUIRED_LIBS=("Adafruit GFX Library" "Adafruit ST7735 and ST7789 Library" "Adafruit NeoPixel" "Adafruit NeoMatrix" "RTClib")
 
 for lib in "${REQUIRED_LIBS[@]}"; do
     if ! arduino-cli lib list | grep -q "$lib"; then
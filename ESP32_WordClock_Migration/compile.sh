@@ -8,6 +8,15 @@ echo "Compiling ESP32-S2 WordClock Migration..."
 # Set the board FQBN for ESP32-S2 Reverse TFT Feather
 BOARD_FQBN="esp32:esp32:adafruit_feather_esp32s2_reversetft"
 
+# Log level compiled in: 1 error, 2 warn, 3 info, 4 debug (./compile.sh with LOG_LEVEL=4)
+LOG_LEVEL="${LOG_LEVEL:-3}"
+EXTRA_FLAGS="-DLOG_LEVEL=$LOG_LEVEL"
+
+# Render jitter check (test/device/network_stall.cpp): NETWORK_STALL_TEST_MS=2000 ./compile.sh
+if [ -n "$NETWORK_STALL_TEST_MS" ]; then
+    EXTRA_FLAGS="$EXTRA_FLAGS -DNETWORK_STALL_TEST_MS=$NETWORK_STALL_TEST_MS"
+fi
+
 # Create a temporary sketch directory for Arduino CLI
 TEMP_SKETCH_DIR="temp_sketch"
 SKETCH_NAME="ESP32_WordClock_Migration"
@@ -24,6 +33,10 @@ cp main.cpp "$TEMP_SKETCH_DIR/$SKETCH_NAME/$SKETCH_NAME.ino"
 # Copy source files as .cpp files
 cp -r src "$TEMP_SKETCH_DIR/$SKETCH_NAME/"
 cp -r include "$TEMP_SKETCH_DIR/$SKETCH_NAME/"
+if [ -n "$NETWORK_STALL_TEST_MS" ]; then
+    cp test/device/network_stall.cpp "$TEMP_SKETCH_DIR/$SKETCH_NAME/src/"
+    echo "Stall test built in: ${NETWORK_STALL_TEST_MS} ms every 10 s"
+fi
 
 echo "Temporary sketch created in $TEMP_SKETCH_DIR"
 
@@ -33,7 +46,7 @@ arduino-cli compile --fqbn "$BOARD_FQBN" \
   --build-property "build.partitions=huge_app" \
   --build-property "build.psram=enabled" \
   --build-property "compiler.c.extra_flags=-DBOARD_HAS_PSRAM -mfix-esp32-psram-cache-issue -DCONFIG_SPIRAM_SUPPORT=1" \
-  --build-property "compiler.cpp.extra_flags=-DBOARD_HAS_PSRAM -mfix-esp32-psram-cache-issue -DCONFIG_SPIRAM_SUPPORT=1" \
+  --build-property "compiler.cpp.extra_flags=-DBOARD_HAS_PSRAM -mfix-esp32-psram-cache-issue -DCONFIG_SPIRAM_SUPPORT=1 $EXTRA_FLAGS" \
   --build-property "build.flash_size=4MB" \
   --build-property "build.flash_freq=80m" \
   --build-property "build.flash_mode=qio" \
@@ -50,7 +63,7 @@ if [ $? -eq 0 ]; then
       --build-property "build.partitions=huge_app" \
       --build-property "build.psram=enabled" \
       --build-property "compiler.c.extra_flags=-DBOARD_HAS_PSRAM -mfix-esp32-psram-cache-issue -DCONFIG_SPIRAM_SUPPORT=1" \
-      --build-property "compiler.cpp.extra_flags=-DBOARD_HAS_PSRAM -mfix-esp32-psram-cache-issue -DCONFIG_SPIRAM_SUPPORT=1" \
+      --build-property "compiler.cpp.extra_flags=-DBOARD_HAS_PSRAM -mfix-esp32-psram-cache-issue -DCONFIG_SPIRAM_SUPPORT=1 $EXTRA_FLAGS" \
       --build-property "build.flash_size=4MB" \
       --build-property "build.flash_freq=80m" \
       --build-property "build.flash_mode=qio" \
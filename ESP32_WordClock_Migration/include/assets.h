@@ -0,0 +1,194 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// Generated by tools/assetconvert/makeassets.sh - do not edit
+
+#include "rle_image.h"
+
+const uint8_t clockLogoData[] PROGMEM = {
+  0x98, 0x00, 0x00, 0x8A, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x92, 0xFF, 0xFF,
+  0xA7, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x85, 0x00, 0x00, 0x85, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x84, 0xFF, 0xFF,
+  0x87, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x84, 0xFF, 0xFF,
+  0x9E, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x89,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x01,
+  0x00, 0x00, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x8B, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x98, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0x96, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x8F, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x91, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x92, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x92, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x93, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x8E, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x94, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x95, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x8A, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x95, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0x89, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x96, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0x96, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0x86, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0x96, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x97, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x85, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x97, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x97, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x98, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x83, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x98, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x99, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x81, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x99, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x99, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x81, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x99, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x9A, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x9A, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x9A, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x9A, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0x95, 0x00,
+  0x00, 0x84, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x99, 0x00,
+  0x00, 0x84, 0xFF, 0xFF, 0x95, 0x00, 0x00, 0x87, 0xFF, 0xFF, 0x99, 0x00,
+  0x00, 0x84, 0xFF, 0xFF, 0x99, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x9A, 0x00,
+  0x00, 0x82, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xB8, 0x00,
+  0x00, 0x83, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xB8, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB6, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB6, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB6, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB6, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB4, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB4, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB2, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB2, 0x00,
+  0x00, 0x81, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
+  0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+  0x86, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x88, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xAE, 0x00, 0x00, 0x81, 0xFF, 0xFF,
+  0x89, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xAC, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x8A, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0xAC, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0xA6, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x81,
+  0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x82,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0x96, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x8B, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x8D, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0x9B, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x89, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+  0xFF, 0xFF, 0x9E, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0x87, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x89, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x85,
+  0xFF, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x85,
+  0xFF, 0xFF, 0xA7, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x8A,
+  0xFF, 0xFF, 0x98, 0x00, 0x00 };
+
+const RLEImage clockLogo PROGMEM = {61, 61, clockLogoData, 929};
+// 929 bytes, 7442 raw RGB565
+
+const uint8_t signalBars0Data[] PROGMEM = {
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x97, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x87, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x8B, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x8B, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x8B, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00 };
+
+const RLEImage signalBars0 PROGMEM = {30, 12, signalBars0Data, 162};
+// 162 bytes, 720 raw RGB565
+
+const uint8_t signalBars1Data[] PROGMEM = {
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x97, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x87, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00,
+  0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00,
+  0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00,
+  0x85, 0xF8, 0x00 };
+
+const RLEImage signalBars1 PROGMEM = {30, 12, signalBars1Data, 171};
+// 171 bytes, 720 raw RGB565
+
+const uint8_t signalBars2Data[] PROGMEM = {
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x97, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x87, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00,
+  0x85, 0xF8, 0x00, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00,
+  0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x81, 0x00, 0x00,
+  0x85, 0xF8, 0x00 };
+
+const RLEImage signalBars2 PROGMEM = {30, 12, signalBars2Data, 171};
+// 171 bytes, 720 raw RGB565
+
+const uint8_t signalBars3Data[] PROGMEM = {
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x97, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x97, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x8F, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x87, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x87, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00,
+  0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00,
+  0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0xF8, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00,
+  0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00,
+  0x85, 0xF8, 0x00 };
+
+const RLEImage signalBars3 PROGMEM = {30, 12, signalBars3Data, 171};
+// 171 bytes, 720 raw RGB565
+
+const uint8_t signalBars4Data[] PROGMEM = {
+  0x97, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x97, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x97, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x8F, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x8F, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x8F, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x87, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x87, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x87, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x8B, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x8B, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x8B, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0, 0x81, 0x00, 0x00, 0x85, 0x07, 0xE0,
+  0x81, 0x00, 0x00, 0x85, 0x07, 0xE0 };
+
+const RLEImage signalBars4 PROGMEM = {30, 12, signalBars4Data, 162};
+// 162 bytes, 720 raw RGB565
+
+// Indexed by getSignalBarCount()
+const RLEImage* const signalBarImages[] = {
+  &signalBars0, &signalBars1, &signalBars2, &signalBars3, &signalBars4
+};
+
+#endif // ASSETS_H
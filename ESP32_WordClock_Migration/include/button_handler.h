@@ -3,12 +3,26 @@
 
 #include <Arduino.h>
 
-// Button event types
-enum ButtonEvent {
-  NO_BUTTON,
-  BUTTON_A_PRESSED,
-  BUTTON_B_PRESSED,
-  BUTTON_C_PRESSED
+// Buttons, in the order of the ring buffer and event records
+enum ButtonId {
+  BUTTON_ID_A,
+  BUTTON_ID_B,
+  BUTTON_ID_C,
+  BUTTON_COUNT
+};
+
+// What a button did, decoded from its debounced edges
+enum ButtonGesture {
+  GESTURE_SHORT,    // Released before LONG_PRESS_MS
+  GESTURE_DOUBLE,   // Second short press soon after the first (which was reported too)
+  GESTURE_LONG,     // Held for LONG_PRESS_MS, reported while still held
+  GESTURE_REPEAT    // Still held after a long press, every REPEAT_MS
+};
+
+struct ButtonEvent {
+  uint8_t button;       // ButtonId
+  uint8_t gesture;      // ButtonGesture
+  uint64_t timeUs;      // monotonicMicros() of the edge (or timer) behind it
 };
 
 // Button pins (defined in main.cpp)
@@ -16,16 +30,27 @@ extern const int BUTTON_A;
 extern const int BUTTON_B;
 extern const int BUTTON_C;
 
-// Button state variables
-extern bool buttonA_pressed;
-extern bool buttonB_pressed;
-extern bool buttonC_pressed;
-extern unsigned long lastButtonPress;
-extern const unsigned long DEBOUNCE_DELAY;
-
 // Function declarations
 void initializeButtons();
 void initializeUnusedPins();
-ButtonEvent handleButtons();
+
+// Pin interrupts put timestamped edges into a ring buffer; this decodes
+// them (debounce, then gestures) and returns the next event, if any.
+// Call on every loop pass.
+bool nextButtonEvent(ButtonEvent& event);
+
+// Longest the loop may block before nextButtonEvent() has a debounce,
+// long press or repeat to decide; EVENT_WAIT_MAX_MS when idle
+uint32_t buttonWaitMs();
+
+// Record a raw edge: from the pin interrupts, from pollButtons(), and
+// from recorded traces in tests
+void IRAM_ATTR recordButtonEdge(uint8_t button, bool pressed, uint64_t timeUs);
+
+// Read the pins and record any change the interrupts missed (they
+// don't fire in light sleep)
+void pollButtons();
+
+uint32_t getButtonOverflows();   // Edges lost to a full ring buffer
 
 #endif // BUTTON_HANDLER_H
@@ -0,0 +1,92 @@
+#ifndef CIVIL_TIME_H
+#define CIVIL_TIME_H
+
+#include <stdint.h>
+#include <time.h>
+
+// Epoch <-> proleptic Gregorian calendar conversion without loops or
+// libc (H. Hinnant's days_from_civil / civil_from_days). Days count from
+// 1970-01-01, epochs are 64-bit seconds, so there is no 2038 limit.
+// Written as single-expression constexpr so it also works under C++11.
+
+struct CivilDate {
+  int32_t year;
+  uint8_t month;  // 1-12
+  uint8_t day;    // 1-31
+};
+
+namespace civil_detail {
+  // Years and days are counted in 400 year eras starting on March 1st
+  constexpr int64_t eraOfYear(int64_t y) { return (y >= 0 ? y : y - 399) / 400; }
+  constexpr int64_t dayOfYear(unsigned m, unsigned d) { return (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1; }
+  constexpr int64_t dayOfEra(int64_t yoe, int64_t doy) { return yoe * 365 + yoe / 4 - yoe / 100 + doy; }
+  constexpr int64_t daysFromMarchYear(int64_t y, unsigned m, unsigned d) {
+    return eraOfYear(y) * 146097 + dayOfEra(y - eraOfYear(y) * 400, dayOfYear(m, d)) - 719468;
+  }
+
+  constexpr int64_t eraOfDays(int64_t z) { return (z >= 0 ? z : z - 146096) / 146097; }
+  constexpr int64_t yearOfEra(int64_t doe) { return (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; }
+  constexpr int64_t dayOfYearInEra(int64_t doe, int64_t yoe) { return doe - (365 * yoe + yoe / 4 - yoe / 100); }
+  constexpr int64_t marchMonth(int64_t doy) { return (5 * doy + 2) / 153; }
+  constexpr CivilDate makeDate(int64_t y, int64_t mp, int64_t doy) {
+    return CivilDate{ (int32_t)(y + (mp >= 10 ? 1 : 0)), (uint8_t)(mp < 10 ? mp + 3 : mp - 9), (uint8_t)(doy - (153 * mp + 2) / 5 + 1) };
+  }
+  constexpr CivilDate dateOfEra(int64_t era, int64_t doe) {
+    return makeDate(yearOfEra(doe) + era * 400, marchMonth(dayOfYearInEra(doe, yearOfEra(doe))), dayOfYearInEra(doe, yearOfEra(doe)));
+  }
+  constexpr CivilDate dateOfShiftedDays(int64_t z) { return dateOfEra(eraOfDays(z), z - eraOfDays(z) * 146097); }
+}
+
+// Days since 1970-01-01 for a calendar date
+constexpr int64_t daysFromCivil(int64_t year, unsigned month, unsigned day) {
+  return civil_detail::daysFromMarchYear(month <= 2 ? year - 1 : year, month, day);
+}
+
+// Calendar date for days since 1970-01-01
+constexpr CivilDate civilFromDays(int64_t days) {
+  return civil_detail::dateOfShiftedDays(days + 719468);
+}
+
+// 0 = Sunday ... 6 = Saturday
+constexpr unsigned weekdayFromDays(int64_t days) {
+  return (unsigned)(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+constexpr bool isLeapYear(int64_t year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// Whole days in epoch seconds, rounded toward negative infinity
+constexpr int64_t daysFromEpoch(int64_t epoch) {
+  return (epoch >= 0 ? epoch : epoch - 86399) / 86400;
+}
+
+static_assert(daysFromCivil(1970, 1, 1) == 0, "civil epoch");
+static_assert(daysFromCivil(2000, 3, 1) == 11017, "civil leap day");
+static_assert(civilFromDays(11016).day == 29, "civil Feb 29th 2000");
+static_assert(weekdayFromDays(0) == 4, "1970-01-01 was a Thursday");
+
+// Replacement for gmtime_r(): epoch seconds to broken-down time
+inline void epochToTm(int64_t epoch, struct tm& out) {
+  int64_t days = daysFromEpoch(epoch);
+  int32_t secs = (int32_t)(epoch - days * 86400);
+  CivilDate date = civilFromDays(days);
+
+  out.tm_sec = secs % 60;
+  out.tm_min = (secs / 60) % 60;
+  out.tm_hour = secs / 3600;
+  out.tm_mday = date.day;
+  out.tm_mon = date.month - 1;
+  out.tm_year = date.year - 1900;
+  out.tm_wday = weekdayFromDays(days);
+  out.tm_yday = (int)(days - daysFromCivil(date.year, 1, 1));
+  out.tm_isdst = 0;
+}
+
+// Replacement for timegm(): broken-down time (tm_year/mon/mday/hour/min/sec) to epoch
+inline int64_t tmToEpoch(const struct tm& in) {
+  return daysFromCivil(in.tm_year + 1900, in.tm_mon + 1, in.tm_mday) * 86400 +
+         in.tm_hour * 3600 + in.tm_min * 60 + in.tm_sec;
+}
+
+#endif // CIVIL_TIME_H
@@ -12,20 +12,21 @@ void initializeDisplay(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix);
 void displayStartupMessage(Adafruit_ST7789& tft);
 void displayClockLogo(Adafruit_ST7789& tft);
 void showStartupPattern(Adafruit_NeoMatrix& matrix);
+int getSignalBarCount(int32_t rssi); // 0-4 bars
 void drawSignalBars(Adafruit_ST7789& tft, int32_t rssi, int x, int y);
-void displayCurrentNetwork(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, const WiFiNetworkInfo& networkInfo, int currentIndex, int totalNetworks);
-void displayPasswordEntry(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, const String& ssid, const String& maskedPassword, char currentChar);
-void displayConnectingMessage(Adafruit_ST7789& tft, const String& ssid);
-void displayWiFiSuccess(Adafruit_ST7789& tft, const String& ssid, const String& ipAddress, int32_t rssi);
-void displayWiFiFailure(Adafruit_ST7789& tft, const String& ssid);
+void displayNetworkList(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, int selectedIndex, int totalNetworks);
+void displayPasswordEntry(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, const char* ssid, const char* maskedPassword, char currentChar);
+void displayConnectingMessage(Adafruit_ST7789& tft, const char* ssid);
+void displayWiFiSuccess(Adafruit_ST7789& tft, const char* ssid, const char* ipAddress, int32_t rssi);
+void displayWiFiFailure(Adafruit_ST7789& tft, const char* ssid);
 
 // Time display functions
-void displayTimeSyncStatus(Adafruit_ST7789& tft, const String& status);
-void displayCurrentTime(Adafruit_ST7789& tft, const String& timeString, const String& dateString);
-void displayClockScreen(Adafruit_ST7789& tft, const String& timeString, const String& dateString, const String& status);
+void displayTimeSyncStatus(Adafruit_ST7789& tft, const char* status, const char* servers);
+void displayCurrentTime(Adafruit_ST7789& tft, const char* timeString, const char* dateString, const char* zone);
+void displayClockScreen(Adafruit_ST7789& tft, const char* timeString, const char* dateString, const char* status, const char* zone);
 
 // Settings display functions
-void displaySettingsMenu(Adafruit_ST7789& tft, int selectedIndex, const String& timezone, const String& dst, const String& brightness, const String& save);
+void displaySettingsMenu(Adafruit_ST7789& tft, int selectedIndex, const char* timezone, const char* dst, const char* brightness, const char* save);
 
 // Display clearing functions
 void clearTFTScreen(Adafruit_ST7789& tft, uint16_t color = ST77XX_BLACK);
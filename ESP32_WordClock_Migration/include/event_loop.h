@@ -0,0 +1,81 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// What woke the loop. wait() returns them combined as EVENT_BIT(type).
+enum EventType {
+  EVENT_TICK,     // Clock tick timer (TickScheduler)
+  EVENT_BUTTON,   // A button pin changed (GPIO interrupt)
+  EVENT_NTP,      // An NTP sync finished
+  EVENT_FRAME,    // Frame timer requested with requestFrame()
+  EVENT_NETWORK,  // A NetworkTask job finished
+  EVENT_TYPE_COUNT
+};
+
+#define EVENT_BIT(type) (1UL << (type))
+
+// Longest wait() blocks without any event
+const uint32_t EVENT_WAIT_MAX_MS = 60000;
+
+struct EventLoopStats {
+  uint32_t wakes;                       // Returns from wait()
+  uint32_t timeouts;                    // ... without an event
+  uint32_t events[EVENT_TYPE_COUNT];    // Received, by type
+  uint32_t dropped;                     // Lost to a full queue
+  uint64_t elapsedUs;                   // Since begin() or resetStats()
+  uint64_t loopBlockedUs;               // Loop task blocked in wait()
+  // loopBlockedUs share of elapsedUs. Not CPU idle time: the render and
+  // network tasks and interrupts run while the loop waits, so the CPU
+  // was idle for at most this share. 100 minus it is the loop's own load.
+  uint8_t loopBlockedPercent;
+};
+
+// Runtime for the main loop: timers, interrupts and modules post events
+// to a FreeRTOS queue, and loop() blocks in wait() until one arrives
+// instead of polling on a fixed delay. With light sleep enabled the idle
+// task puts the chip into automatic light sleep while the loop waits.
+class EventLoop {
+private:
+  QueueHandle_t queue;
+  esp_timer_handle_t frameTimer;
+  uint64_t frameDueUs;            // When the armed frame timer fires, 0 if idle
+
+  EventLoopStats stats;
+  uint64_t statsStartUs;
+  uint64_t lastLogUs;
+
+  static void onFrameTimer(void* arg);
+  void logStats();
+
+public:
+  EventLoop();
+
+  // Create the queue and frame timer; call first in setup()
+  bool begin();
+
+  // Let the chip light sleep while idle (needs power management support
+  // in the ESP-IDF build, false if missing). USB serial pauses while
+  // asleep; wake sources other than timers must be enabled separately.
+  bool enableLightSleep();
+
+  // Queue an event; safe from any task, or from interrupts with FromISR
+  void post(EventType type);
+  void IRAM_ATTR postFromISR(EventType type);
+
+  // Post EVENT_FRAME after delayMs; an earlier pending frame is kept
+  void requestFrame(uint32_t delayMs);
+
+  // Block until events arrive or maxMs passes (at most EVENT_WAIT_MAX_MS).
+  // Returns the EVENT_BIT()s of everything queued, 0 on timeout.
+  uint32_t wait(uint32_t maxMs);
+
+  EventLoopStats getStats();
+  void resetStats();
+};
+
+// Global event loop instance
+extern EventLoop eventLoop;
+
+#endif // EVENT_LOOP_H
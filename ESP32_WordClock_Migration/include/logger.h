@@ -0,0 +1,145 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+// Log levels. Messages above LOG_LEVEL compile to nothing, arguments
+// included; set it for the whole build with -DLOG_LEVEL=...
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Argument bytes a record holds; strings are copied and cut to fit
+#define LOG_PAYLOAD_SIZE 64
+
+enum LogArgType {
+  LOG_ARG_INT,
+  LOG_ARG_UINT,
+  LOG_ARG_INT64,
+  LOG_ARG_UINT64,
+  LOG_ARG_DOUBLE,
+  LOG_ARG_STRING,    // Length byte, then the characters without the terminator
+  LOG_ARG_POINTER
+};
+
+// A message's arguments packed as (type, value) pairs, to be formatted
+// later by the log task
+class LogArgs {
+private:
+  uint8_t data[LOG_PAYLOAD_SIZE];
+  uint8_t length;
+  bool truncated;
+
+  void put(uint8_t type, const void* value, size_t size);
+  void addSigned(int64_t value, bool wide);
+  void addUnsigned(uint64_t value, bool wide);
+
+public:
+  LogArgs() : length(0), truncated(false) {}
+
+  // Narrower integers, chars, bools and enums promote to int
+  void add(int value) { addSigned(value, false); }
+  void add(long value) { addSigned(value, sizeof(value) > 4); }
+  void add(long long value) { addSigned(value, true); }
+  void add(unsigned value) { addUnsigned(value, false); }
+  void add(unsigned long value) { addUnsigned(value, sizeof(value) > 4); }
+  void add(unsigned long long value) { addUnsigned(value, true); }
+  void add(double value) { put(LOG_ARG_DOUBLE, &value, sizeof(value)); }
+  void add(const char* value);
+  void add(const void* value) { put(LOG_ARG_POINTER, &value, sizeof(value)); }
+
+  const uint8_t* getData() const { return data; }
+  uint8_t getLength() const { return length; }
+  bool isTruncated() const { return truncated; }
+};
+
+struct LoggerStats {
+  uint32_t written;      // Records queued
+  uint32_t dropped;      // Lost to a full ring buffer
+  uint32_t truncated;    // Arguments didn't fit the record
+};
+
+// Deferred logger: a message is stored as a binary record (format string
+// pointer, capture time, packed arguments) in a lock-free ring buffer,
+// and a low priority task formats and prints it. Serial writes, which
+// block while the USB buffer is full, stay off the UI and render tasks.
+// Format strings must be literals: the record keeps only the pointer.
+// Before begin(), or without the task, messages print at once.
+class Logger {
+private:
+  TaskHandle_t task;
+  uint32_t tail;                  // Next record to print, log task only
+  uint32_t droppedReported;
+
+  static void taskMain(void* arg);
+  void run();
+  bool printNext();
+  void queue(uint8_t level, const char* format, const uint8_t* data, uint8_t length, bool truncated);
+
+public:
+  Logger();
+
+  // Start the log task; call early in setup()
+  bool begin();
+
+  // Queue a record; safe from any task, not from interrupts
+  void write(uint8_t level, const char* format, const LogArgs& args);
+
+  // Queue bytes to be written as they are, in order with the messages
+  // (up to LOG_PAYLOAD_SIZE)
+  void writeBinary(const uint8_t* data, uint8_t length);
+
+  LoggerStats getStats();
+};
+
+// Global logger instance
+extern Logger logger;
+
+// Pack the arguments, then queue the record
+inline void logCollect(LogArgs&) {}
+
+template <typename T, typename... Rest>
+inline void logCollect(LogArgs& args, T value, Rest... rest) {
+  args.add(value);
+  logCollect(args, rest...);
+}
+
+template <typename... Args>
+inline void logWrite(uint8_t level, const char* format, Args... values) {
+  LogArgs args;
+  logCollect(args, values...);
+  logger.write(level, format, args);
+}
+
+// printf style, one line per message (no trailing newline)
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) logWrite(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) logWrite(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) logWrite(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) logWrite(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+#endif // LOGGER_H
@@ -0,0 +1,71 @@
+#ifndef MATRIX_RENDERER_H
+#define MATRIX_RENDERER_H
+
+#include <Arduino.h>
+#include <Adafruit_NeoMatrix.h>
+#include <time.h>
+
+// What the matrix shows
+enum MatrixScene {
+  MATRIX_BLANK,
+  MATRIX_INTRO,   // Rainbow and word flash, then back to the previous scene
+  MATRIX_WORDS    // The time as words, colors shifting every frame
+};
+
+struct MatrixCommand {
+  uint8_t scene;        // MatrixScene
+  uint8_t hour;
+  uint8_t minute;
+};
+
+// Frame timing of the word animation, how far each frame started after
+// it was due
+struct RenderStats {
+  uint32_t frames;
+  uint32_t overruns;    // Frames more than a period late, schedule restarted
+  uint32_t dropped;     // Commands lost to a full queue
+  uint32_t lateMaxUs;
+  uint64_t lateTotalUs;
+  uint32_t stackFree;   // Bytes never used on the render task's stack
+};
+
+// Owns the NeoMatrix from its own high priority task: the UI posts
+// scenes and carries on, the task animates them. Without the task
+// (creation failed) commands run inline on the caller.
+class MatrixRenderer {
+private:
+  Adafruit_NeoMatrix* matrix;
+  QueueHandle_t commands;
+  TaskHandle_t task;
+  struct tm shown;      // Time of the word scene; render side only
+  bool wordsShown;      // Word scene set: frames animate
+
+  RenderStats stats;
+  uint64_t lastLogUs;
+
+  static void taskMain(void* arg);
+  void run();
+  void execute(const MatrixCommand& command);
+  void drawFrame();
+  void recordFrame(uint64_t lateUs, bool overrun);
+  void send(const MatrixCommand& command);
+
+public:
+  MatrixRenderer();
+
+  // Start the render task; call after the matrix is initialized
+  bool begin(Adafruit_NeoMatrix& neoMatrix);
+
+  void showIntro();
+  void showTime(const struct tm& timeinfo);
+  void clear();
+
+  RenderStats getStats();
+  void resetStats();
+  void logStats();
+};
+
+// Global matrix renderer instance
+extern MatrixRenderer matrixRenderer;
+
+#endif // MATRIX_RENDERER_H
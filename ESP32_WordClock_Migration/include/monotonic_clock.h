@@ -0,0 +1,31 @@
+#ifndef MONOTONIC_CLOCK_H
+#define MONOTONIC_CLOCK_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+// Time since boot from the ESP32's 64 bit microsecond timer. Unlike
+// millis(), which is 32 bits and wraps after 49.7 days, this does not
+// wrap for the life of the device, so plain subtraction of two readings
+// is always the elapsed time.
+inline uint64_t monotonicMicros() {
+  return (uint64_t)esp_timer_get_time();
+}
+
+inline uint64_t monotonicMillis() {
+  return monotonicMicros() / 1000;
+}
+
+// The RTC timer behind gettimeofday(). Unlike monotonicMicros() it keeps
+// counting through software resets and deep sleep, only power-on clears
+// it. Nothing sets the system time, so it stays a plain counter. While
+// the chip is held in reset or asleep it runs from the less accurate
+// RTC slow clock.
+inline uint64_t retainedMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+#endif // MONOTONIC_CLOCK_H
@@ -0,0 +1,76 @@
+#ifndef NETWORK_TASK_H
+#define NETWORK_TASK_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+enum NetworkJobType {
+  NETWORK_JOB_SCAN,
+  NETWORK_JOB_CONNECT,
+  NETWORK_JOB_RESOLVE
+};
+
+// Names one lookup job resolves
+const int NETWORK_RESOLVE_MAX = 3;
+
+enum NetworkJobState {
+  NETWORK_IDLE,      // No job since boot
+  NETWORK_BUSY,
+  NETWORK_DONE,
+  NETWORK_FAILED
+};
+
+struct NetworkJob {
+  uint8_t type;             // NetworkJobType
+  char ssid[33];
+  char password[65];
+  const char* hosts[NETWORK_RESOLVE_MAX];  // RESOLVE, nullptr skips one
+};
+
+// Runs the blocking WiFi calls (scan, connect with its 10 s wait, DNS
+// lookups) on a low priority task so the display keeps going. One scan or
+// connect at a time, and one lookup, which may queue behind it; the
+// result is posted as EVENT_NETWORK, then read with getState() or
+// getResolved(). Without the task (creation failed) jobs run inline on
+// the caller.
+class NetworkTask {
+private:
+  QueueHandle_t jobs;
+  TaskHandle_t task;
+  NetworkJobState state;
+  bool resolving;
+  IPAddress resolved[NETWORK_RESOLVE_MAX];
+  bool resolvedOk[NETWORK_RESOLVE_MAX];
+
+  static void taskMain(void* arg);
+  void run();
+  void execute(const NetworkJob& job);
+  void resolve(const NetworkJob& job);
+  bool start(const NetworkJob& job);
+  void post(const NetworkJob& job);
+
+public:
+  NetworkTask();
+
+  bool begin();
+
+  // False while a job is running
+  bool startScan();
+  bool startConnect(const String& ssid, const String& password);
+
+  // Outcome of the last scan or connect, NETWORK_BUSY until it ends
+  NetworkJobState getState();
+
+  // Look up to NETWORK_RESOLVE_MAX names (nullptr skips one); false while
+  // a lookup is running. The names must stay valid until it ends.
+  bool startResolve(const char* const* hosts, int count);
+  bool isResolving();
+  // After the lookup: the address for hosts[index], false if it did not
+  // resolve or was skipped
+  bool getResolved(int index, IPAddress& address);
+};
+
+// Global network task instance
+extern NetworkTask networkTask;
+
+#endif // NETWORK_TASK_H
@@ -0,0 +1,101 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <Arduino.h>
+
+// 0 compiles every probe and counter out
+#ifndef PERF_COUNTERS
+#define PERF_COUNTERS 1
+#endif
+
+// Timed code paths
+enum PerfProbe {
+  PERF_STATE_UPDATE,    // StateMachine::update(), one loop pass
+  PERF_STATE_ENTER,     // State hooks
+  PERF_STATE_TICK,
+  PERF_STATE_INPUT,
+  PERF_TFT_DRAW,        // display_manager screen functions
+  PERF_MATRIX_FRAME,    // MatrixRenderer frame: brightness, words, show()
+  PERF_MATRIX_SHOW,     // NeoPixel show() alone
+  PERF_NTP_SYNC,        // startSync() to the result, across loop passes
+  PERF_PROBE_COUNT
+};
+
+// Plain event counts
+enum PerfCounter {
+  PERF_COUNT_TRANSITIONS,
+  PERF_COUNT_BUTTON_EVENTS,
+  PERF_COUNT_TFT_CLEARS,      // Full screen redraws
+  PERF_COUNT_NTP_SYNCS,
+  PERF_COUNT_NTP_FAILURES,
+  PERF_COUNTER_COUNT
+};
+
+// Bucket 0 is under 16 us, then one per power of two; the last is open
+// ended (from 4.2 s)
+#define PERF_HISTOGRAM_BUCKETS 20
+
+struct PerfProbeStats {
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint64_t totalUs;
+  uint32_t buckets[PERF_HISTOGRAM_BUCKETS];
+};
+
+// Timers with min/max/avg and a latency histogram per probe, plus named
+// counters. Recording is a cycle counter read and a short critical
+// section; nothing is printed until dump(), on request over serial.
+class PerfCounters {
+private:
+  PerfProbeStats probes[PERF_PROBE_COUNT];
+  uint32_t counters[PERF_COUNTER_COUNT];
+  uint32_t cyclesPerUs;
+  uint64_t startUs;
+
+public:
+  PerfCounters();
+
+  void record(PerfProbe probe, uint32_t us);
+  void recordCycles(PerfProbe probe, uint32_t cycles);
+  void count(PerfCounter counter);
+
+  PerfProbeStats getStats(PerfProbe probe);
+  uint32_t getCount(PerfCounter counter);
+  void reset();
+
+  // Print everything to serial (blocking, on request only)
+  void dump();
+
+  // Upper bound of the bucket holding the given percentile, in us
+  static uint32_t percentileUs(const PerfProbeStats& stats, uint8_t percent);
+};
+
+// Global instance
+extern PerfCounters perfCounters;
+
+// Times its scope in CPU cycles
+class PerfScope {
+private:
+  PerfProbe probe;
+  uint32_t startCycles;
+
+public:
+  explicit PerfScope(PerfProbe probe) : probe(probe), startCycles(ESP.getCycleCount()) {}
+  ~PerfScope() { perfCounters.recordCycles(probe, ESP.getCycleCount() - startCycles); }
+};
+
+#define PERF_CONCAT_(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_(a, b)
+
+#if PERF_COUNTERS
+#define PERF_SCOPE(probe) PerfScope PERF_CONCAT(perfScope, __LINE__)(probe)
+#define PERF_COUNT(counter) perfCounters.count(counter)
+#define PERF_RECORD(probe, us) perfCounters.record(probe, us)
+#else
+#define PERF_SCOPE(probe) do {} while (0)
+#define PERF_COUNT(counter) do {} while (0)
+#define PERF_RECORD(probe, us) do {} while (0)
+#endif
+
+#endif // PERF_COUNTERS_H
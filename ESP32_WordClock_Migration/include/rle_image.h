@@ -0,0 +1,26 @@
+#ifndef RLE_IMAGE_H
+#define RLE_IMAGE_H
+
+#include <Arduino.h>
+#include <Adafruit_SPITFT.h>
+
+// Run-length encoded RGB565 image, generated by tools/assetconvert.
+// Data is a sequence of packets; each starts with a header byte:
+//   0x80 | (n - 1)  run: one color (2 bytes, big-endian) repeated n times
+//   (n - 1)         literal: n colors follow (2 bytes each, big-endian)
+// n is 1-128. Packets may cross rows; pixels run left to right, top down.
+struct RLEImage {
+  uint16_t width;
+  uint16_t height;
+  const uint8_t* data;
+  uint32_t size;  // Bytes in data
+};
+
+// Pixels decoded per burst write
+const int RLE_LINE_PIXELS = 64;
+
+// Stream an image into the TFT address window, no framebuffer needed.
+// The image must lie fully on screen.
+void drawRLEImage(Adafruit_SPITFT& tft, int16_t x, int16_t y, const RLEImage& image);
+
+#endif // RLE_IMAGE_H
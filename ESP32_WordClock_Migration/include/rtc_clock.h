@@ -0,0 +1,72 @@
+#ifndef RTC_CLOCK_H
+#define RTC_CLOCK_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <RTClib.h>
+#include "time_manager.h"
+
+// Supported battery backed RTC chips (both at I2C address 0x68)
+enum RTCChip {
+  RTC_CHIP_NONE,
+  RTC_CHIP_DS3231,
+  RTC_CHIP_PCF8523
+};
+
+// Holdover time source: the RTC is read at boot so the clock shows valid
+// time before WiFi and NTP, and is corrected after each NTP sync. Its own
+// frequency error is measured between syncs and trimmed with the aging
+// (DS3231) or offset (PCF8523) register.
+class RtcClock {
+private:
+  RTCChip chip;
+  RTC_DS3231 ds3231;
+  RTC_PCF8523 pcf8523;
+  bool present;
+  
+  // Phase measurement: the RTC's seconds rollover against NTP time
+  bool measuring;
+  uint64_t measureStartUs;
+  uint64_t lastReadUs;
+  uint8_t lastSeconds;
+  uint64_t handledSyncTime;         // NTP sync already compared against
+  int64_t lastErrorUs;              // RTC minus true time at the last measurement
+  
+  // Calibration baseline: the RTC error at an earlier measurement
+  bool haveReference;
+  int64_t referenceErrorUs;
+  FixedTime referenceTime;          // True UTC of that measurement
+  
+  bool pendingSet;                  // Write the time just after the next second boundary
+  bool verifyingSet;                // Measuring right after a write
+  
+  uint8_t readRegister(uint8_t reg);
+  void writeRegister(uint8_t reg, uint8_t value);
+  uint8_t readSeconds();
+  uint32_t readEpoch();
+  bool waitForRollover(uint64_t& edgeUs);
+  void startMeasurement();
+  void finishMeasurement(uint64_t edgeUs);
+  void setTime();
+  void writeTrim(int trim);
+  void adjustTrim(int64_t fastPpb);
+
+public:
+  RtcClock();
+  
+  // Probe for the chip and hand a valid RTC time to timeManager
+  bool begin(RTCChip rtcChip);
+  
+  // Compare with and correct from NTP time; call every loop
+  void update();
+  
+  bool isPresent();
+  bool isMeasuring();               // Wants frequent update() calls
+  int readTrim();                   // Aging/offset register, signed
+  int32_t getLastErrorMs();
+};
+
+// Global RTC instance
+extern RtcClock rtcClock;
+
+#endif // RTC_CLOCK_H
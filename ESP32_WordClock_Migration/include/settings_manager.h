@@ -3,6 +3,8 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include "static_string.h"
+#include "tz_rules.h"
 
 // DST rule types
 enum DSTRules {
@@ -15,6 +17,7 @@ enum DSTRules {
 struct ClockSettings {
   int timezoneOffset;     // Hours from UTC (-12 to +12)
   DSTRules dstRules;      // DST calculation rules
+  char timezoneName[TZ_NAME_LENGTH]; // Zone from the zone table, "" = use offset and DST rules
   int brightness;         // Display brightness (0-100)
   bool firstTimeSetup;    // Flag for initial setup
 };
@@ -37,6 +40,23 @@ private:
   // Common timezone definitions
   static const TimezoneInfo timezones[];
   static const int timezoneCount;
+  
+  // Rule for the selected zone or the offset/DST rules settings
+  TZRule activeRule;
+  
+  // DST transition instants (UTC) for dstYear and dstYear + 1 in time
+  // order; rebuilt when the year or the zone settings change
+  int64_t dstTransitions[4];
+  bool dstAfter[4];            // DST in effect after each transition
+  int dstYear;                 // 0 = table not built
+  
+  // Offset in effect over [offsetValidFrom, offsetValidUntil)
+  int cachedOffset;
+  int64_t offsetValidFrom;
+  int64_t offsetValidUntil;
+  
+  void computeDSTTransitions(int year);
+  void updateTimezoneRule();
 
 public:
   // Constructor
@@ -57,21 +77,26 @@ public:
   DSTRules getDSTRules() const;
   int getBrightness() const;
   bool isFirstTimeSetup() const;
+  const char* getTimezoneName() const;
+  bool hasTimezoneName() const;
   
   // Setters
   void setTimezoneOffset(int offset);
   void setDSTRules(DSTRules rules);
   void setBrightness(int brightness);
   void setFirstTimeSetup(bool firstTime);
+  void setTimezoneName(const char* name);   // "" selects offset and DST rules
   
   // Timezone helpers
-  String getTimezoneDisplayName(int offset) const;
-  String getCurrentTimezoneDisplayName() const;
+  void getTimezoneDisplayName(int offset, StringBuffer& out) const;
+  void getCurrentTimezoneDisplayName(StringBuffer& out) const;
   int getNextTimezoneOffset(int currentOffset) const;
   int getPreviousTimezoneOffset(int currentOffset) const;
+  void selectNextTimezone();   // Offsets first, then the zone table
   
   // DST helpers
-  String getDSTRulesDisplayName(DSTRules rules) const;
+  int getUTCOffsetAt(int64_t utc);  // Seconds east of UTC including DST
+  const char* getDSTRulesDisplayName(DSTRules rules) const;
   DSTRules getNextDSTRules(DSTRules currentRules) const;
   
   // Validation
@@ -79,7 +104,7 @@ public:
   bool isValidBrightness(int brightness) const;
   
   // Status
-  String getStatusString() const;
+  void getStatusString(StringBuffer& out) const;
 };
 
 // Global settings manager instance
@@ -8,7 +8,12 @@
 #include "display_manager.h"
 #include "button_handler.h"
 #include "time_manager.h"
+#include "tick_scheduler.h"
+#include "event_loop.h"
+#include "network_task.h"
+#include "matrix_renderer.h"
 #include "settings_manager.h"
+#include "static_string.h"
 
 // System State Machine
 enum SystemState {
@@ -25,59 +30,144 @@ enum SystemState {
   STATE_SETTINGS,        // Settings configuration (timezone, DST, brightness)
   STATE_TIME_SYNC,       // Time synchronization
   STATE_CLOCK_DISPLAY,   // Main clock display
-  STATE_WORDCLOCK_DISPLAY // WordClock matrix display mode
+  STATE_WORDCLOCK_DISPLAY, // WordClock matrix display mode
+  STATE_COUNT
+};
+
+// What a state reports back: button gestures, and the outcome of its
+// own work. The transition table maps (state, input) to the next state.
+// Each gesture has one input per button, in ButtonId order.
+enum StateInput {
+  INPUT_NONE,       // Nothing happened, or handled in place: stay
+  INPUT_BUTTON_A,   // Short press
+  INPUT_BUTTON_B,
+  INPUT_BUTTON_C,
+  INPUT_LONG_A,     // Held
+  INPUT_LONG_B,
+  INPUT_LONG_C,
+  INPUT_DOUBLE_A,   // Second short press in a row (after its INPUT_BUTTON_x)
+  INPUT_DOUBLE_B,
+  INPUT_DOUBLE_C,
+  INPUT_REPEAT_A,   // Still held after the long press
+  INPUT_REPEAT_B,
+  INPUT_REPEAT_C,
+  INPUT_DONE,       // Finished (timer ran out, scan or connect done, ...)
+  INPUT_FAILED,     // Gave up
+  INPUT_SKIP,       // Finished with a shortcut (time already known, open network, setup done before)
+  INPUT_CANCEL,     // Left without applying changes
+  INPUT_NO_WIFI,    // Needs a network first
+  STATE_INPUT_COUNT
+};
+
+// Password being typed, kept for a retry after a failed connection
+struct PasswordContext {
+  StaticString<64> password;  // WPA passphrases are at most 63 characters
+  int charIndex;          // Into characterSet
+};
+
+struct SettingsContext {
+  int index;              // Highlighted menu line
+};
+
+struct TimeSyncContext {
+  bool finished;          // Result shown, waiting for the deadline
 };
 
 class StateMachine {
 private:
-  // State variables
+  typedef StateInput (StateMachine::*StateHook)();
+  typedef StateInput (StateMachine::*InputHook)(StateInput input);
+  typedef void (StateMachine::*ExitHook)();
+  
+  // One row per state, in SystemState order
+  struct StateDef {
+    SystemState state;
+    const char* name;
+    StateHook onEnter;    // Draw the screen, start timers; may finish at once
+    StateHook onTick;     // Deadline passed or a wakeOn event arrived
+    InputHook onInput;    // Buttons: act, and pass on the input for the table
+    ExitHook onExit;
+    uint32_t wakeOn;      // EVENT_BIT()s that tick the state
+  };
+  
+  struct Transition {
+    SystemState state;
+    StateInput input;
+    SystemState next;
+  };
+  
+  static const StateDef states[];
+  static const Transition transitions[];
+  
   SystemState currentState;
   SystemState previousState;
-  bool displayNeedsUpdate;
-  bool stateChanged;
+  uint64_t deadlineUs;            // onTick due, 0 for none; cleared on each state change
+  
+  // Per-state contexts, reset on entry
+  PasswordContext passwordEntry;  // Reset when a new password is started
+  SettingsContext settingsMenu;
+  TimeSyncContext timeSync;
+  bool wordClockStarted;          // Matrix intro has played (once per boot)
   
-  // Password entry variables
-  String currentPassword;
-  int passwordPosition;
-  int currentCharIndex;
   static const char characterSet[];
   static const int characterSetSize;
   
   // Hardware references
   Adafruit_ST7789& tft;
   Adafruit_NeoMatrix& matrix;
+  
+  void enterState(SystemState newState);
+  void dispatch(StateInput input);
+  static StateInput buttonInput(const ButtonEvent& event);
+  void setDeadline(uint32_t delayMs);
+  bool serviceTimeSync(const char* tag);
+  void armSyncRetry(bool failed);
+  
+  // State hooks
+  StateInput enterInit();
+  StateInput enterLogo();
+  StateInput enterStartupMessage();
+  StateInput tickStartupMessage();
+  StateInput enterWiFiScan();
+  StateInput tickNetworkJob();     // Shared: scan and connect results
+  StateInput enterWiFiDisplay();
+  StateInput inputWiFiDisplay(StateInput input);
+  StateInput enterPasswordEntry();
+  StateInput inputPasswordEntry(StateInput input);
+  StateInput enterWiFiConnecting();
+  StateInput enterWiFiSuccess();
+  StateInput inputWiFiSuccess(StateInput input);
+  StateInput enterWiFiFailure();
+  StateInput enterSettings();
+  StateInput inputSettings(StateInput input);
+  StateInput enterTimeSync();
+  StateInput tickTimeSync();
+  StateInput enterClockDisplay();
+  StateInput tickClockDisplay();
+  StateInput inputClockDisplay(StateInput input);
+  StateInput enterWordClockDisplay();
+  StateInput tickWordClockDisplay();
+  void exitWordClockDisplay();
+  StateInput finish();            // Shared: report INPUT_DONE
+  void drawPasswordEntry();
+  void drawSettings();
+  void showSyncResult(bool success);
+  void drawClock();
+  void drawWordClock();
 
 public:
   // Constructor
   StateMachine(Adafruit_ST7789& tftDisplay, Adafruit_NeoMatrix& neoMatrix);
   
-  // State management methods
-  void changeState(SystemState newState);
-  SystemState getCurrentState() const;
-  SystemState getPreviousState() const;
-  bool hasStateChanged() const;
-  bool needsDisplayUpdate() const;
-  void clearStateChanged();
-  void setDisplayNeedsUpdate(bool needsUpdate = true);
+  // Enter the first state; call at the end of setup()
+  void begin();
   
-  // Main state machine update method
-  void update();
+  // React to the events returned by eventLoop.wait(): buttons, ticks and
+  // the current state's deadline
+  void update(uint32_t events);
   
-  // State-specific handlers
-  void handleInitState();
-  void handleLogoDisplayState();
-  void handleStartupMessageState();
-  void handleWiFiScanState();
-  void handleWiFiDisplayState();
-  void handlePasswordEntryState();
-  void handleWiFiConnectingState();
-  void handleWiFiSuccessState();
-  void handleWiFiFailureState();
-  void handleWiFiConnectState();
-  void handleSettingsState();
-  void handleTimeSyncState();
-  void handleClockDisplayState();
-  void handleWordClockDisplayState();
+  SystemState getCurrentState() const;
+  SystemState getPreviousState() const;
 };
 
 #endif // STATE_MACHINE_H
@@ -0,0 +1,125 @@
+#ifndef STATIC_STRING_H
+#define STATIC_STRING_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+// Fixed-capacity string for the render path: never touches the heap.
+// Text that does not fit is truncated, the buffer is always terminated.
+// Functions take StringBuffer& so callers can pick any StaticString<N>.
+class StringBuffer {
+protected:
+  char* data;
+  size_t capacity;  // Including null terminator
+  size_t len;
+
+  StringBuffer(char* storage, size_t size) : data(storage), capacity(size), len(0) {
+    data[0] = '\0';
+  }
+
+public:
+  // Storage belongs to the derived StaticString, so never copy the base
+  StringBuffer(const StringBuffer&) = delete;
+  StringBuffer& operator=(const StringBuffer&) = delete;
+
+  StringBuffer& operator=(const char* text) {
+    clear();
+    return append(text);
+  }
+
+  void clear() {
+    len = 0;
+    data[0] = '\0';
+  }
+
+  // Drop everything from position n on
+  void truncate(size_t n) {
+    if (n < len) {
+      len = n;
+      data[len] = '\0';
+    }
+  }
+
+  StringBuffer& append(const char* text) {
+    while (*text && len < capacity - 1) {
+      data[len++] = *text++;
+    }
+    data[len] = '\0';
+    return *this;
+  }
+
+  StringBuffer& append(char c) {
+    if (len < capacity - 1) {
+      data[len++] = c;
+      data[len] = '\0';
+    }
+    return *this;
+  }
+
+  StringBuffer& appendf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    vappendf(format, args);
+    va_end(args);
+    return *this;
+  }
+
+  StringBuffer& vappendf(const char* format, va_list args) {
+    int written = vsnprintf(data + len, capacity - len, format, args);
+    if (written > 0) {
+      len += ((size_t)written < capacity - len) ? (size_t)written : capacity - 1 - len;
+    }
+    return *this;
+  }
+
+  // Replace the contents with formatted text
+  StringBuffer& printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    clear();
+    va_list args;
+    va_start(args, format);
+    vappendf(format, args);
+    va_end(args);
+    return *this;
+  }
+
+  const char* c_str() const { return data; }
+  size_t length() const { return len; }
+  size_t maxLength() const { return capacity - 1; }
+  bool isFull() const { return len == capacity - 1; }
+
+  bool operator==(const char* other) const { return strcmp(data, other) == 0; }
+  bool operator!=(const char* other) const { return strcmp(data, other) != 0; }
+};
+
+template <size_t N>
+class StaticString : public StringBuffer {
+private:
+  char storage[N];
+
+public:
+  StaticString() : StringBuffer(storage, N) {}
+
+  StaticString(const char* text) : StringBuffer(storage, N) {
+    append(text);
+  }
+
+  StaticString(const StaticString& other) : StringBuffer(storage, N) {
+    append(other.c_str());
+  }
+
+  StaticString& operator=(const StaticString& other) {
+    if (this != &other) {
+      clear();
+      append(other.c_str());
+    }
+    return *this;
+  }
+
+  StaticString& operator=(const char* text) {
+    clear();
+    append(text);
+    return *this;
+  }
+};
+
+#endif // STATIC_STRING_H
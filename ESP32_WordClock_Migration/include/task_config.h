@@ -0,0 +1,20 @@
+#ifndef TASK_CONFIG_H
+#define TASK_CONFIG_H
+
+#include <Arduino.h>
+
+// FreeRTOS tasks of the app. The matrix animation must not stutter behind
+// a TFT redraw, and neither may wait for a WiFi scan or connection.
+// Log output comes last. (esp_timer and the WiFi driver run above all.)
+const UBaseType_t RENDER_TASK_PRIORITY = 3;   // NeoMatrix frames (MatrixRenderer)
+const UBaseType_t UI_TASK_PRIORITY = 2;       // Arduino loop(): state machine, TFT, NTP
+const UBaseType_t NETWORK_TASK_PRIORITY = 1;  // Blocking WiFi jobs (NetworkTask)
+const UBaseType_t LOG_TASK_PRIORITY = 1;      // Formats and prints log records (Logger); just above idle
+
+// Stack budgets in bytes (ESP-IDF counts bytes, not words). The loop
+// task keeps the Arduino core's CONFIG_ARDUINO_LOOP_STACK_SIZE (8 KB).
+const uint32_t RENDER_TASK_STACK = 4096;
+const uint32_t NETWORK_TASK_STACK = 6144;     // WiFi scan and connect, String copies
+const uint32_t LOG_TASK_STACK = 3072;         // snprintf with doubles
+
+#endif // TASK_CONFIG_H
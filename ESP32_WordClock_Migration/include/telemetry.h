@@ -0,0 +1,37 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "telemetry_frames.h"
+
+// Compact binary frames on the serial port, decoded on a PC by
+// tools/telemetry. Events (state transitions, sync results) are sent as
+// they happen, summaries (heap, matrix timing, perf probes) every few
+// seconds. Frames go through the logger so they stay in order with the
+// text log and off the UI task. Off until enabled.
+class Telemetry {
+private:
+  bool enabled;
+  uint64_t lastSummaryUs;
+
+  void send(uint8_t type, const void* payload, uint8_t length);
+  void sendSummaries();
+
+public:
+  Telemetry();
+
+  // Enabling sends a HELLO frame, then the summaries at once
+  void setEnabled(bool on);
+  bool isEnabled() const;
+
+  void sendState(uint8_t from, uint8_t to);
+  void sendSync(bool success, uint32_t durationMs);
+
+  // Periodic summaries; call once per loop pass
+  void update();
+};
+
+// Global instance
+extern Telemetry telemetry;
+
+#endif // TELEMETRY_H
@@ -0,0 +1,94 @@
+#ifndef TELEMETRY_FRAMES_H
+#define TELEMETRY_FRAMES_H
+
+// Wire format of the binary telemetry stream, shared with the host
+// decoder in tools/telemetry (plain C, no Arduino headers).
+//
+// Frames are mixed into the text log on the serial port:
+//
+//   0xA5, type, length, payload[length], CRC-16 low byte, high byte
+//
+// The CRC (CCITT, start 0xFFFF) covers type, length and payload. The
+// log text can hold 0xA5 too (UTF-8, line noise), so a 0xA5 only marks
+// a possible frame: the decoder checks the length and the CRC, which
+// reject false syncs, and reads anything that fails as text. Multi-byte
+// fields are little endian, like the ESP32 and the hosts we decode on.
+
+#include <stdint.h>
+
+#define TELEMETRY_SYNC_BYTE 0xA5
+#define TELEMETRY_PROTOCOL_VERSION 1
+#define TELEMETRY_MAX_PAYLOAD 48
+#define TELEMETRY_FRAME_OVERHEAD 5     // Sync, type, length, CRC
+
+enum TelemetryFrameType {
+  TELEMETRY_HELLO = 1,    // Stream (re)started
+  TELEMETRY_STATE,        // State machine transition
+  TELEMETRY_HEAP,         // Heap and stack watermarks, periodic
+  TELEMETRY_SYNC,         // NTP sync result
+  TELEMETRY_RENDER,       // Matrix frame timing, periodic, totals since its last reset
+  TELEMETRY_PROBE         // One perf_counters probe, periodic, totals since reset
+};
+
+// Every payload starts with the sender's uptime
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeMs;
+  uint8_t protocol;           // TELEMETRY_PROTOCOL_VERSION
+  char firmware[12];          // SOFTWARE_VERSION, zero padded
+} TelemetryHello;
+
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeMs;
+  uint8_t from;               // SystemState
+  uint8_t to;
+  uint32_t freeHeap;
+} TelemetryState;
+
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeMs;
+  uint32_t freeHeap;
+  uint32_t minFreeHeap;       // Low watermark since boot
+  uint32_t largestBlock;      // Biggest allocation that would succeed
+  uint32_t uiStackFree;       // Bytes never used on the UI task's stack
+  uint32_t renderStackFree;   // And on the render task's
+} TelemetryHeap;
+
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeMs;
+  uint8_t success;
+  uint32_t durationMs;        // startSync() to the result
+  int32_t offsetMs;           // Of the last successful sync
+  uint32_t delayMs;
+  int32_t driftPpb;
+} TelemetrySync;
+
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeMs;
+  uint32_t frames;
+  uint32_t overruns;
+  uint32_t dropped;
+  uint32_t lateAvgUs;
+  uint32_t lateMaxUs;
+} TelemetryRender;
+
+typedef struct __attribute__((packed)) {
+  uint32_t uptimeMs;
+  uint8_t probe;              // PerfProbe
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t avgUs;
+  uint32_t maxUs;
+  uint32_t p99Us;
+} TelemetryProbe;
+
+static inline uint16_t telemetryCrc16(const uint8_t* data, uint32_t length, uint16_t crc) {
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+#endif // TELEMETRY_FRAMES_H
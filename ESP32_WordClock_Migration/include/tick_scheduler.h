@@ -0,0 +1,48 @@
+#ifndef TICK_SCHEDULER_H
+#define TICK_SCHEDULER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Tick events, combined as bits
+enum TickEvent {
+  TICK_NONE   = 0,
+  TICK_SECOND = 1 << 0,   // A UTC second boundary passed
+  TICK_MINUTE = 1 << 1    // That second started a new minute
+};
+
+// Fires on wall clock second (or minute) boundaries, as kept by
+// TimeManager, from a one-shot esp_timer re-armed for each boundary. The
+// timer posts EVENT_TICK, so renders start on the tick instead of at the
+// next poll of the loop.
+class TickScheduler {
+private:
+  esp_timer_handle_t timer;
+  TickEvent resolution;           // TICK_SECOND or TICK_MINUTE
+  volatile uint8_t pendingTicks;  // Set by the timer, taken by the loop
+  volatile bool armed;
+  uint64_t armedSyncTime;         // Sync the timer was armed against
+  uint64_t lastMinute;
+  
+  void arm();
+  static void onTimer(void* arg);
+
+public:
+  TickScheduler();
+  
+  // Create the timer
+  bool begin();
+  
+  // Tick every second, or only on minute boundaries for screens without
+  // seconds. Both raise TICK_SECOND, TICK_MINUTE is added on a new minute.
+  void setResolution(TickEvent tickResolution);
+  
+  // Ticks since the last call (TickEvent bits). Also re-arms the timer,
+  // including after the time was stepped by a sync.
+  uint8_t takeTicks();
+};
+
+// Global tick scheduler instance
+extern TickScheduler tickScheduler;
+
+#endif // TICK_SCHEDULER_H
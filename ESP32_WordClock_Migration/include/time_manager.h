@@ -4,7 +4,28 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <WiFiUdp.h>
+#include <time.h>
 #include "settings_manager.h"
+#include "static_string.h"
+#include "civil_time.h"
+#include "monotonic_clock.h"
+
+// UTC as unsigned 32.32 fixed point seconds since 1970: whole seconds in
+// the high word, binary fraction in the low word (NTP timestamp layout).
+// Differences are signed 32.32 in an int64_t.
+typedef uint64_t FixedTime;
+
+inline FixedTime fixedFromMicros(uint64_t us) {
+  return ((us / 1000000) << 32) + (((us % 1000000) << 32) / 1000000);
+}
+
+inline uint64_t fixedToMillis(FixedTime t) {
+  return (t >> 32) * 1000 + (((t & 0xFFFFFFFFULL) * 1000) >> 32);
+}
+
+inline uint64_t fixedToMicros(FixedTime t) {
+  return (t >> 32) * 1000000 + (((t & 0xFFFFFFFFULL) * 1000000) >> 32);
+}
 
 // Forward declaration for NTPClient
 class NTPClient;
@@ -17,6 +38,43 @@ enum TimeSyncStatus {
   TIME_SYNC_FAILED
 };
 
+// Where the current time came from
+enum TimeSource {
+  TIME_SOURCE_NONE,
+  TIME_SOURCE_RETAINED, // Carried over a reset in RTC memory, unsynced
+  TIME_SOURCE_RTC,    // Holdover from the battery backed RTC, until NTP answers
+  TIME_SOURCE_NTP
+};
+
+// Result of TimeManager::poll()
+enum NTPPollResult {
+  NTP_POLL_IDLE,      // No sync in progress
+  NTP_POLL_PENDING,   // Waiting for a reply
+  NTP_POLL_SUCCESS,   // Time updated
+  NTP_POLL_FAILED     // Every attempt timed out
+};
+
+// Servers queried together on each sync: the configured one and two fallbacks
+const int NTP_SERVER_COUNT = 3;
+
+// Wait after a failed sync before needsTimeSync() asks for another
+const uint32_t NTP_RETRY_INTERVAL_MS = 60000;
+
+enum NTPReplyState {
+  NTP_REPLY_WAITING,
+  NTP_REPLY_VALID,
+  NTP_REPLY_REJECTED  // Failed validation, or never sent
+};
+
+// One server's answer in the current sync round
+struct NTPSample {
+  FixedTime time;                 // UTC when the reply arrived
+  uint64_t receiveUs;              // Monotonic time the reply arrived (T4)
+  FixedTime delay;                // Network round trip
+  FixedTime distance;             // Error bound of time: half the delay plus the server's root distance
+  uint8_t stratum;
+};
+
 class TimeManager {
 private:
   WiFiUDP* ntpUDP;
@@ -25,18 +83,69 @@ private:
   // Time configuration
   const char* ntpServer;
   int timezoneOffset;
-  unsigned long lastSyncTime;
-  unsigned long lastSyncMillis;
-  unsigned long syncInterval;
+  uint64_t lastSyncTime;            // Whole UTC seconds of syncFixedTime
+  uint64_t lastSyncUs;              // Monotonic time of the last sync
+  FixedTime syncFixedTime;          // UTC at lastSyncUs
+  int64_t lastOffset;               // Clock correction of the last sync (32.32)
+  FixedTime lastDelay;              // Round trip delay of the last sync
+  FixedTime lastDistance;           // Error bound of the last sync
+  
+  // Clock discipline: the local oscillator's frequency error, learnt from
+  // successive sync offsets and applied to elapsed time
+  int32_t driftPpb;                 // Parts per billion, + = local clock slow
+  int driftSamples;                 // Syncs that trained driftPpb
+  void disciplineClock(int64_t offset, uint64_t intervalMs);
+  unsigned long syncInterval;       // Adapted to the measured drift
   TimeSyncStatus syncStatus;
+  TimeSource timeSource;
+  
+  // NTP round in flight (startSync/poll): one request per server
+  bool syncPending;
+  int syncAttempt;                  // Rounds sent
+  uint64_t syncStartUs;             // startSync() call, for the sync duration
+  uint64_t roundStartUs;            // When the current round was sent, also the
+                                    // common reference for comparing samples
+  uint64_t requestUs[NTP_SERVER_COUNT];           // T1, for the round trip
+  uint32_t requestNonce[NTP_SERVER_COUNT];        // Echoed back in the reply's origin timestamp
+  IPAddress serverIP[NTP_SERVER_COUNT];           // Kept between lookups, see startLookups()
+  bool serverResolved[NTP_SERVER_COUNT];
+  uint64_t resolvedUs[NTP_SERVER_COUNT];
+  bool lookingUp;                                 // Lookup on the network task, first round waits
+  bool lookupPending[NTP_SERVER_COUNT];           // Servers in that lookup
+  NTPReplyState replyState[NTP_SERVER_COUNT];
+  NTPSample samples[NTP_SERVER_COUNT];
+  int roundQueried;                 // Requests sent in the last round
+  int roundReplied;                 // Usable replies to them
+  int selectedServer;               // Server of the last NTP sync, -1 before one
+  bool lastSyncFailed;
+  uint64_t lastFailureUs;
   
-  // DST calculation functions
-  bool isDST(int month, int day, int year);      // US DST rules
-  bool isDSTEU(int month, int day, int year);    // EU DST rules
-  int calculateTimezoneOffset();
+  // Cached local time for snapshot()
+  struct tm cachedTime;
+  uint64_t cachedUtc;
+  uint64_t cachedLocal;
+  bool cacheValid;
+  static void advanceSecond(struct tm& t);
+  
+  // Timezone offset (seconds) including DST at a UTC time
+  int calculateTimezoneOffset(uint64_t utc);
   
   // NTP communication
-  bool sendNTPPacket();
+  const char* getServer(int index);
+  bool startLookups();
+  void finishLookups();
+  bool sendFirstRound();
+  bool sendNTPRound();
+  bool sendNTPPacket(int index);
+  void readNTPReply(int size);
+  static FixedTime readNTPTimestamp(const uint8_t* field);
+  int selectNTPSample();
+  void applyNTPSample(const NTPSample& sample);
+  void finishSync(bool success);
+  
+  // Time kept in RTC memory across resets
+  uint64_t lastRetainUs;
+  void writeRetainedTime();
 
 public:
   // Constructor
@@ -49,18 +158,34 @@ public:
   bool initialize();
   void cleanup();
   
-  // Time synchronization
-  bool syncTime();
+  // Time synchronization (non-blocking: startSync, then poll every loop)
+  bool startSync();
+  NTPPollResult poll();
   bool forceSync();
+  bool isSyncing();
   bool needsTimeSync();
   TimeSyncStatus getSyncStatus();
-  unsigned long getLastSyncTime();
+  TimeSource getTimeSource();
+  void setHoldoverTime(FixedTime utc, uint64_t localUs);  // Ignored once NTP time is known
+  bool restoreRetainedTime();       // Time saved before a reset; call first thing in setup()
+  void retainTime();                // Refresh the saved time; call every loop
+  uint64_t getLastSyncTime();
+  int32_t getLastOffsetMs();        // Correction applied by the last sync
+  uint32_t getLastDelayMs();        // Network round trip of the last sync
+  int32_t getDriftPpb();            // Learnt oscillator frequency error
+  unsigned long getSyncInterval();
   
   // Time retrieval
-  String getFormattedTime();        // "HH:MM:SS"
-  String getFormattedDate();        // "YYYY-MM-DD"
-  String getFormattedDateTime();    // "YYYY-MM-DD HH:MM:SS"
-  unsigned long getCurrentEpoch();  // Unix timestamp
+  const struct tm& snapshot();      // Local time, recomputed at most once per second
+  void getFormattedTime(StringBuffer& out);      // "HH:MM:SS"
+  void getFormattedDate(StringBuffer& out);      // "YYYY-MM-DD"
+  void getFormattedDateTime(StringBuffer& out);  // "YYYY-MM-DD HH:MM:SS"
+  uint64_t getCurrentEpoch();       // Local time as a Unix timestamp
+  FixedTime getCurrentFixedTime();  // UTC, 32.32 fixed point
+  FixedTime getFixedTimeAt(uint64_t localUs);  // UTC at a monotonicMicros() reading
+  uint64_t getCurrentEpochMs();     // UTC milliseconds (no timezone, unlike getCurrentEpoch)
+  unsigned long getMillisToNextSecond();  // 1-1000 ms until the next UTC second boundary
+  uint32_t getMicrosToNextSecond();       // 1-1000000 us, for timers
   int getHours();
   int getMinutes();
   int getSeconds();
@@ -70,11 +195,15 @@ public:
   
   // Configuration
   void setNTPServer(const char* server);
+  const char* getNTPServer();       // Configured server, queried with NTP_SERVER_COUNT - 1 fallbacks
+  const char* getSelectedServer();  // Server the last NTP sync used, "" before one
+  int getServersQueried();          // Last round: requests sent
+  int getServersReplied();          // Last round: usable replies
   void setSyncInterval(unsigned long intervalMs);
   
   // Status
   bool isTimeValid();
-  String getStatusString();
+  const char* getStatusString();
 };
 
 // Global time manager instance
@@ -0,0 +1,49 @@
+#ifndef TZ_RULES_H
+#define TZ_RULES_H
+
+#include <Arduino.h>
+
+// Longest zone name in the table plus terminator
+const int TZ_NAME_LENGTH = 32;
+
+// When a DST change happens within a year. POSIX TZ forms:
+//   Mm.w.d  day d (0 = Sunday) of week w (1-4, 5 = last) of month m
+//   Jn      day n (1-365), Feb 29th is never counted
+//   n       zero based day of year (0-365), leap days counted
+struct TZTransitionRule {
+  char type;        // 'M', 'J' or 'D' (plain n)
+  uint8_t month;
+  uint8_t week;
+  uint8_t weekday;
+  uint16_t day;
+  int32_t time;     // Seconds after local midnight, may be negative or past 24h
+};
+
+// A zone's standing rule, i.e. a parsed POSIX TZ string such as
+// "AEST-10AEDT,M10.1.0,M4.1.0/3". Offsets are seconds east of UTC.
+struct TZRule {
+  int32_t stdOffset;
+  int32_t dstOffset;
+  bool hasDST;
+  TZTransitionRule start;   // Local standard time
+  TZTransitionRule end;     // Local daylight time
+};
+
+// Compiled zone table entry (see include/tz_zones.h)
+struct TZZone {
+  const char* name;   // IANA name, e.g. "Europe/Berlin"
+  const char* rule;   // POSIX TZ string
+};
+
+// Parse a POSIX TZ string; false if it is malformed
+bool parseTZRule(const char* spec, TZRule& rule);
+
+// UTC instant at which a transition happens in the given year
+int64_t getTZTransitionTime(const TZTransitionRule& transition, int year, int32_t offset);
+
+// Binary search of the zone table by name; -1 if not found
+int findTimezone(const char* name);
+int getTimezoneCount();
+const TZZone& getTimezone(int index);
+
+#endif // TZ_RULES_H
@@ -0,0 +1,81 @@
+#ifndef TZ_ZONES_H
+#define TZ_ZONES_H
+
+// Generated by tools/tzcompile/makezones.sh - do not edit
+
+#include "tz_rules.h"
+
+// Sorted by name for findTimezone()
+const TZZone tzZones[] PROGMEM = {
+  {"Africa/Cairo", "EET-2EEST,M4.5.5/0,M10.5.4/24"},
+  {"Africa/Johannesburg", "SAST-2"},
+  {"Africa/Lagos", "WAT-1"},
+  {"Africa/Nairobi", "EAT-3"},
+  {"America/Anchorage", "AKST9AKDT,M3.2.0,M11.1.0"},
+  {"America/Argentina/Buenos_Aires", "<-03>3"},
+  {"America/Bogota", "<-05>5"},
+  {"America/Caracas", "<-04>4"},
+  {"America/Chicago", "CST6CDT,M3.2.0,M11.1.0"},
+  {"America/Denver", "MST7MDT,M3.2.0,M11.1.0"},
+  {"America/Halifax", "AST4ADT,M3.2.0,M11.1.0"},
+  {"America/Havana", "CST5CDT,M3.2.0/0,M11.1.0/1"},
+  {"America/Lima", "<-05>5"},
+  {"America/Los_Angeles", "PST8PDT,M3.2.0,M11.1.0"},
+  {"America/Mexico_City", "CST6"},
+  {"America/New_York", "EST5EDT,M3.2.0,M11.1.0"},
+  {"America/Nuuk", "<-02>2<-01>,M3.5.0/-1,M10.5.0/0"},
+  {"America/Phoenix", "MST7"},
+  {"America/Santiago", "<-04>4<-03>,M9.1.6/24,M4.1.6/24"},
+  {"America/Sao_Paulo", "<-03>3"},
+  {"America/St_Johns", "NST3:30NDT,M3.2.0,M11.1.0"},
+  {"America/Toronto", "EST5EDT,M3.2.0,M11.1.0"},
+  {"America/Vancouver", "PST8PDT,M3.2.0,M11.1.0"},
+  {"Asia/Bangkok", "<+07>-7"},
+  {"Asia/Dhaka", "<+06>-6"},
+  {"Asia/Dubai", "<+04>-4"},
+  {"Asia/Hong_Kong", "HKT-8"},
+  {"Asia/Jakarta", "WIB-7"},
+  {"Asia/Jerusalem", "IST-2IDT,M3.4.4/26,M10.5.0"},
+  {"Asia/Karachi", "PKT-5"},
+  {"Asia/Kathmandu", "<+0545>-5:45"},
+  {"Asia/Kolkata", "IST-5:30"},
+  {"Asia/Manila", "PST-8"},
+  {"Asia/Seoul", "KST-9"},
+  {"Asia/Shanghai", "CST-8"},
+  {"Asia/Singapore", "<+08>-8"},
+  {"Asia/Taipei", "CST-8"},
+  {"Asia/Tehran", "<+0330>-3:30"},
+  {"Asia/Tokyo", "JST-9"},
+  {"Asia/Yangon", "<+0630>-6:30"},
+  {"Atlantic/Azores", "<-01>1<+00>,M3.5.0/0,M10.5.0/1"},
+  {"Atlantic/Reykjavik", "GMT0"},
+  {"Australia/Adelaide", "ACST-9:30ACDT,M10.1.0,M4.1.0/3"},
+  {"Australia/Brisbane", "AEST-10"},
+  {"Australia/Darwin", "ACST-9:30"},
+  {"Australia/Lord_Howe", "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0"},
+  {"Australia/Perth", "AWST-8"},
+  {"Australia/Sydney", "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+  {"Europe/Amsterdam", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Athens", "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Berlin", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Dublin", "IST-1GMT0,M10.5.0,M3.5.0/1"},
+  {"Europe/Helsinki", "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Istanbul", "<+03>-3"},
+  {"Europe/Lisbon", "WET0WEST,M3.5.0/1,M10.5.0"},
+  {"Europe/London", "GMT0BST,M3.5.0/1,M10.5.0"},
+  {"Europe/Madrid", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Moscow", "MSK-3"},
+  {"Europe/Paris", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Rome", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Stockholm", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Warsaw", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Zurich", "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Pacific/Auckland", "NZST-12NZDT,M9.5.0,M4.1.0/3"},
+  {"Pacific/Chatham", "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45"},
+  {"Pacific/Honolulu", "HST10"},
+  {"UTC", "UTC0"},
+};
+
+const int tzZoneCount = sizeof(tzZones) / sizeof(tzZones[0]);
+
+#endif // TZ_ZONES_H
@@ -0,0 +1,81 @@
+#ifndef UI_WIDGETS_H
+#define UI_WIDGETS_H
+
+#include <Arduino.h>
+#include <Adafruit_ST7789.h>
+
+// Widget tree limits (fixed pool, no heap)
+const int UI_MAX_WIDGETS = 16;
+const int UI_TEXT_LENGTH = 40;  // Including null terminator
+
+// Widget types
+enum WidgetType {
+  WIDGET_TEXT,         // Label or value field (classic 6x8 font)
+  WIDGET_RULE,         // Horizontal separator line
+  WIDGET_SIGNAL_BARS,  // 4 bar RSSI indicator
+  WIDGET_LIST_ROW      // Text row with selection highlight
+};
+
+// Screens built on the widget tree
+enum UIScreenId {
+  UI_SCREEN_NONE,
+  UI_SCREEN_WIFI_NETWORK,
+  UI_SCREEN_PASSWORD,
+  UI_SCREEN_CLOCK,
+  UI_SCREEN_SETTINGS,
+  UI_SCREEN_WORDCLOCK
+};
+
+struct Widget {
+  WidgetType type;
+  int16_t x, y, w, h;
+  uint8_t textSize;
+  uint16_t color;
+  char text[UI_TEXT_LENGTH];
+  int32_t value;       // Signal bar count or list row selection
+  int16_t drawnWidth;  // Width of the text currently on screen
+  bool dirty;          // Needs to be drawn on the next render()
+};
+
+class WidgetTree {
+private:
+  Widget widgets[UI_MAX_WIDGETS];
+  uint8_t widgetCount;
+  UIScreenId screen;
+  uint16_t background;
+  bool fullRedraw;
+
+  // Widget helpers
+  int addWidget(WidgetType type, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawWidget(Adafruit_ST7789& tft, Widget& widget);
+  void drawText(Adafruit_ST7789& tft, Widget& widget, uint16_t color, uint16_t bg);
+
+public:
+  // Constructor
+  WidgetTree();
+
+  // Screen management
+  bool beginScreen(UIScreenId id, uint16_t bg = ST77XX_BLACK);  // true when the layout must be built
+  void invalidate();                                             // Screen was drawn over elsewhere
+  UIScreenId getScreen() const;
+
+  // Layout (call only when beginScreen() returns true)
+  int addText(int16_t x, int16_t y, uint8_t size, uint16_t color, const char* text = "");
+  int addRule(int16_t x, int16_t y, int16_t w, uint16_t color);
+  int addSignalBars(int16_t x, int16_t y);
+  int addListRow(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  // Value updates (mark the widget dirty only when something changed)
+  void setText(int id, const char* text);
+  void setColor(int id, uint16_t color);
+  void setSignal(int id, int32_t rssi);
+  void setSelected(int id, bool selected);
+
+  // Draw every dirty widget, returns the number drawn
+  int render(Adafruit_ST7789& tft);
+};
+
+// Global widget tree instance
+extern WidgetTree uiTree;
+
+#endif // UI_WIDGETS_H
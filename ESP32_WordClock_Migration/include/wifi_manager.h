@@ -23,6 +23,7 @@ struct WiFiNetworkInfo {
 // Function declarations
 void scanWiFiNetworks();
 WiFiNetworkInfo getCurrentNetworkInfo();
+WiFiNetworkInfo getNetworkInfo(int index);
 uint16_t getSignalStrength(int32_t rssi); // Returns 0-100 percentage
 const char* getEncryptionType(wifi_auth_mode_t encryptionType);
 
@@ -25,6 +25,15 @@
 #include "include/button_handler.h"
 #include "include/state_machine.h"
 #include "include/time_manager.h"
+#include "include/tick_scheduler.h"
+#include "include/event_loop.h"
+#include "include/logger.h"
+#include "include/perf_counters.h"
+#include "include/telemetry.h"
+#include "include/task_config.h"
+#include "include/matrix_renderer.h"
+#include "include/network_task.h"
+#include "include/rtc_clock.h"
 #include "include/settings_manager.h"
 #include "include/wordclock_manager.h"
 
@@ -39,6 +48,21 @@ const int BUTTON_C = 2;       // D2
 // NeoMatrix pin - connected to pin 6
 #define NEOPIN 6
 
+// Light sleep while idle. Saves power, but USB serial drops out while
+// asleep and buttons are polled every 50 ms instead of waking the loop.
+#define LIGHT_SLEEP 0
+
+// Binary telemetry frames mixed into the serial log from boot, for
+// tools/telemetry ('t' over serial toggles it at run time)
+#define TELEMETRY 0
+
+// Battery backed RTC on the STEMMA QT I2C port (RTC_CHIP_NONE if not fitted)
+#define RTC_CHIP RTC_CHIP_DS3231
+
+#ifdef NETWORK_STALL_TEST_MS
+void startNetworkStallTest();   // test/device/network_stall.cpp, added by compile.sh
+#endif
+
 // Global hardware objects
 Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
 Adafruit_NeoMatrix matrix = Adafruit_NeoMatrix(8, 8, NEOPIN,
@@ -49,9 +73,56 @@ Adafruit_NeoMatrix matrix = Adafruit_NeoMatrix(8, 8, NEOPIN,
 // State machine instance
 StateMachine stateMachine(tft, matrix);
 
+// Set when light sleep could be enabled
+bool lightSleep = false;
+
+// Serial commands: 'p' dumps the timing counters, 'r' resets them,
+// 't' toggles the telemetry stream
+static void serviceSerialCommands() {
+  while (Serial.available() > 0) {
+    switch (Serial.read()) {
+      case 'p':
+        perfCounters.dump();
+        break;
+      case 'r':
+        perfCounters.reset();
+        LOG_INFO("[PERF] Reset");
+        break;
+      case 't':
+        telemetry.setEnabled(!telemetry.isEnabled());
+        LOG_INFO("[TELEMETRY] %s", telemetry.isEnabled() ? "On" : "Off");
+        break;
+      default:
+        break;
+    }
+  }
+}
+
 void setup() {
   Serial.begin(115200);
-  delay(1000);
+  
+  // Module logs are printed by the log task from here on
+  logger.begin();
+  telemetry.setEnabled(TELEMETRY);
+  
+  // Timers, interrupts and modules post to this from here on
+  eventLoop.begin();
+  
+  // This task becomes the UI task: above the network task, below the renderer
+  vTaskPrioritySet(NULL, UI_TASK_PRIORITY);
+  
+  // Saved zone, DST and brightness, before any screen shows the time: a
+  // warm start or an RTC boot goes to the clock without the WiFi screens
+  if (!settingsManager.initialize()) {
+    LOG_WARN("[SETUP] Failed to initialize settings, using defaults");
+  }
+  
+  // After a reset the time saved in RTC memory is shown straight away;
+  // only a cold start waits for the serial monitor and plays the intro
+  bool warmStart = timeManager.restoreRetainedTime();
+  if (!warmStart) {
+    delay(1000);
+  }
   
   Serial.println("ESP32-S2 WordClock Migration - State Machine");
   Serial.println("============================================");
@@ -62,61 +133,101 @@ void setup() {
   Serial.print(" ");
   Serial.println(BUILD_TIME);
   Serial.println("Features: Logo display, WiFi scan, State machine");
-  Serial.println("DEBUG: Setup started");
   Serial.flush();
+  LOG_DEBUG("[SETUP] Setup started");
   
   // Initialize hardware
-  Serial.println("DEBUG: About to initialize buttons");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] About to initialize buttons");
   initializeButtons();
-  Serial.println("DEBUG: Buttons initialized successfully");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] Buttons initialized successfully");
   
-  Serial.println("DEBUG: About to initialize unused pins");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] About to initialize unused pins");
   initializeUnusedPins();
-  Serial.println("DEBUG: Unused pins initialized successfully");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] Unused pins initialized successfully");
   
-  Serial.println("DEBUG: About to initialize display");
-  Serial.flush();
+  // Clock tick timer, wakes loop() on wall clock boundaries
+  tickScheduler.begin();
+  
+  if (LIGHT_SLEEP) {
+    lightSleep = eventLoop.enableLightSleep();
+  }
+  
+  // Holdover time from the RTC, valid before WiFi and NTP
+  rtcClock.begin(RTC_CHIP);
+  
+  LOG_DEBUG("[SETUP] About to initialize display");
   initializeDisplay(tft, matrix);
-  Serial.println("DEBUG: Display initialized successfully");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] Display initialized successfully");
   
-  // Show WordClock startup sequence with rainbow cycle
-  Serial.println("DEBUG: Starting WordClock startup sequence...");
-  Serial.flush();
-  showWordClockStartup(matrix);
-  Serial.println("DEBUG: WordClock startup sequence completed");
-  Serial.flush();
+  // The matrix belongs to the render task from here on
+  matrixRenderer.begin(matrix);
+  
+  // Show WordClock startup sequence with rainbow cycle, while setup goes on
+  if (!warmStart) {
+    matrixRenderer.showIntro();
+  }
   
   // Initialize WiFi
-  Serial.println("DEBUG: About to initialize WiFi");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] About to initialize WiFi");
   WiFi.mode(WIFI_STA);
-  Serial.println("DEBUG: WiFi mode set to STA");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] WiFi mode set to STA");
   
   WiFi.disconnect();
-  Serial.println("DEBUG: WiFi disconnected");
-  Serial.flush();
+  LOG_DEBUG("[SETUP] WiFi disconnected");
+  
+  // Rejoin the last network (kept by the WiFi driver) so the restored
+  // time is corrected by NTP without going through the WiFi screens
+  if (warmStart) {
+    WiFi.begin();
+  }
   
   delay(100);
-  Serial.println("DEBUG: WiFi initialization complete");
-  Serial.flush();
   
-  // State machine will handle logo display automatically
-  Serial.println("DEBUG: Setup complete - entering main loop");
-  Serial.println("DEBUG: Logo will be displayed by state machine for 4 seconds");
-  Serial.printf("[SETUP_COMPLETE] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  Serial.flush();
+  // Scans and connections run here, off the UI task
+  networkTask.begin();
+#ifdef NETWORK_STALL_TEST_MS
+  startNetworkStallTest();  // Render jitter check
+#endif
+  LOG_DEBUG("[SETUP] WiFi initialization complete");
+  
+  // Enter the first state: the logo, or the clock on a warm start
+  stateMachine.begin();
+  LOG_DEBUG("[SETUP] Setup complete - entering main loop");
+  LOG_INFO("[SETUP_COMPLETE] Free Heap: %d, Min Free: %d", ESP.getFreeHeap(), ESP.getMinFreeHeap());
 }
 
 void loop() {
+  // Block until the next event: a clock tick, a button, a finished sync
+  // or a frame. Poll only while something can't post events: an NTP
+  // reply or the RTC's seconds rollover being timed (every 2 ms), and the
+  // buttons in light sleep (every 50 ms). A held or bouncing button
+  // wakes the loop when its next gesture can be decided.
+  uint32_t timeout = EVENT_WAIT_MAX_MS;
+  if (timeManager.isSyncing() || rtcClock.isMeasuring()) {
+    timeout = 2;
+  } else if (lightSleep) {
+    timeout = 50;
+  }
+  timeout = min(timeout, buttonWaitMs());
+  uint32_t events = eventLoop.wait(timeout);
+  
+  // Pin interrupts don't wake light sleep: read the buttons every pass
+  if (lightSleep) {
+    pollButtons();
+  }
+  
   // Update the state machine
-  stateMachine.update();
+  stateMachine.update(events);
+  
+  // Correct the RTC from NTP time
+  rtcClock.update();
+  
+  // Keep the time in RTC memory current for a fast restart
+  timeManager.retainTime();
+  
+  // Heap, render and probe summaries when streaming
+  telemetry.update();
   
-  delay(50); // Small delay to prevent excessive CPU usage
+  // Timing dump and telemetry toggle on request
+  serviceSerialCommands();
 }
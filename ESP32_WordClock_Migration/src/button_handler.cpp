@@ -1,11 +1,75 @@
 #include "../include/button_handler.h"
+#include "../include/event_loop.h"
+#include "../include/monotonic_clock.h"
+#include "../include/logger.h"
 
-// Button state tracking
-bool buttonA_pressed = false;
-bool buttonB_pressed = false;
-bool buttonC_pressed = false;
-unsigned long lastButtonPress = 0;
-const unsigned long DEBOUNCE_DELAY = 200;
+// Gesture timing, per button
+#define DEBOUNCE_MS 25          // A level counts once it has held this long
+#define LONG_PRESS_MS 600
+#define REPEAT_MS 150           // While held after a long press
+#define DOUBLE_PRESS_MS 300     // Between the releases of two short presses
+
+#define EDGE_RING_SIZE 32       // Power of two
+#define EVENT_RING_SIZE 8
+
+// Raw edge from a pin interrupt
+struct ButtonEdge {
+  uint64_t timeUs;
+  uint8_t button;
+  uint8_t pressed;
+};
+
+// Single producer (the pin interrupts, which don't nest) and single
+// consumer (the loop): the producer only moves edgeHead, the consumer
+// only edgeTail, so neither side takes a lock
+static DRAM_ATTR ButtonEdge edgeRing[EDGE_RING_SIZE];
+static volatile uint32_t edgeHead = 0;
+static volatile uint32_t edgeTail = 0;
+static volatile uint32_t edgeOverflows = 0;
+static portMUX_TYPE buttonLock = portMUX_INITIALIZER_UNLOCKED;  // pollButtons() only
+
+static DRAM_ATTR int buttonPins[BUTTON_COUNT];
+static DRAM_ATTR uint8_t activeLevel[BUTTON_COUNT] = {LOW, HIGH, HIGH};  // D0 pulled up, D1/D2 pulled down
+
+// Debounce and gesture state, loop side only
+struct ButtonState {
+  bool raw;                 // Level after the last edge
+  uint64_t rawUs;           // ... and when it happened
+  bool pressed;             // Debounced level
+  uint64_t pressUs;         // Start of the debounced press
+  bool longSent;            // LONG reported for this press
+  uint64_t nextRepeatUs;
+  uint64_t lastShortUs;     // Release of a short press waiting for a double, 0 if none
+};
+static ButtonState buttons[BUTTON_COUNT];
+
+// Decoded events waiting for nextButtonEvent()
+static ButtonEvent eventRing[EVENT_RING_SIZE];
+static uint8_t eventHead = 0;
+static uint8_t eventTail = 0;
+
+static const char* const buttonNames[BUTTON_COUNT] = {"A", "B", "C"};
+static const char* const gestureNames[] = {"short", "double", "long", "repeat"};
+
+void IRAM_ATTR recordButtonEdge(uint8_t button, bool pressed, uint64_t timeUs) {
+  uint32_t head = edgeHead;
+  if (head - edgeTail >= EDGE_RING_SIZE) {
+    edgeOverflows++;
+    return;
+  }
+  ButtonEdge& edge = edgeRing[head & (EDGE_RING_SIZE - 1)];
+  edge.timeUs = timeUs;
+  edge.button = button;
+  edge.pressed = pressed;
+  edgeHead = head + 1;  // Publish only once the slot is written
+}
+
+// Capture the edge with its time; decoding waits for the loop
+static void IRAM_ATTR onButtonChange(void* arg) {
+  uint8_t button = (uint8_t)(uintptr_t)arg;
+  recordButtonEdge(button, digitalRead(buttonPins[button]) == activeLevel[button], monotonicMicros());
+  eventLoop.postFromISR(EVENT_BUTTON);
+}
 
 void initializeButtons() {
   // Initialize buttons
@@ -13,11 +77,24 @@ void initializeButtons() {
   pinMode(BUTTON_B, INPUT);         // D1: pulled LOW by hardware, goes HIGH when pressed
   pinMode(BUTTON_C, INPUT);         // D2: pulled LOW by hardware, goes HIGH when pressed
   
-  Serial.println("Buttons initialized");
+  buttonPins[BUTTON_ID_A] = BUTTON_A;
+  buttonPins[BUTTON_ID_B] = BUTTON_B;
+  buttonPins[BUTTON_ID_C] = BUTTON_C;
+  
+  // A button held through reset counts as pressed from now
+  uint64_t nowUs = monotonicMicros();
+  for (uint8_t b = 0; b < BUTTON_COUNT; b++) {
+    memset(&buttons[b], 0, sizeof(buttons[b]));
+    buttons[b].raw = digitalRead(buttonPins[b]) == activeLevel[b];
+    buttons[b].rawUs = nowUs;
+    attachInterruptArg(digitalPinToInterrupt(buttonPins[b]), onButtonChange, (void*)(uintptr_t)b, CHANGE);
+  }
+  
+  LOG_INFO("Buttons initialized");
 }
 
 void initializeUnusedPins() {
-  Serial.println("Initializing specific pin headers with pull-down resistors...");
+  LOG_DEBUG("Initializing specific pin headers with pull-down resistors...");
   
   // Conservative approach: Only initialize specific pins that are exposed as headers
   // and causing false button detections when touched
@@ -25,90 +102,181 @@ void initializeUnusedPins() {
   // Analog pins A0-A5 (these are exposed as pin headers)
   // A0, A1 are DAC outputs (ADC2), A2-A4 are ADC2, A5 is ADC1
   pinMode(A0, INPUT_PULLDOWN);
-  Serial.printf("Pin A0 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin A0 set to INPUT_PULLDOWN");
   
   pinMode(A1, INPUT_PULLDOWN);
-  Serial.printf("Pin A1 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin A1 set to INPUT_PULLDOWN");
   
   pinMode(A2, INPUT_PULLDOWN);
-  Serial.printf("Pin A2 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin A2 set to INPUT_PULLDOWN");
   
   pinMode(A3, INPUT_PULLDOWN);
-  Serial.printf("Pin A3 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin A3 set to INPUT_PULLDOWN");
   
   pinMode(A4, INPUT_PULLDOWN);
-  Serial.printf("Pin A4 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin A4 set to INPUT_PULLDOWN");
   
   pinMode(A5, INPUT_PULLDOWN);
-  Serial.printf("Pin A5 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin A5 set to INPUT_PULLDOWN");
   
   // Digital pins 5, 9-13 (these are exposed as pin headers)
   pinMode(5, INPUT_PULLDOWN);
-  Serial.printf("Pin 5 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin 5 set to INPUT_PULLDOWN");
   
   pinMode(9, INPUT_PULLDOWN);
-  Serial.printf("Pin 9 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin 9 set to INPUT_PULLDOWN");
   
   pinMode(10, INPUT_PULLDOWN);
-  Serial.printf("Pin 10 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin 10 set to INPUT_PULLDOWN");
   
   pinMode(11, INPUT_PULLDOWN);
-  Serial.printf("Pin 11 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin 11 set to INPUT_PULLDOWN");
   
   pinMode(12, INPUT_PULLDOWN);
-  Serial.printf("Pin 12 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin 12 set to INPUT_PULLDOWN");
   
   pinMode(13, INPUT_PULLDOWN);
-  Serial.printf("Pin 13 set to INPUT_PULLDOWN\n");
+  LOG_DEBUG("Pin 13 set to INPUT_PULLDOWN");
   
-  Serial.println("Specific pin headers initialized with pull-down resistors");
+  LOG_INFO("Specific pin headers initialized with pull-down resistors");
 }
 
-ButtonEvent handleButtons() {
-  unsigned long currentTime = millis();
-  
-  // Debug: Print button states every 2 seconds
-  static unsigned long lastDebug = 0;
-  if (currentTime - lastDebug > 2000) {
-    Serial.printf("Button states - D0:%d D1:%d D2:%d\n", 
-                  digitalRead(BUTTON_A), digitalRead(BUTTON_B), digitalRead(BUTTON_C));
-    lastDebug = currentTime;
+void pollButtons() {
+  uint64_t nowUs = monotonicMicros();
+  for (uint8_t b = 0; b < BUTTON_COUNT; b++) {
+    bool pressed = digitalRead(buttonPins[b]) == activeLevel[b];
+    
+    // Compare with the newest recorded level, queued or not. The
+    // interrupts may be producing too: keep them out meanwhile.
+    portENTER_CRITICAL(&buttonLock);
+    bool last = buttons[b].raw;
+    for (uint32_t i = edgeTail; i != edgeHead; i++) {
+      const ButtonEdge& edge = edgeRing[i & (EDGE_RING_SIZE - 1)];
+      if (edge.button == b) {
+        last = edge.pressed;
+      }
+    }
+    if (pressed != last) {
+      recordButtonEdge(b, pressed, nowUs);
+    }
+    portEXIT_CRITICAL(&buttonLock);
   }
-  
-  // Debounce check
-  if (currentTime - lastButtonPress < DEBOUNCE_DELAY) {
-    return NO_BUTTON;
+}
+
+static void queueEvent(uint8_t button, uint8_t gesture, uint64_t timeUs) {
+  if ((uint8_t)(eventHead - eventTail) >= EVENT_RING_SIZE) {
+    return;  // Nobody reads them: drop
+  }
+  ButtonEvent& event = eventRing[eventHead % EVENT_RING_SIZE];
+  event.button = button;
+  event.gesture = gesture;
+  event.timeUs = timeUs;
+  eventHead++;
+  LOG_INFO("[BUTTONS] %s %s", buttonNames[button], gestureNames[gesture]);
+}
+
+// The debounced level changes, as of the edge that started it
+static void settle(uint8_t b, bool pressed, uint64_t timeUs) {
+  ButtonState& s = buttons[b];
+  s.pressed = pressed;
+  if (pressed) {
+    s.pressUs = timeUs;
+    s.longSent = false;
+    return;
   }
   
-  // Button A / D0 (Down/Next)
-  if (digitalRead(BUTTON_A) == LOW && !buttonA_pressed) {
-    buttonA_pressed = true;
-    lastButtonPress = currentTime;
-    Serial.printf("Button D0: Next network\n");
-    return BUTTON_A_PRESSED;
-  } else if (digitalRead(BUTTON_A) == HIGH) {
-    buttonA_pressed = false;
+  if (s.longSent) {
+    return;  // A long press ends quietly
+  }
+  queueEvent(b, GESTURE_SHORT, timeUs);
+  if (s.lastShortUs != 0 && timeUs - s.lastShortUs <= DOUBLE_PRESS_MS * 1000ULL) {
+    queueEvent(b, GESTURE_DOUBLE, timeUs);
+    s.lastShortUs = 0;
+  } else {
+    s.lastShortUs = timeUs;
+  }
+}
+
+// Decide whatever has come due for a button by nowUs
+static void serviceButton(uint8_t b, uint64_t nowUs) {
+  ButtonState& s = buttons[b];
+  if (s.raw != s.pressed && nowUs - s.rawUs >= DEBOUNCE_MS * 1000ULL) {
+    settle(b, s.raw, s.rawUs);
+  }
+  if (!s.pressed) {
+    return;
   }
   
-  // Button B / D1 (Up/Previous) - D1 goes HIGH when pressed
-  if (digitalRead(BUTTON_B) == HIGH && !buttonB_pressed) {
-    buttonB_pressed = true;
-    lastButtonPress = currentTime;
-    Serial.printf("Button D1: Previous network\n");
-    return BUTTON_B_PRESSED;
-  } else if (digitalRead(BUTTON_B) == LOW) {
-    buttonB_pressed = false;
+  if (!s.longSent && nowUs - s.pressUs >= LONG_PRESS_MS * 1000ULL) {
+    s.longSent = true;
+    s.nextRepeatUs = s.pressUs + (LONG_PRESS_MS + REPEAT_MS) * 1000ULL;
+    queueEvent(b, GESTURE_LONG, s.pressUs + LONG_PRESS_MS * 1000ULL);
+  }
+  if (s.longSent && nowUs >= s.nextRepeatUs) {
+    queueEvent(b, GESTURE_REPEAT, nowUs);
+    // One repeat per due period; a late loop doesn't get a burst
+    s.nextRepeatUs += REPEAT_MS * 1000ULL;
+    if (s.nextRepeatUs <= nowUs) {
+      s.nextRepeatUs = nowUs + REPEAT_MS * 1000ULL;
+    }
+  }
+}
+
+// Edges in order, each checked against the level held before it, so a
+// press is timed by its edges however late the loop runs
+static void decodeButtons(uint64_t nowUs) {
+  while (edgeTail != edgeHead) {
+    ButtonEdge edge = edgeRing[edgeTail & (EDGE_RING_SIZE - 1)];
+    edgeTail = edgeTail + 1;
+    if (edge.button >= BUTTON_COUNT) continue;
+    
+    serviceButton(edge.button, edge.timeUs);
+    buttons[edge.button].raw = edge.pressed;
+    buttons[edge.button].rawUs = edge.timeUs;
+  }
+  for (uint8_t b = 0; b < BUTTON_COUNT; b++) {
+    serviceButton(b, nowUs);
+  }
+}
+
+bool nextButtonEvent(ButtonEvent& event) {
+  if (eventHead == eventTail) {
+    decodeButtons(monotonicMicros());
+  }
+  if (eventHead == eventTail) {
+    return false;
+  }
+  event = eventRing[eventTail % EVENT_RING_SIZE];
+  eventTail++;
+  return true;
+}
+
+uint32_t buttonWaitMs() {
+  if (edgeHead != edgeTail || eventHead != eventTail) {
+    return 0;
   }
   
-  // Button C / D2 (Rescan) - D2 goes HIGH when pressed
-  if (digitalRead(BUTTON_C) == HIGH && !buttonC_pressed) {
-    buttonC_pressed = true;
-    lastButtonPress = currentTime;
-    Serial.println("Button D2: Rescanning WiFi networks");
-    return BUTTON_C_PRESSED;
-  } else if (digitalRead(BUTTON_C) == LOW) {
-    buttonC_pressed = false;
+  uint64_t dueUs = UINT64_MAX;
+  for (uint8_t b = 0; b < BUTTON_COUNT; b++) {
+    const ButtonState& s = buttons[b];
+    uint64_t buttonDueUs = UINT64_MAX;
+    if (s.raw != s.pressed) {
+      buttonDueUs = s.rawUs + DEBOUNCE_MS * 1000ULL;
+    } else if (s.pressed) {
+      buttonDueUs = s.longSent ? s.nextRepeatUs : s.pressUs + LONG_PRESS_MS * 1000ULL;
+    }
+    if (buttonDueUs < dueUs) {
+      dueUs = buttonDueUs;
+    }
+  }
+  if (dueUs == UINT64_MAX) {
+    return EVENT_WAIT_MAX_MS;
   }
   
-  return NO_BUTTON;
+  uint64_t nowUs = monotonicMicros();
+  return dueUs <= nowUs ? 0 : (uint32_t)((dueUs - nowUs + 999) / 1000);
+}
+
+uint32_t getButtonOverflows() {
+  return edgeOverflows;
 }
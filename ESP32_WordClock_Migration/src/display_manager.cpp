@@ -1,44 +1,63 @@
 #include "../include/display_manager.h"
 #include "../include/version.h"
+#include "../include/ui_widgets.h"
+#include "../include/static_string.h"
+#include "../include/rle_image.h"
+#include "../include/assets.h"
+#include "../include/matrix_renderer.h"
+#include "../include/perf_counters.h"
+#include "../include/logger.h"
 #include <SPI.h>
 
+// Copy text into out, ending in "..." when it is longer than out can hold
+static void fitText(StringBuffer& out, const char* text) {
+  out = text;
+  if (strlen(text) > out.maxLength()) {
+    out = "";
+    for (size_t i = 0; i < out.maxLength() - 3; i++) {
+      out.append(text[i]);
+    }
+    out.append("...");
+  }
+}
+
 // TFT Display pins are predefined by ESP32-S2 Reverse TFT Feather board variant
 // No extern declarations needed - using board's built-in pin definitions
 
 void initializeDisplay(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix) {
   // Initialize TFT backlight
-  Serial.println("Initializing TFT backlight...");
+  LOG_DEBUG("Initializing TFT backlight...");
   pinMode(TFT_BACKLITE, OUTPUT);
   digitalWrite(TFT_BACKLITE, HIGH); // Turn on backlight
   
   // Initialize SPI for TFT display (use default SPI pins for ESP32-S2)
-  Serial.println("Initializing SPI...");
+  LOG_DEBUG("Initializing SPI...");
   SPI.begin();
   
   // Initialize TFT display
-  Serial.println("Initializing TFT display...");
+  LOG_DEBUG("Initializing TFT display...");
   tft.init(135, 240); // 135x240 pixels
   tft.setRotation(3); // Landscape mode (240x135)
   
-  Serial.println("Clearing TFT screen...");
+  LOG_DEBUG("Clearing TFT screen...");
   clearTFTScreen(tft);
   
   // Test display with a simple pattern
-  Serial.println("Testing TFT display...");
+  LOG_DEBUG("Testing TFT display...");
   tft.fillRect(0, 0, 240, 10, ST77XX_RED);    // Red bar at top
   tft.fillRect(0, 125, 240, 10, ST77XX_BLUE); // Blue bar at bottom
   delay(1000);
   clearTFTScreen(tft);
   
   // Initialize NeoMatrix (matching working test configuration)
-  Serial.println("Initializing NeoMatrix...");
+  LOG_DEBUG("Initializing NeoMatrix...");
   matrix.begin();
   matrix.setBrightness(50); // Use same brightness as working test
   matrix.fillScreen(0); // Clear all pixels
   matrix.show();
   
   // Test the matrix with a comprehensive test pattern
-  Serial.println("Testing NeoMatrix with comprehensive test...");
+  LOG_DEBUG("Testing NeoMatrix with comprehensive test...");
   
   // Test 1: Single pixels
   matrix.drawPixel(0, 0, matrix.Color(255, 0, 0)); // Red pixel at (0,0)
@@ -67,10 +86,11 @@ void initializeDisplay(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix) {
   matrix.fillScreen(0);
   matrix.show();
   
-  Serial.println("Display initialization complete");
+  LOG_INFO("Display initialization complete");
 }
 
 void displayStartupMessage(Adafruit_ST7789& tft) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen first to remove clock logo
   clearTFTScreen(tft);
   
@@ -91,6 +111,7 @@ void displayStartupMessage(Adafruit_ST7789& tft) {
 }
 
 void displayClockLogo(Adafruit_ST7789& tft) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen
   clearTFTScreen(tft);
   
@@ -100,36 +121,8 @@ void displayClockLogo(Adafruit_ST7789& tft) {
   tft.setCursor(30, 15);
   tft.println("ESP32 WordClock");
   
-  // Draw clock face (centered at 120, 67)
-  int centerX = 120;
-  int centerY = 67;
-  int radius = 30;
-  
-  // Draw outer circle
-  tft.drawCircle(centerX, centerY, radius, ST77XX_WHITE);
-  tft.drawCircle(centerX, centerY, radius-1, ST77XX_WHITE);
-  
-  // Draw hour markers (12, 3, 6, 9)
-  for (int i = 0; i < 4; i++) {
-    float angle = i * PI / 2 - PI / 2; // Start at 12 o'clock
-    int x1 = centerX + (radius - 5) * cos(angle);
-    int y1 = centerY + (radius - 5) * sin(angle);
-    int x2 = centerX + (radius - 2) * cos(angle);
-    int y2 = centerY + (radius - 2) * sin(angle);
-    tft.drawLine(x1, y1, x2, y2, ST77XX_WHITE);
-  }
-  
-  // Draw clock hands pointing to 12:00
-  // Hour hand (shorter, thicker)
-  tft.drawLine(centerX, centerY, centerX, centerY - 15, ST77XX_WHITE);
-  tft.drawLine(centerX-1, centerY, centerX-1, centerY - 15, ST77XX_WHITE);
-  tft.drawLine(centerX+1, centerY, centerX+1, centerY - 15, ST77XX_WHITE);
-  
-  // Minute hand (longer, thinner)
-  tft.drawLine(centerX, centerY, centerX, centerY - 25, ST77XX_WHITE);
-  
-  // Center dot
-  tft.fillCircle(centerX, centerY, 2, ST77XX_WHITE);
+  // Draw clock face (61x61 image centered at 120, 67), one burst write
+  drawRLEImage(tft, 120 - clockLogo.width / 2, 67 - clockLogo.height / 2, clockLogo);
   
   // Display version information
   tft.setTextSize(1);
@@ -152,121 +145,69 @@ void showStartupPattern(Adafruit_NeoMatrix& matrix) {
   matrix.show();
 }
 
-void drawSignalBars(Adafruit_ST7789& tft, int32_t rssi, int x, int y) {
-  // Draw 4 signal strength bars
+int getSignalBarCount(int32_t rssi) {
   int bars = 0;
   if (rssi > -80) bars = 1;
   if (rssi > -70) bars = 2;
   if (rssi > -60) bars = 3;
   if (rssi > -50) bars = 4;
-  
-  for (int i = 0; i < 4; i++) {
-    uint16_t color = (i < bars) ? ST77XX_GREEN : ST77XX_RED;
-    int barHeight = (i + 1) * 3;
-    tft.fillRect(x + i * 8, y + 12 - barHeight, 6, barHeight, color);
-  }
+  return bars;
 }
 
-void displayCurrentNetwork(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, const WiFiNetworkInfo& networkInfo, int currentIndex, int totalNetworks) {
-  // Clear screen first to remove previous content
-  clearTFTScreen(tft);
-  
-  // Display header
-  tft.setTextColor(ST77XX_WHITE);
-  tft.setTextSize(2);
-  tft.setCursor(10, 10);
-  tft.println("WiFi Networks");
-  
-  // Draw separator line
-  tft.drawLine(10, 35, 230, 35, ST77XX_BLUE);
-  
-  // Display current network info
-  tft.setTextSize(1);
-  tft.setCursor(10, 45);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("SSID: ");
-  tft.setTextColor(ST77XX_WHITE);
-  
-  // Safely truncate SSID if too long (max ~25 chars for 240px width)
-  char displaySSID[26]; // Fixed size buffer to prevent heap issues
-  if (networkInfo.ssid.length() > 25) {
-    strncpy(displaySSID, networkInfo.ssid.c_str(), 22);
-    displaySSID[22] = '.';
-    displaySSID[23] = '.';
-    displaySSID[24] = '.';
-    displaySSID[25] = '\0';
-  } else {
-    strncpy(displaySSID, networkInfo.ssid.c_str(), 25);
-    displaySSID[25] = '\0';
+void drawSignalBars(Adafruit_ST7789& tft, int32_t rssi, int x, int y) {
+  // Draw 4 signal strength bars (30x12 prerendered icon per bar count)
+  drawRLEImage(tft, x, y, *signalBarImages[getSignalBarCount(rssi)]);
+}
+
+void displayNetworkList(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, int selectedIndex, int totalNetworks) {
+  PERF_SCOPE(PERF_TFT_DRAW);
+  // Widget ids for this screen, assigned when the layout is built.
+  // 11px rows fit all MAX_NETWORKS between the header and the footer.
+  static int countField;
+  static int rows[MAX_NETWORKS];
+  
+  if (uiTree.beginScreen(UI_SCREEN_WIFI_NETWORK)) {
+    uiTree.addText(10, 2, 1, ST77XX_WHITE, "WiFi Networks");
+    countField = uiTree.addText(100, 2, 1, 0x7BEF); // Light gray color (RGB565 format)
+    uiTree.addRule(8, 12, 224, ST77XX_BLUE);
+    for (int i = 0; i < MAX_NETWORKS; i++) {
+      rows[i] = uiTree.addListRow(8, 14 + (i * 11), 224, 11, ST77XX_WHITE);
+    }
+    uiTree.addText(10, 126, 1, ST77XX_CYAN, "A: Next  B: Select  C: Rescan");
   }
-  tft.println(displaySSID);
-  
-  // Display signal strength
-  tft.setCursor(10, 60);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("Signal: ");
-  tft.setTextColor(ST77XX_WHITE);
-  tft.print(networkInfo.rssi);
-  tft.print(" dBm");
-  
-  // Draw signal bars
-  drawSignalBars(tft, networkInfo.rssi, 150, 60);
-  
-  // Display encryption type
-  tft.setCursor(10, 75);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("Security: ");
-  tft.setTextColor(ST77XX_WHITE);
   
-  // Convert encryption type to readable string (using const char* to avoid String operations)
-  const char* encType;
-  uint16_t encColor;
-  switch (networkInfo.encryption) {
-    case WIFI_AUTH_OPEN:
-      encType = "Open";
-      encColor = ST77XX_RED;
-      break;
-    case WIFI_AUTH_WEP:
-      encType = "WEP";
-      encColor = ST77XX_YELLOW;
-      break;
-    case WIFI_AUTH_WPA_PSK:
-      encType = "WPA";
-      encColor = ST77XX_GREEN;
-      break;
-    case WIFI_AUTH_WPA2_PSK:
-      encType = "WPA2";
-      encColor = ST77XX_GREEN;
-      break;
-    case WIFI_AUTH_WPA_WPA2_PSK:
-      encType = "WPA/WPA2";
-      encColor = ST77XX_GREEN;
-      break;
-    case WIFI_AUTH_WPA2_ENTERPRISE:
-      encType = "WPA2-ENT";
-      encColor = ST77XX_GREEN;
-      break;
-    default:
-      encType = "Unknown";
-      encColor = ST77XX_WHITE;
-      break;
+  char countText[16];
+  snprintf(countText, sizeof(countText), "%d found", totalNetworks);
+  uiTree.setText(countField, countText);
+  
+  // Update every row; only rows whose text or highlight changed are redrawn,
+  // so moving the selection repaints just the old and new rows
+  for (int i = 0; i < MAX_NETWORKS; i++) {
+    if (i < totalNetworks) {
+      WiFiNetworkInfo networkInfo = getNetworkInfo(i);
+      
+      // Safely truncate SSID so SSID, RSSI and security fit on one row
+      StaticString<22> displaySSID; // Fixed size buffer to prevent heap issues
+      fitText(displaySSID, networkInfo.ssid.c_str());
+      StaticString<UI_TEXT_LENGTH> rowText;
+      rowText.printf("%-21s %4d %s", displaySSID.c_str(), (int)networkInfo.rssi, getEncryptionType(networkInfo.encryption));
+      uiTree.setText(rows[i], rowText.c_str());
+      
+      // Flag open and WEP networks in the list
+      if (networkInfo.encryption == WIFI_AUTH_OPEN) {
+        uiTree.setColor(rows[i], ST77XX_RED);
+      } else if (networkInfo.encryption == WIFI_AUTH_WEP) {
+        uiTree.setColor(rows[i], ST77XX_YELLOW);
+      } else {
+        uiTree.setColor(rows[i], ST77XX_WHITE);
+      }
+    } else {
+      uiTree.setText(rows[i], "");
+    }
+    uiTree.setSelected(rows[i], i == selectedIndex);
   }
-  tft.setTextColor(encColor);
-  tft.println(encType);
-  
-  // Display navigation instructions
-  tft.setTextColor(ST77XX_CYAN);
-  tft.setTextSize(1);
-  tft.setCursor(10, 100);
-  tft.println("A: Next  B: Select  C: Rescan");
   
-  // Display network count info using passed parameters
-  tft.setCursor(10, 115);
-  tft.setTextColor(0x7BEF); // Light gray color (RGB565 format)
-  tft.print("Network ");
-  tft.print(currentIndex + 1);
-  tft.print(" of ");
-  tft.println(totalNetworks);
+  uiTree.render(tft);
   
   // Skip NeoMatrix operations for now since we're focusing on TFT stability
   // clearNeoMatrix(matrix);
@@ -274,86 +215,59 @@ void displayCurrentNetwork(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, con
 
 // Display clearing functions
 void clearTFTScreen(Adafruit_ST7789& tft, uint16_t color) {
+  PERF_COUNT(PERF_COUNT_TFT_CLEARS);
   tft.fillScreen(color);
+  uiTree.invalidate(); // Widget screens must rebuild after an imperative one
 }
 
 void clearNeoMatrix(Adafruit_NeoMatrix& matrix) {
   matrix.fillScreen(0);
+  PERF_SCOPE(PERF_MATRIX_SHOW);
   matrix.show();
 }
 
-void displayPasswordEntry(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, const String& ssid, const String& maskedPassword, char currentChar) {
-  // Clear screen first
-  clearTFTScreen(tft);
-  
-  // Display header
-  tft.setTextColor(ST77XX_WHITE);
-  tft.setTextSize(2);
-  tft.setCursor(10, 10);
-  tft.println("Enter Password");
-  
-  // Draw separator line
-  tft.drawLine(10, 35, 230, 35, ST77XX_BLUE);
-  
-  // Display selected network SSID
-  tft.setTextSize(1);
-  tft.setCursor(10, 45);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("Network: ");
-  tft.setTextColor(ST77XX_WHITE);
-  
-  // Safely truncate SSID if too long (using fixed buffer to prevent heap issues)
-  char displaySSID[21]; // Fixed size buffer for max 20 chars + null terminator
-  if (ssid.length() > 20) {
-    strncpy(displaySSID, ssid.c_str(), 17);
-    displaySSID[17] = '.';
-    displaySSID[18] = '.';
-    displaySSID[19] = '.';
-    displaySSID[20] = '\0';
-  } else {
-    strncpy(displaySSID, ssid.c_str(), 20);
-    displaySSID[20] = '\0';
+void displayPasswordEntry(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, const char* ssid, const char* maskedPassword, char currentChar) {
+  PERF_SCOPE(PERF_TFT_DRAW);
+  // Widget ids for this screen, assigned when the layout is built
+  static int networkField, passwordField, currentField;
+  
+  if (uiTree.beginScreen(UI_SCREEN_PASSWORD)) {
+    uiTree.addText(10, 10, 2, ST77XX_WHITE, "Enter Password");
+    uiTree.addRule(10, 35, 221, ST77XX_BLUE);
+    uiTree.addText(10, 45, 1, ST77XX_YELLOW, "Network: ");
+    networkField = uiTree.addText(64, 45, 1, ST77XX_WHITE);
+    uiTree.addText(10, 60, 1, ST77XX_YELLOW, "Password: ");
+    passwordField = uiTree.addText(70, 60, 1, ST77XX_WHITE);
+    uiTree.addText(10, 75, 1, ST77XX_YELLOW, "Current: ");
+    currentField = uiTree.addText(64, 75, 2, ST77XX_GREEN);
+    uiTree.addText(10, 100, 1, ST77XX_CYAN, "A: Cycle Char (hold: fast)");
+    uiTree.addText(10, 115, 1, ST77XX_CYAN, "B: Confirm  Hold B: Delete  C: Submit");
   }
-  tft.println(displaySSID);
   
-  // Display current password (masked) - safely handle the String
-  tft.setCursor(10, 60);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("Password: ");
-  tft.setTextColor(ST77XX_WHITE);
+  // Safely truncate SSID if too long (using fixed buffer to prevent heap issues)
+  StaticString<21> displaySSID; // Fixed size buffer for max 20 chars + null terminator
+  fitText(displaySSID, ssid);
+  uiTree.setText(networkField, displaySSID.c_str());
   
-  // Use safe approach for masked password display
-  char safePassword[33]; // Max 32 chars + null terminator
-  if (maskedPassword.length() > 32) {
-    strncpy(safePassword, maskedPassword.c_str(), 32);
-    safePassword[32] = '\0';
-  } else {
-    strncpy(safePassword, maskedPassword.c_str(), 32);
-    safePassword[32] = '\0';
-  }
-  tft.print(safePassword);
+  // Show the most recent 28 characters so the entry point stays on screen
+  const int maxVisible = 28;
+  const char* password = maskedPassword;
+  int length = strlen(maskedPassword);
+  uiTree.setText(passwordField, length > maxVisible ? password + length - maxVisible : password);
   
   // Display current character being selected
-  tft.setCursor(10, 75);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("Current: ");
-  tft.setTextColor(ST77XX_GREEN);
-  tft.setTextSize(2);
-  tft.print(currentChar);
+  char currentText[2] = { currentChar, '\0' };
+  uiTree.setText(currentField, currentText);
   
-  // Display instructions
-  tft.setTextColor(ST77XX_CYAN);
-  tft.setTextSize(1);
-  tft.setCursor(10, 100);
-  tft.println("A: Cycle Char");
-  tft.setCursor(10, 115);
-  tft.println("B: Confirm Char  C: Submit");
+  // Only widgets whose value changed are redrawn
+  uiTree.render(tft);
   
   // Skip NeoMatrix operations for stability
   // clearNeoMatrix(matrix);
 }
 
-void displayConnectingMessage(Adafruit_ST7789& tft, const String& ssid) {
+void displayConnectingMessage(Adafruit_ST7789& tft, const char* ssid) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen first
   clearTFTScreen(tft);
   
@@ -380,18 +294,9 @@ void displayConnectingMessage(Adafruit_ST7789& tft, const String& ssid) {
   tft.setTextColor(ST77XX_WHITE);
   
   // Safely truncate SSID if too long
-  char displaySSID[26]; // Fixed size buffer to prevent heap issues
-  if (ssid.length() > 25) {
-    strncpy(displaySSID, ssid.c_str(), 22);
-    displaySSID[22] = '.';
-    displaySSID[23] = '.';
-    displaySSID[24] = '.';
-    displaySSID[25] = '\0';
-  } else {
-    strncpy(displaySSID, ssid.c_str(), 25);
-    displaySSID[25] = '\0';
-  }
-  tft.println(displaySSID);
+  StaticString<26> displaySSID; // Fixed size buffer to prevent heap issues
+  fitText(displaySSID, ssid);
+  tft.println(displaySSID.c_str());
   
   // Display status message
   tft.setCursor(10, 100);
@@ -404,7 +309,8 @@ void displayConnectingMessage(Adafruit_ST7789& tft, const String& ssid) {
   tft.println("Timeout: 10 seconds");
 }
 
-void displayWiFiSuccess(Adafruit_ST7789& tft, const String& ssid, const String& ipAddress, int32_t rssi) {
+void displayWiFiSuccess(Adafruit_ST7789& tft, const char* ssid, const char* ipAddress, int32_t rssi) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen first
   clearTFTScreen(tft);
   
@@ -425,18 +331,9 @@ void displayWiFiSuccess(Adafruit_ST7789& tft, const String& ssid, const String&
   tft.setTextColor(ST77XX_WHITE);
   
   // Safely truncate SSID if too long
-  char displaySSID[21]; // Fixed size buffer to prevent heap issues
-  if (ssid.length() > 20) {
-    strncpy(displaySSID, ssid.c_str(), 17);
-    displaySSID[17] = '.';
-    displaySSID[18] = '.';
-    displaySSID[19] = '.';
-    displaySSID[20] = '\0';
-  } else {
-    strncpy(displaySSID, ssid.c_str(), 20);
-    displaySSID[20] = '\0';
-  }
-  tft.println(displaySSID);
+  StaticString<21> displaySSID; // Fixed size buffer to prevent heap issues
+  fitText(displaySSID, ssid);
+  tft.println(displaySSID.c_str());
   
   // Display IP address
   tft.setCursor(10, 60);
@@ -445,15 +342,8 @@ void displayWiFiSuccess(Adafruit_ST7789& tft, const String& ssid, const String&
   tft.setTextColor(ST77XX_CYAN);
   
   // Safely handle IP address string
-  char displayIP[16]; // Max IP length is 15 chars + null terminator
-  if (ipAddress.length() > 15) {
-    strncpy(displayIP, ipAddress.c_str(), 15);
-    displayIP[15] = '\0';
-  } else {
-    strncpy(displayIP, ipAddress.c_str(), 15);
-    displayIP[15] = '\0';
-  }
-  tft.println(displayIP);
+  StaticString<16> displayIP(ipAddress); // Max IP length is 15 chars + null terminator
+  tft.println(displayIP.c_str());
   
   // Display signal strength
   tft.setCursor(10, 75);
@@ -477,7 +367,8 @@ void displayWiFiSuccess(Adafruit_ST7789& tft, const String& ssid, const String&
   tft.println("Press any button to continue");
 }
 
-void displayWiFiFailure(Adafruit_ST7789& tft, const String& ssid) {
+void displayWiFiFailure(Adafruit_ST7789& tft, const char* ssid) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen first
   clearTFTScreen(tft);
   
@@ -498,18 +389,9 @@ void displayWiFiFailure(Adafruit_ST7789& tft, const String& ssid) {
   tft.setTextColor(ST77XX_WHITE);
   
   // Safely truncate SSID if too long
-  char displaySSID[21]; // Fixed size buffer to prevent heap issues
-  if (ssid.length() > 20) {
-    strncpy(displaySSID, ssid.c_str(), 17);
-    displaySSID[17] = '.';
-    displaySSID[18] = '.';
-    displaySSID[19] = '.';
-    displaySSID[20] = '\0';
-  } else {
-    strncpy(displaySSID, ssid.c_str(), 20);
-    displaySSID[20] = '\0';
-  }
-  tft.println(displaySSID);
+  StaticString<21> displaySSID; // Fixed size buffer to prevent heap issues
+  fitText(displaySSID, ssid);
+  tft.println(displaySSID.c_str());
   
   // Display possible reasons
   tft.setCursor(10, 65);
@@ -529,7 +411,8 @@ void displayWiFiFailure(Adafruit_ST7789& tft, const String& ssid) {
   tft.println("A: Retry  B: New Pass  C: Back");
 }
 
-void displayTimeSyncStatus(Adafruit_ST7789& tft, const String& status) {
+void displayTimeSyncStatus(Adafruit_ST7789& tft, const char* status, const char* servers) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen first
   clearTFTScreen(tft);
   
@@ -547,26 +430,19 @@ void displayTimeSyncStatus(Adafruit_ST7789& tft, const String& status) {
   tft.setCursor(10, 50);
   
   // Color based on status
-  if (status == "Syncing...") {
+  if (strcmp(status, "Syncing...") == 0) {
     tft.setTextColor(ST77XX_YELLOW);
-  } else if (status == "Synced") {
+  } else if (strcmp(status, "Synced") == 0) {
     tft.setTextColor(ST77XX_GREEN);
-  } else if (status == "Sync Failed") {
+  } else if (strcmp(status, "Sync Failed") == 0) {
     tft.setTextColor(ST77XX_RED);
   } else {
     tft.setTextColor(ST77XX_WHITE);
   }
   
   // Safely display status
-  char displayStatus[21]; // Fixed size buffer
-  if (status.length() > 20) {
-    strncpy(displayStatus, status.c_str(), 20);
-    displayStatus[20] = '\0';
-  } else {
-    strncpy(displayStatus, status.c_str(), 20);
-    displayStatus[20] = '\0';
-  }
-  tft.println(displayStatus);
+  StaticString<21> displayStatus(status); // Fixed size buffer
+  tft.println(displayStatus.c_str());
   
   // Display additional info
   tft.setTextSize(1);
@@ -576,13 +452,14 @@ void displayTimeSyncStatus(Adafruit_ST7789& tft, const String& status) {
   
   tft.setCursor(10, 100);
   tft.setTextColor(0x7BEF); // Light gray color
-  tft.println("Server: pool.ntp.org");
+  tft.println(servers);
   
   tft.setCursor(10, 115);
   tft.println("Please wait...");
 }
 
-void displayCurrentTime(Adafruit_ST7789& tft, const String& timeString, const String& dateString) {
+void displayCurrentTime(Adafruit_ST7789& tft, const char* timeString, const char* dateString, const char* zone) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   // Clear screen first
   clearTFTScreen(tft);
   
@@ -592,15 +469,8 @@ void displayCurrentTime(Adafruit_ST7789& tft, const String& timeString, const St
   tft.setCursor(20, 30);
   
   // Safely display time
-  char displayTime[12]; // Fixed size buffer for HH:MM:SS + null
-  if (timeString.length() > 11) {
-    strncpy(displayTime, timeString.c_str(), 11);
-    displayTime[11] = '\0';
-  } else {
-    strncpy(displayTime, timeString.c_str(), 11);
-    displayTime[11] = '\0';
-  }
-  tft.println(displayTime);
+  StaticString<12> displayTime(timeString); // Fixed size buffer for HH:MM:SS + null
+  tft.println(displayTime.c_str());
   
   // Display date
   tft.setTextSize(2);
@@ -608,150 +478,87 @@ void displayCurrentTime(Adafruit_ST7789& tft, const String& timeString, const St
   tft.setTextColor(ST77XX_CYAN);
   
   // Safely display date
-  char displayDate[15]; // Fixed size buffer for YYYY-MM-DD + null
-  if (dateString.length() > 14) {
-    strncpy(displayDate, dateString.c_str(), 14);
-    displayDate[14] = '\0';
-  } else {
-    strncpy(displayDate, dateString.c_str(), 14);
-    displayDate[14] = '\0';
-  }
-  tft.println(displayDate);
+  StaticString<15> displayDate(dateString); // Fixed size buffer for YYYY-MM-DD + null
+  tft.println(displayDate.c_str());
   
   // Display timezone info
   tft.setTextSize(1);
   tft.setCursor(10, 115);
   tft.setTextColor(0x7BEF); // Light gray color
-  tft.println("Central Time (US)");
+  tft.println(zone);
 }
 
-void displayClockScreen(Adafruit_ST7789& tft, const String& timeString, const String& dateString, const String& status) {
-  // Clear screen first
-  clearTFTScreen(tft);
-  
-  // Display header
-  tft.setTextColor(ST77XX_GREEN);
-  tft.setTextSize(1);
-  tft.setCursor(10, 5);
-  tft.println("ESP32 WordClock");
-  
-  // Draw separator line
-  tft.drawLine(10, 20, 230, 20, ST77XX_GREEN);
-  
-  // Display large time
-  tft.setTextColor(ST77XX_WHITE);
-  tft.setTextSize(3);
-  tft.setCursor(20, 35);
-  
-  // Safely display time
-  char displayTime[12]; // Fixed size buffer for HH:MM:SS + null
-  if (timeString.length() > 11) {
-    strncpy(displayTime, timeString.c_str(), 11);
-    displayTime[11] = '\0';
-  } else {
-    strncpy(displayTime, timeString.c_str(), 11);
-    displayTime[11] = '\0';
+void displayClockScreen(Adafruit_ST7789& tft, const char* timeString, const char* dateString, const char* status, const char* zone) {
+  PERF_SCOPE(PERF_TFT_DRAW);
+  // Widget ids for this screen, assigned when the layout is built
+  static int timeField, dateField, statusField, zoneField;
+  
+  if (uiTree.beginScreen(UI_SCREEN_CLOCK)) {
+    uiTree.addText(10, 5, 1, ST77XX_GREEN, "ESP32 WordClock");
+    uiTree.addRule(10, 20, 221, ST77XX_GREEN);
+    timeField = uiTree.addText(20, 35, 3, ST77XX_WHITE);
+    dateField = uiTree.addText(50, 75, 1, ST77XX_CYAN);
+    uiTree.addText(10, 95, 1, ST77XX_YELLOW, "Status: ");
+    statusField = uiTree.addText(58, 95, 1, ST77XX_YELLOW);
+    zoneField = uiTree.addText(10, 110, 1, 0x7BEF); // Light gray color
+    uiTree.addText(10, 125, 1, 0x5AEB, "A: Settings  B: Sync  C: WordClock"); // Darker gray
   }
-  tft.println(displayTime);
   
-  // Display date
-  tft.setTextSize(1);
-  tft.setCursor(50, 75);
-  tft.setTextColor(ST77XX_CYAN);
+  // Safely display time
+  StaticString<12> displayTime(timeString); // Fixed size buffer for HH:MM:SS + null
+  uiTree.setText(timeField, displayTime.c_str());
   
   // Safely display date
-  char displayDate[15]; // Fixed size buffer for YYYY-MM-DD + null
-  if (dateString.length() > 14) {
-    strncpy(displayDate, dateString.c_str(), 14);
-    displayDate[14] = '\0';
-  } else {
-    strncpy(displayDate, dateString.c_str(), 14);
-    displayDate[14] = '\0';
-  }
-  tft.println(displayDate);
-  
-  // Display sync status
-  tft.setCursor(10, 95);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.print("Status: ");
+  StaticString<15> displayDate(dateString); // Fixed size buffer for YYYY-MM-DD + null
+  uiTree.setText(dateField, displayDate.c_str());
   
   // Color based on status
-  if (status == "Synced") {
-    tft.setTextColor(ST77XX_GREEN);
-  } else if (status == "Sync Failed") {
-    tft.setTextColor(ST77XX_RED);
+  if (strcmp(status, "Synced") == 0) {
+    uiTree.setColor(statusField, ST77XX_GREEN);
+  } else if (strcmp(status, "Sync Failed") == 0) {
+    uiTree.setColor(statusField, ST77XX_RED);
   } else {
-    tft.setTextColor(ST77XX_YELLOW);
+    uiTree.setColor(statusField, ST77XX_YELLOW);
   }
   
   // Safely display status
-  char displayStatus[16]; // Fixed size buffer
-  if (status.length() > 15) {
-    strncpy(displayStatus, status.c_str(), 15);
-    displayStatus[15] = '\0';
-  } else {
-    strncpy(displayStatus, status.c_str(), 15);
-    displayStatus[15] = '\0';
-  }
-  tft.println(displayStatus);
+  StaticString<16> displayStatus(status); // Fixed size buffer
+  uiTree.setText(statusField, displayStatus.c_str());
   
-  // Display timezone info
-  tft.setCursor(10, 110);
-  tft.setTextColor(0x7BEF); // Light gray color
-  tft.println("Central Time (US)");
+  // Selected zone and its offset now; changes with DST
+  uiTree.setText(zoneField, zone);
   
-  // Display button instructions
-  tft.setCursor(10, 125);
-  tft.setTextColor(0x5AEB); // Darker gray
-  tft.println("A: Settings  B: Sync  C: WordClock");
+  // Only widgets whose value changed are redrawn (normally just the seconds)
+  uiTree.render(tft);
 }
 
-void displaySettingsMenu(Adafruit_ST7789& tft, int selectedIndex, const String& timezone, const String& dst, const String& brightness, const String& save) {
-  // Clear screen first
-  clearTFTScreen(tft);
-  
-  // Display header
-  tft.setTextColor(ST77XX_WHITE);
-  tft.setTextSize(2);
-  tft.setCursor(10, 10);
-  tft.println("Settings");
-  
-  // Draw separator line
-  tft.drawLine(10, 35, 230, 35, ST77XX_BLUE);
+void displaySettingsMenu(Adafruit_ST7789& tft, int selectedIndex, const char* timezone, const char* dst, const char* brightness, const char* save) {
+  PERF_SCOPE(PERF_TFT_DRAW);
+  // Widget ids for this screen, assigned when the layout is built
+  static int menuRows[4];
+  
+  if (uiTree.beginScreen(UI_SCREEN_SETTINGS)) {
+    uiTree.addText(10, 10, 2, ST77XX_WHITE, "Settings");
+    uiTree.addRule(10, 35, 221, ST77XX_BLUE);
+    for (int i = 0; i < 4; i++) {
+      menuRows[i] = uiTree.addListRow(8, 43 + (i * 15), 224, 12, ST77XX_WHITE);
+    }
+    uiTree.addText(10, 115, 1, ST77XX_CYAN, "A: Navigate  B: Change  C: Cancel");
+  }
   
   // Settings menu items
-  String menuItems[4] = {timezone, dst, brightness, save};
+  const char* menuItems[4] = {timezone, dst, brightness, save};
   
-  // Display each menu item
+  // Update each menu item, only changed rows are redrawn
   for (int i = 0; i < 4; i++) {
-    tft.setCursor(10, 45 + (i * 15));
-    tft.setTextSize(1);
-    
-    // Highlight selected item
-    if (i == selectedIndex) {
-      tft.setTextColor(ST77XX_BLACK);
-      tft.fillRect(8, 43 + (i * 15), 224, 12, ST77XX_YELLOW);
-    } else {
-      tft.setTextColor(ST77XX_WHITE);
-    }
-    
-    // Safely display menu item
-    char displayItem[30]; // Fixed size buffer
-    if (menuItems[i].length() > 29) {
-      strncpy(displayItem, menuItems[i].c_str(), 29);
-      displayItem[29] = '\0';
-    } else {
-      strncpy(displayItem, menuItems[i].c_str(), 29);
-      displayItem[29] = '\0';
-    }
-    tft.println(displayItem);
+    // Long zone names are shortened to the 36 characters a row can show
+    StaticString<37> displayItem;
+    fitText(displayItem, menuItems[i]);
+    uiTree.setText(menuRows[i], displayItem.c_str());
+    uiTree.setSelected(menuRows[i], i == selectedIndex);
   }
   
-  // Display instructions
-  tft.setTextColor(ST77XX_CYAN);
-  tft.setTextSize(1);
-  tft.setCursor(10, 115);
-  tft.println("A: Navigate  B: Change  C: Cancel");
+  uiTree.render(tft);
 }
 
 void clearAllDisplays(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix) {
@@ -761,54 +568,42 @@ void clearAllDisplays(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix) {
 
 // WordClock display functions
 void displayWordClockMode(Adafruit_ST7789& tft, Adafruit_NeoMatrix& matrix, struct tm* timeinfo) {
+  PERF_SCOPE(PERF_TFT_DRAW);
   if (!timeinfo) {
-    Serial.println("Display: Invalid time info for WordClock mode");
+    LOG_WARN("Display: Invalid time info for WordClock mode");
     return;
   }
   
-  // Clear TFT and show WordClock status
-  clearTFTScreen(tft);
+  // Widget ids for this screen, assigned when the layout is built
+  static int timeField, dateField;
   
-  // Display WordClock header on TFT
-  tft.setTextColor(ST77XX_GREEN);
-  tft.setTextSize(2);
-  tft.setCursor(10, 10);
-  tft.println("WordClock Mode");
+  if (uiTree.beginScreen(UI_SCREEN_WORDCLOCK)) {
+    uiTree.addText(10, 10, 2, ST77XX_GREEN, "WordClock Mode");
+    uiTree.addRule(10, 35, 221, ST77XX_GREEN);
+    timeField = uiTree.addText(20, 50, 2, ST77XX_WHITE);
+    dateField = uiTree.addText(30, 80, 1, ST77XX_CYAN);
+    uiTree.addText(10, 100, 1, ST77XX_YELLOW, "Matrix: Active");
+    uiTree.addText(10, 115, 1, 0x7BEF, "A: Settings  B: Sync  C: WiFi"); // Light gray
+  }
   
-  // Draw separator line
-  tft.drawLine(10, 35, 230, 35, ST77XX_GREEN);
-  
-  // Display current time on TFT for reference
-  tft.setTextColor(ST77XX_WHITE);
-  tft.setTextSize(2);
-  tft.setCursor(20, 50);
-  tft.printf("%02d:%02d:%02d", timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec);
+  // Display current time on TFT for reference, to the minute like the matrix
+  StaticString<12> displayTime;
+  displayTime.printf("%02d:%02d", timeinfo->tm_hour, timeinfo->tm_min);
+  uiTree.setText(timeField, displayTime.c_str());
   
   // Display date
-  tft.setTextSize(1);
-  tft.setCursor(30, 80);
-  tft.setTextColor(ST77XX_CYAN);
-  tft.printf("%04d-%02d-%02d", timeinfo->tm_year + 1900, timeinfo->tm_mon + 1, timeinfo->tm_mday);
-  
-  // Display WordClock status
-  tft.setCursor(10, 100);
-  tft.setTextColor(ST77XX_YELLOW);
-  tft.println("Matrix: Active");
-  
-  // Display instructions
-  tft.setCursor(10, 115);
-  tft.setTextColor(0x7BEF); // Light gray
-  tft.println("A: Settings  B: Sync  C: WiFi");
+  StaticString<16> displayDate; // YYYY-MM-DD, room for a wider year
+  displayDate.printf("%04d-%02d-%02d", timeinfo->tm_year + 1900, timeinfo->tm_mon + 1, timeinfo->tm_mday);
+  uiTree.setText(dateField, displayDate.c_str());
   
-  // Adjust brightness based on time
-  adjustWordClockBrightness(timeinfo);
+  uiTree.render(tft);
   
-  // Display time on WordClock matrix
-  displayWordClockTime(timeinfo);
+  // Display time on WordClock matrix (render task sets the brightness)
+  matrixRenderer.showTime(*timeinfo);
 }
 
 void showWordClockStartup(Adafruit_NeoMatrix& matrix) {
-  Serial.println("Display: Starting WordClock startup sequence");
+  LOG_INFO("Display: Starting WordClock startup sequence");
   
   // Initialize WordClock
   initializeWordClock(matrix);
@@ -819,5 +614,5 @@ void showWordClockStartup(Adafruit_NeoMatrix& matrix) {
   // Flash all words
   flashWords();
   
-  Serial.println("Display: WordClock startup sequence complete");
+  LOG_INFO("Display: WordClock startup sequence complete");
 }
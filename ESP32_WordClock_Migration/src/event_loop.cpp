@@ -0,0 +1,186 @@
+#include "../include/event_loop.h"
+#include "../include/monotonic_clock.h"
+#include "../include/logger.h"
+#include <esp_pm.h>
+#include <esp_idf_version.h>
+
+#define EVENT_QUEUE_LENGTH 16
+#define EVENT_STATS_INTERVAL_MS 600000UL  // Logged summary every 10 minutes
+
+// Shared with interrupts and the esp_timer task
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const eventNames[EVENT_TYPE_COUNT] = {"tick", "button", "ntp", "frame", "network"};
+
+// Global event loop instance
+EventLoop eventLoop;
+
+EventLoop::EventLoop() {
+  queue = nullptr;
+  frameTimer = nullptr;
+  frameDueUs = 0;
+  memset(&stats, 0, sizeof(stats));
+  statsStartUs = 0;
+  lastLogUs = 0;
+}
+
+bool EventLoop::begin() {
+  if (queue) return true;
+
+  queue = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(uint8_t));
+  if (!queue) {
+    LOG_WARN("[EVENT_LOOP] Failed to create queue");
+    return false;
+  }
+
+  esp_timer_create_args_t args = {};
+  args.callback = &EventLoop::onFrameTimer;
+  args.arg = this;
+  args.name = "frame";
+  if (esp_timer_create(&args, &frameTimer) != ESP_OK) {
+    LOG_WARN("[EVENT_LOOP] Failed to create frame timer");
+    frameTimer = nullptr;
+  }
+
+  resetStats();
+  LOG_INFO("[EVENT_LOOP] Initialized");
+  return true;
+}
+
+// Dynamic frequency scaling down to the crystal, and light sleep from the
+// idle task whenever no task or timer is due for a while
+bool EventLoop::enableLightSleep() {
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_pm_config_t config = {};
+#else
+  esp_pm_config_esp32s2_t config = {};
+#endif
+  config.max_freq_mhz = getCpuFrequencyMhz();
+  config.min_freq_mhz = getXtalFrequencyMhz();
+  config.light_sleep_enable = true;
+
+  esp_err_t err = esp_pm_configure(&config);
+  if (err != ESP_OK) {
+    LOG_WARN("[EVENT_LOOP] Light sleep not available (error %d), idling awake", err);
+    return false;
+  }
+  LOG_INFO("[EVENT_LOOP] Light sleep enabled");
+  return true;
+}
+
+void EventLoop::post(EventType type) {
+  if (!queue) return;
+  uint8_t item = type;
+  if (xQueueSend(queue, &item, 0) != pdTRUE) {
+    portENTER_CRITICAL(&statsLock);
+    stats.dropped++;
+    portEXIT_CRITICAL(&statsLock);
+  }
+}
+
+void IRAM_ATTR EventLoop::postFromISR(EventType type) {
+  if (!queue) return;
+  uint8_t item = type;
+  BaseType_t woken = pdFALSE;
+  if (xQueueSendFromISR(queue, &item, &woken) != pdTRUE) {
+    portENTER_CRITICAL_ISR(&statsLock);
+    stats.dropped++;
+    portEXIT_CRITICAL_ISR(&statsLock);
+  }
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+// Runs in the esp_timer task
+void EventLoop::onFrameTimer(void* arg) {
+  EventLoop* self = static_cast<EventLoop*>(arg);
+  portENTER_CRITICAL(&statsLock);
+  self->frameDueUs = 0;
+  portEXIT_CRITICAL(&statsLock);
+  self->post(EVENT_FRAME);
+}
+
+void EventLoop::requestFrame(uint32_t delayMs) {
+  if (!frameTimer) {
+    post(EVENT_FRAME);  // No timer: wake at once, the caller checks its own time
+    return;
+  }
+
+  uint64_t dueUs = monotonicMicros() + delayMs * 1000ULL;
+  portENTER_CRITICAL(&statsLock);
+  bool keep = frameDueUs != 0 && frameDueUs <= dueUs;
+  portEXIT_CRITICAL(&statsLock);
+  if (keep) return;
+
+  esp_timer_stop(frameTimer);  // Fails harmlessly when not running
+  if (esp_timer_start_once(frameTimer, delayMs * 1000ULL) == ESP_OK) {
+    portENTER_CRITICAL(&statsLock);
+    frameDueUs = dueUs;
+    portEXIT_CRITICAL(&statsLock);
+  }
+}
+
+uint32_t EventLoop::wait(uint32_t maxMs) {
+  if (maxMs > EVENT_WAIT_MAX_MS) {
+    maxMs = EVENT_WAIT_MAX_MS;
+  }
+  if (!queue) {
+    delay(maxMs);
+    return 0;
+  }
+
+  uint64_t startUs = monotonicMicros();
+  uint32_t events = 0;
+  uint8_t item;
+  if (xQueueReceive(queue, &item, pdMS_TO_TICKS(maxMs)) == pdTRUE) {
+    // Everything queued meanwhile is handled by the same pass
+    do {
+      if (item < EVENT_TYPE_COUNT) {
+        events |= EVENT_BIT(item);
+        stats.events[item]++;
+      }
+    } while (xQueueReceive(queue, &item, 0) == pdTRUE);
+  } else {
+    stats.timeouts++;
+  }
+
+  uint64_t nowUs = monotonicMicros();
+  stats.loopBlockedUs += nowUs - startUs;
+  stats.wakes++;
+
+  if (nowUs - lastLogUs >= EVENT_STATS_INTERVAL_MS * 1000ULL) {
+    lastLogUs = nowUs;
+    logStats();
+  }
+  return events;
+}
+
+EventLoopStats EventLoop::getStats() {
+  portENTER_CRITICAL(&statsLock);
+  EventLoopStats result = stats;
+  portEXIT_CRITICAL(&statsLock);
+
+  result.elapsedUs = monotonicMicros() - statsStartUs;
+  result.loopBlockedPercent = result.elapsedUs ? (uint8_t)(result.loopBlockedUs * 100 / result.elapsedUs) : 0;
+  return result;
+}
+
+void EventLoop::resetStats() {
+  portENTER_CRITICAL(&statsLock);
+  memset(&stats, 0, sizeof(stats));
+  portEXIT_CRITICAL(&statsLock);
+  statsStartUs = monotonicMicros();
+  lastLogUs = statsStartUs;
+}
+
+void EventLoop::logStats() {
+  EventLoopStats s = getStats();
+  uint32_t blockedPermille = s.elapsedUs ? (uint32_t)(s.loopBlockedUs * 1000 / s.elapsedUs) : 0;
+  LOG_INFO("[EVENT_LOOP] %lu s: %lu wakes (%lu timeouts), loop blocked %lu.%lu%%, dropped %lu",
+                (unsigned long)(s.elapsedUs / 1000000), (unsigned long)s.wakes, (unsigned long)s.timeouts,
+                (unsigned long)(blockedPermille / 10), (unsigned long)(blockedPermille % 10), (unsigned long)s.dropped);
+  for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+    LOG_INFO("[EVENT_LOOP]   %s: %lu", eventNames[i], (unsigned long)s.events[i]);
+  }
+}
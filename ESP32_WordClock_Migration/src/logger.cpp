@@ -0,0 +1,325 @@
+#include "../include/logger.h"
+#include "../include/task_config.h"
+#include <atomic>
+
+#define LOG_RING_SIZE 64          // Records, power of two
+#define LOG_LINE_LENGTH 160       // Formatted, longer lines are cut
+
+// One message. sequence says whose turn the slot is: equal to the ring
+// position while free for the writer of that position, position + 1
+// once written, until the log task has printed it.
+struct LogRecord {
+  std::atomic<uint32_t> sequence;
+  uint32_t timeMs;
+  const char* format;
+  uint8_t level;
+  uint8_t length;
+  bool truncated;
+  uint8_t payload[LOG_PAYLOAD_SIZE];
+};
+
+// Any number of writers claim positions with a compare-and-swap on the
+// head, the log task alone reads from the tail
+static LogRecord records[LOG_RING_SIZE];
+static std::atomic<uint32_t> ringHead(0);
+
+static std::atomic<uint32_t> writtenCount(0);
+static std::atomic<uint32_t> droppedCount(0);
+static std::atomic<uint32_t> truncatedCount(0);
+
+static const char levelLetters[] = "-EWID";   // By LOG_LEVEL_*
+
+// Global logger instance
+Logger logger;
+
+void LogArgs::put(uint8_t type, const void* value, size_t size) {
+  if (truncated) return;  // Keep the order: nothing after a missing argument
+  if (length + 1 + size > LOG_PAYLOAD_SIZE) {
+    truncated = true;
+    return;
+  }
+  data[length++] = type;
+  memcpy(&data[length], value, size);
+  length += size;
+}
+
+void LogArgs::addSigned(int64_t value, bool wide) {
+  if (wide) {
+    put(LOG_ARG_INT64, &value, sizeof(value));
+  } else {
+    int32_t narrow = (int32_t)value;
+    put(LOG_ARG_INT, &narrow, sizeof(narrow));
+  }
+}
+
+void LogArgs::addUnsigned(uint64_t value, bool wide) {
+  if (wide) {
+    put(LOG_ARG_UINT64, &value, sizeof(value));
+  } else {
+    uint32_t narrow = (uint32_t)value;
+    put(LOG_ARG_UINT, &narrow, sizeof(narrow));
+  }
+}
+
+void LogArgs::add(const char* value) {
+  if (truncated) return;
+  if (!value) {
+    value = "(null)";
+  }
+  int room = LOG_PAYLOAD_SIZE - length - 2;  // Type and length bytes
+  if (room < 0) {
+    truncated = true;
+    return;
+  }
+  size_t size = strlen(value);
+  if (size > (size_t)room) {
+    size = room;
+    truncated = true;  // Cut here; later arguments are dropped
+  }
+  data[length++] = LOG_ARG_STRING;
+  data[length++] = (uint8_t)size;
+  memcpy(&data[length], value, size);
+  length += size;
+}
+
+// Format one conversion from the next packed argument. The stored type
+// decides the C type (and length modifier); a conversion that doesn't
+// fit it falls back to a plain one for that type.
+static int formatArg(char* out, size_t size, const char* spec, size_t specLength, char conversion,
+                     const uint8_t*& arg, const uint8_t* end) {
+  if (arg >= end) {
+    return snprintf(out, size, "?");
+  }
+
+  char fullSpec[24];
+  memcpy(fullSpec, spec, specLength);
+  size_t n = specLength;
+  uint8_t type = *arg++;
+  bool integer = strchr("diouxXc", conversion) != nullptr;
+
+  switch (type) {
+    case LOG_ARG_INT:
+    case LOG_ARG_UINT: {
+      uint32_t value;
+      memcpy(&value, arg, sizeof(value));
+      arg += sizeof(value);
+      fullSpec[n++] = integer ? conversion : (type == LOG_ARG_INT ? 'd' : 'u');
+      fullSpec[n] = '\0';
+      return snprintf(out, size, fullSpec, value);
+    }
+
+    case LOG_ARG_INT64:
+    case LOG_ARG_UINT64: {
+      uint64_t value;
+      memcpy(&value, arg, sizeof(value));
+      arg += sizeof(value);
+      fullSpec[n++] = 'l';
+      fullSpec[n++] = 'l';
+      fullSpec[n++] = (integer && conversion != 'c') ? conversion : (type == LOG_ARG_INT64 ? 'd' : 'u');
+      fullSpec[n] = '\0';
+      return snprintf(out, size, fullSpec, (unsigned long long)value);
+    }
+
+    case LOG_ARG_DOUBLE: {
+      double value;
+      memcpy(&value, arg, sizeof(value));
+      arg += sizeof(value);
+      fullSpec[n++] = strchr("fFeEgGaA", conversion) ? conversion : 'g';
+      fullSpec[n] = '\0';
+      return snprintf(out, size, fullSpec, value);
+    }
+
+    case LOG_ARG_STRING: {
+      char text[LOG_PAYLOAD_SIZE];
+      uint8_t length = *arg++;
+      memcpy(text, arg, length);
+      text[length] = '\0';
+      arg += length;
+      fullSpec[n++] = 's';
+      fullSpec[n] = '\0';
+      return snprintf(out, size, fullSpec, text);
+    }
+
+    case LOG_ARG_POINTER: {
+      const void* value;
+      memcpy(&value, arg, sizeof(value));
+      arg += sizeof(value);
+      return snprintf(out, size, "%p", value);
+    }
+
+    default:
+      arg = end;  // Corrupt: stop reading
+      return snprintf(out, size, "?");
+  }
+}
+
+// printf over the packed arguments
+static void formatMessage(char* out, size_t size, const char* format, const uint8_t* payload, uint8_t length) {
+  const uint8_t* arg = payload;
+  const uint8_t* end = payload + length;
+  size_t n = 0;
+
+  while (*format && n + 1 < size) {
+    if (*format != '%') {
+      out[n++] = *format++;
+      continue;
+    }
+    if (format[1] == '%') {
+      out[n++] = '%';
+      format += 2;
+      continue;
+    }
+
+    // Flags, width and precision are kept, the length modifier comes
+    // from the stored type
+    char spec[16];
+    size_t specLength = 0;
+    spec[specLength++] = *format++;
+    while (*format && strchr("-+ #0123456789.", *format)) {
+      if (specLength < sizeof(spec) - 1) {
+        spec[specLength++] = *format;
+      }
+      format++;
+    }
+    while (*format && strchr("hlLqjzt", *format)) {
+      format++;
+    }
+    char conversion = *format;
+    if (!conversion) break;
+    format++;
+
+    int written = formatArg(&out[n], size - n, spec, specLength, conversion, arg, end);
+    if (written > 0) {
+      n += (size_t)written < size - n ? (size_t)written : size - n - 1;
+    }
+  }
+  out[n] = '\0';
+}
+
+// A record without a format holds raw bytes (telemetry frames)
+static void printMessage(uint8_t level, uint32_t timeMs, const char* format,
+                         const uint8_t* payload, uint8_t length, bool truncated) {
+  if (!format) {
+    Serial.write(payload, length);
+    return;
+  }
+
+  char line[LOG_LINE_LENGTH];
+  int prefix = snprintf(line, sizeof(line), "%c (%lu) ", levelLetters[level < sizeof(levelLetters) - 1 ? level : 0],
+                        (unsigned long)timeMs);
+  formatMessage(&line[prefix], sizeof(line) - prefix, format, payload, length);
+  Serial.print(line);
+  Serial.println(truncated ? " ..." : "");
+}
+
+Logger::Logger() {
+  task = nullptr;
+  tail = 0;
+  droppedReported = 0;
+  for (uint32_t i = 0; i < LOG_RING_SIZE; i++) {
+    records[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool Logger::begin() {
+  if (task) return true;
+
+  if (xTaskCreate(&Logger::taskMain, "log", LOG_TASK_STACK, this,
+                  LOG_TASK_PRIORITY, &task) != pdPASS) {
+    task = nullptr;
+    Serial.println("[LOG] Failed to create task, printing inline");
+    return false;
+  }
+  return true;
+}
+
+void Logger::write(uint8_t level, const char* format, const LogArgs& args) {
+  if (args.isTruncated()) {
+    truncatedCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  queue(level, format, args.getData(), args.getLength(), args.isTruncated());
+}
+
+void Logger::writeBinary(const uint8_t* data, uint8_t length) {
+  if (length > LOG_PAYLOAD_SIZE) {
+    truncatedCount.fetch_add(1, std::memory_order_relaxed);
+    return;  // A cut frame is useless to the reader
+  }
+  queue(LOG_LEVEL_NONE, nullptr, data, length, false);
+}
+
+void Logger::queue(uint8_t level, const char* format, const uint8_t* data, uint8_t length, bool truncated) {
+  if (!task) {
+    printMessage(level, millis(), format, data, length, truncated);
+    return;
+  }
+
+  // Claim a position; its slot must have been printed a full lap ago
+  uint32_t position = ringHead.load(std::memory_order_relaxed);
+  LogRecord* record;
+  for (;;) {
+    record = &records[position & (LOG_RING_SIZE - 1)];
+    int32_t turn = (int32_t)(record->sequence.load(std::memory_order_acquire) - position);
+    if (turn == 0) {
+      if (ringHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (turn < 0) {
+      droppedCount.fetch_add(1, std::memory_order_relaxed);  // Full
+      return;
+    } else {
+      position = ringHead.load(std::memory_order_relaxed);  // Another writer took it
+    }
+  }
+
+  record->timeMs = millis();
+  record->format = format;
+  record->level = level;
+  record->length = length;
+  record->truncated = truncated;
+  memcpy(record->payload, data, length);
+  record->sequence.store(position + 1, std::memory_order_release);
+
+  writtenCount.fetch_add(1, std::memory_order_relaxed);
+  xTaskNotifyGive(task);
+}
+
+void Logger::taskMain(void* arg) {
+  static_cast<Logger*>(arg)->run();
+}
+
+void Logger::run() {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (printNext()) {
+    }
+
+    uint32_t dropped = droppedCount.load(std::memory_order_relaxed);
+    if (dropped != droppedReported) {
+      Serial.printf("W (%lu) [LOG] %lu records dropped\n", (unsigned long)millis(),
+                    (unsigned long)(dropped - droppedReported));
+      droppedReported = dropped;
+    }
+  }
+}
+
+// Print the record at the tail if its writer has finished it
+bool Logger::printNext() {
+  LogRecord& record = records[tail & (LOG_RING_SIZE - 1)];
+  if (record.sequence.load(std::memory_order_acquire) != tail + 1) {
+    return false;
+  }
+
+  printMessage(record.level, record.timeMs, record.format, record.payload, record.length, record.truncated);
+  record.sequence.store(tail + LOG_RING_SIZE, std::memory_order_release);  // Free for the next lap
+  tail++;
+  return true;
+}
+
+LoggerStats Logger::getStats() {
+  LoggerStats result;
+  result.written = writtenCount.load(std::memory_order_relaxed);
+  result.dropped = droppedCount.load(std::memory_order_relaxed);
+  result.truncated = truncatedCount.load(std::memory_order_relaxed);
+  return result;
+}
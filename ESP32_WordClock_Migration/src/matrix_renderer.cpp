@@ -0,0 +1,185 @@
+#include "../include/matrix_renderer.h"
+#include "../include/wordclock_manager.h"
+#include "../include/display_manager.h"
+#include "../include/monotonic_clock.h"
+#include "../include/task_config.h"
+#include "../include/perf_counters.h"
+#include "../include/logger.h"
+
+#define RENDER_QUEUE_LENGTH 4
+#define MATRIX_FRAME_MS SHIFTDELAY               // One color shift step per frame
+#define RENDER_STATS_INTERVAL_MS 600000UL        // Logged summary every 10 minutes
+
+// Shared between the render task and readers of the stats
+static portMUX_TYPE renderLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Global matrix renderer instance
+MatrixRenderer matrixRenderer;
+
+MatrixRenderer::MatrixRenderer() {
+  matrix = nullptr;
+  commands = nullptr;
+  task = nullptr;
+  memset(&shown, 0, sizeof(shown));
+  wordsShown = false;
+  memset(&stats, 0, sizeof(stats));
+  lastLogUs = 0;
+}
+
+bool MatrixRenderer::begin(Adafruit_NeoMatrix& neoMatrix) {
+  if (task) return true;
+
+  matrix = &neoMatrix;
+  initializeWordClock(neoMatrix);
+
+  commands = xQueueCreate(RENDER_QUEUE_LENGTH, sizeof(MatrixCommand));
+  if (!commands) {
+    LOG_WARN("[MATRIX] Failed to create queue, rendering inline");
+    return false;
+  }
+  lastLogUs = monotonicMicros();
+  if (xTaskCreate(&MatrixRenderer::taskMain, "matrix", RENDER_TASK_STACK, this,
+                  RENDER_TASK_PRIORITY, &task) != pdPASS) {
+    LOG_WARN("[MATRIX] Failed to create task, rendering inline");
+    vQueueDelete(commands);
+    commands = nullptr;
+    task = nullptr;
+    return false;
+  }
+
+  LOG_INFO("[MATRIX] Render task started");
+  return true;
+}
+
+void MatrixRenderer::showIntro() {
+  MatrixCommand command = {MATRIX_INTRO, 0, 0};
+  send(command);
+}
+
+void MatrixRenderer::showTime(const struct tm& timeinfo) {
+  MatrixCommand command = {MATRIX_WORDS, (uint8_t)timeinfo.tm_hour, (uint8_t)timeinfo.tm_min};
+  send(command);
+}
+
+void MatrixRenderer::clear() {
+  MatrixCommand command = {MATRIX_BLANK, 0, 0};
+  send(command);
+}
+
+void MatrixRenderer::send(const MatrixCommand& command) {
+  if (!commands) {
+    if (matrix) {
+      execute(command);
+    }
+    return;
+  }
+  if (xQueueSend(commands, &command, 0) != pdTRUE) {
+    portENTER_CRITICAL(&renderLock);
+    stats.dropped++;
+    portEXIT_CRITICAL(&renderLock);
+  }
+}
+
+void MatrixRenderer::taskMain(void* arg) {
+  static_cast<MatrixRenderer*>(arg)->run();
+}
+
+// Block on the queue until the next frame is due; commands cut the wait
+// short. Frames run on a fixed schedule so lateness shows up in stats.
+void MatrixRenderer::run() {
+  uint64_t dueUs = 0;
+  for (;;) {
+    TickType_t wait = portMAX_DELAY;
+    if (wordsShown) {
+      uint64_t nowUs = monotonicMicros();
+      wait = dueUs > nowUs ? pdMS_TO_TICKS((dueUs - nowUs + 999) / 1000) : 0;
+    }
+
+    MatrixCommand command;
+    if (xQueueReceive(commands, &command, wait) == pdTRUE) {
+      execute(command);
+      dueUs = monotonicMicros() + MATRIX_FRAME_MS * 1000ULL;  // Restart the schedule
+      continue;
+    }
+
+    uint64_t nowUs = monotonicMicros();
+    uint64_t lateUs = nowUs > dueUs ? nowUs - dueUs : 0;
+    drawFrame();
+    dueUs += MATRIX_FRAME_MS * 1000ULL;
+    bool overrun = dueUs <= nowUs;
+    if (overrun) {
+      dueUs = nowUs + MATRIX_FRAME_MS * 1000ULL;
+    }
+    recordFrame(lateUs, overrun);
+
+    if (nowUs - lastLogUs >= RENDER_STATS_INTERVAL_MS * 1000ULL) {
+      lastLogUs = nowUs;
+      logStats();
+    }
+  }
+}
+
+void MatrixRenderer::execute(const MatrixCommand& command) {
+  switch (command.scene) {
+    case MATRIX_INTRO:
+      showWordClockStartup(*matrix);
+      if (wordsShown) {
+        drawFrame();  // Back to the time
+      }
+      break;
+
+    case MATRIX_WORDS:
+      shown.tm_hour = command.hour;
+      shown.tm_min = command.minute;
+      wordsShown = true;
+      drawFrame();
+      break;
+
+    case MATRIX_BLANK:
+      wordsShown = false;
+      clearNeoMatrix(*matrix);
+      break;
+  }
+}
+
+void MatrixRenderer::drawFrame() {
+  PERF_SCOPE(PERF_MATRIX_FRAME);
+  adjustWordClockBrightness(&shown);
+  displayWordClockTime(&shown);
+}
+
+void MatrixRenderer::recordFrame(uint64_t lateUs, bool overrun) {
+  portENTER_CRITICAL(&renderLock);
+  stats.frames++;
+  stats.lateTotalUs += lateUs;
+  if (lateUs > stats.lateMaxUs) {
+    stats.lateMaxUs = (uint32_t)lateUs;
+  }
+  if (overrun) {
+    stats.overruns++;
+  }
+  portEXIT_CRITICAL(&renderLock);
+}
+
+RenderStats MatrixRenderer::getStats() {
+  portENTER_CRITICAL(&renderLock);
+  RenderStats result = stats;
+  portEXIT_CRITICAL(&renderLock);
+
+  result.stackFree = task ? uxTaskGetStackHighWaterMark(task) : 0;
+  return result;
+}
+
+void MatrixRenderer::resetStats() {
+  portENTER_CRITICAL(&renderLock);
+  memset(&stats, 0, sizeof(stats));
+  portEXIT_CRITICAL(&renderLock);
+}
+
+void MatrixRenderer::logStats() {
+  RenderStats s = getStats();
+  uint32_t lateAvgUs = s.frames ? (uint32_t)(s.lateTotalUs / s.frames) : 0;
+  LOG_INFO("[MATRIX] %lu frames, late avg %lu us max %lu us, %lu overruns, %lu dropped, stack free %lu",
+                (unsigned long)s.frames, (unsigned long)lateAvgUs, (unsigned long)s.lateMaxUs,
+                (unsigned long)s.overruns, (unsigned long)s.dropped, (unsigned long)s.stackFree);
+}
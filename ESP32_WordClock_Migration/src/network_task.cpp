@@ -0,0 +1,181 @@
+#include "../include/network_task.h"
+#include "../include/wifi_manager.h"
+#include "../include/event_loop.h"
+#include "../include/task_config.h"
+#include "../include/logger.h"
+
+// Shared between the network task and the UI
+static portMUX_TYPE networkLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Global network task instance
+NetworkTask networkTask;
+
+NetworkTask::NetworkTask() {
+  jobs = nullptr;
+  task = nullptr;
+  state = NETWORK_IDLE;
+  resolving = false;
+  for (int i = 0; i < NETWORK_RESOLVE_MAX; i++) {
+    resolvedOk[i] = false;
+  }
+}
+
+bool NetworkTask::begin() {
+  if (task) return true;
+
+  jobs = xQueueCreate(2, sizeof(NetworkJob));  // A scan or connect, and a lookup
+  if (!jobs) {
+    LOG_WARN("[NETWORK] Failed to create queue, running jobs inline");
+    return false;
+  }
+  if (xTaskCreate(&NetworkTask::taskMain, "network", NETWORK_TASK_STACK, this,
+                  NETWORK_TASK_PRIORITY, &task) != pdPASS) {
+    LOG_WARN("[NETWORK] Failed to create task, running jobs inline");
+    vQueueDelete(jobs);
+    jobs = nullptr;
+    task = nullptr;
+    return false;
+  }
+
+  LOG_INFO("[NETWORK] Task started");
+  return true;
+}
+
+bool NetworkTask::startScan() {
+  NetworkJob job = {};
+  job.type = NETWORK_JOB_SCAN;
+  return start(job);
+}
+
+bool NetworkTask::startConnect(const String& ssid, const String& password) {
+  NetworkJob job = {};
+  job.type = NETWORK_JOB_CONNECT;
+  strlcpy(job.ssid, ssid.c_str(), sizeof(job.ssid));
+  strlcpy(job.password, password.c_str(), sizeof(job.password));
+  return start(job);
+}
+
+bool NetworkTask::start(const NetworkJob& job) {
+  portENTER_CRITICAL(&networkLock);
+  bool busy = state == NETWORK_BUSY;
+  if (!busy) {
+    state = NETWORK_BUSY;
+  }
+  portEXIT_CRITICAL(&networkLock);
+  if (busy) {
+    return false;
+  }
+  post(job);
+  return true;
+}
+
+bool NetworkTask::startResolve(const char* const* hosts, int count) {
+  NetworkJob job = {};
+  job.type = NETWORK_JOB_RESOLVE;
+  for (int i = 0; i < count && i < NETWORK_RESOLVE_MAX; i++) {
+    job.hosts[i] = hosts[i];
+  }
+
+  portENTER_CRITICAL(&networkLock);
+  bool busy = resolving;
+  if (!busy) {
+    resolving = true;
+    for (int i = 0; i < NETWORK_RESOLVE_MAX; i++) {
+      resolvedOk[i] = false;
+    }
+  }
+  portEXIT_CRITICAL(&networkLock);
+  if (busy) {
+    return false;
+  }
+  post(job);
+  return true;
+}
+
+void NetworkTask::post(const NetworkJob& job) {
+  if (!jobs) {
+    execute(job);
+    return;
+  }
+  xQueueSend(jobs, &job, 0);  // Can't be full: one job of each kind
+}
+
+NetworkJobState NetworkTask::getState() {
+  portENTER_CRITICAL(&networkLock);
+  NetworkJobState result = state;
+  portEXIT_CRITICAL(&networkLock);
+  return result;
+}
+
+bool NetworkTask::isResolving() {
+  portENTER_CRITICAL(&networkLock);
+  bool result = resolving;
+  portEXIT_CRITICAL(&networkLock);
+  return result;
+}
+
+bool NetworkTask::getResolved(int index, IPAddress& address) {
+  if (index < 0 || index >= NETWORK_RESOLVE_MAX) return false;
+  portENTER_CRITICAL(&networkLock);
+  bool ok = !resolving && resolvedOk[index];
+  if (ok) {
+    address = resolved[index];
+  }
+  portEXIT_CRITICAL(&networkLock);
+  return ok;
+}
+
+void NetworkTask::taskMain(void* arg) {
+  static_cast<NetworkTask*>(arg)->run();
+}
+
+void NetworkTask::run() {
+  for (;;) {
+    NetworkJob job;
+    if (xQueueReceive(jobs, &job, portMAX_DELAY) == pdTRUE) {
+      execute(job);
+      LOG_DEBUG("[NETWORK] Job done, stack free %lu", (unsigned long)uxTaskGetStackHighWaterMark(task));
+    }
+  }
+}
+
+void NetworkTask::execute(const NetworkJob& job) {
+  if (job.type == NETWORK_JOB_RESOLVE) {
+    resolve(job);
+    return;
+  }
+
+  bool success = true;
+  switch (job.type) {
+    case NETWORK_JOB_SCAN:
+      scanWiFiNetworks();
+      break;
+    case NETWORK_JOB_CONNECT:
+      success = connectToNetwork(job.ssid, job.password);
+      break;
+  }
+
+  portENTER_CRITICAL(&networkLock);
+  state = success ? NETWORK_DONE : NETWORK_FAILED;
+  portEXIT_CRITICAL(&networkLock);
+  eventLoop.post(EVENT_NETWORK);
+}
+
+// Each hostByName() waits out the DNS round trip, or its timeout when the
+// uplink is down
+void NetworkTask::resolve(const NetworkJob& job) {
+  IPAddress addresses[NETWORK_RESOLVE_MAX];
+  bool ok[NETWORK_RESOLVE_MAX];
+  for (int i = 0; i < NETWORK_RESOLVE_MAX; i++) {
+    ok[i] = job.hosts[i] && WiFi.hostByName(job.hosts[i], addresses[i]);
+  }
+
+  portENTER_CRITICAL(&networkLock);
+  for (int i = 0; i < NETWORK_RESOLVE_MAX; i++) {
+    resolved[i] = addresses[i];
+    resolvedOk[i] = ok[i];
+  }
+  resolving = false;
+  portEXIT_CRITICAL(&networkLock);
+  eventLoop.post(EVENT_NETWORK);
+}
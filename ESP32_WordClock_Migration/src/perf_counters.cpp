@@ -0,0 +1,137 @@
+#include "../include/perf_counters.h"
+#include "../include/monotonic_clock.h"
+
+// Probes are recorded from the UI and render tasks
+static portMUX_TYPE perfLock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const probeNames[PERF_PROBE_COUNT] = {
+  "state.update", "state.enter", "state.tick", "state.input",
+  "tft.draw", "matrix.frame", "matrix.show", "ntp.sync"
+};
+
+static const char* const counterNames[PERF_COUNTER_COUNT] = {
+  "transitions", "button events", "tft clears", "ntp syncs", "ntp failures"
+};
+
+// Global instance
+PerfCounters perfCounters;
+
+PerfCounters::PerfCounters() {
+  cyclesPerUs = 0;
+  memset(probes, 0, sizeof(probes));
+  memset(counters, 0, sizeof(counters));
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    probes[i].minUs = UINT32_MAX;
+  }
+  startUs = 0;
+}
+
+static uint8_t bucketFor(uint32_t us) {
+  if (us < 16) return 0;
+  int bit = 31 - __builtin_clz(us);  // 4 for 16..31 us
+  return bit - 3 < PERF_HISTOGRAM_BUCKETS ? bit - 3 : PERF_HISTOGRAM_BUCKETS - 1;
+}
+
+void PerfCounters::record(PerfProbe probe, uint32_t us) {
+  if (probe >= PERF_PROBE_COUNT) return;
+  uint8_t bucket = bucketFor(us);
+
+  portENTER_CRITICAL(&perfLock);
+  PerfProbeStats& stats = probes[probe];
+  stats.count++;
+  stats.totalUs += us;
+  if (us < stats.minUs) stats.minUs = us;
+  if (us > stats.maxUs) stats.maxUs = us;
+  stats.buckets[bucket]++;
+  portEXIT_CRITICAL(&perfLock);
+}
+
+// The counter wraps after 2^32 cycles (18 s at 240 MHz), well beyond
+// anything timed by cycles. Frequency scaling for light sleep makes the
+// conversion approximate.
+void PerfCounters::recordCycles(PerfProbe probe, uint32_t cycles) {
+  if (cyclesPerUs == 0) {
+    cyclesPerUs = getCpuFrequencyMhz();
+    if (cyclesPerUs == 0) cyclesPerUs = 1;
+  }
+  record(probe, cycles / cyclesPerUs);
+}
+
+void PerfCounters::count(PerfCounter counter) {
+  if (counter >= PERF_COUNTER_COUNT) return;
+  portENTER_CRITICAL(&perfLock);
+  counters[counter]++;
+  portEXIT_CRITICAL(&perfLock);
+}
+
+PerfProbeStats PerfCounters::getStats(PerfProbe probe) {
+  portENTER_CRITICAL(&perfLock);
+  PerfProbeStats result = probes[probe];
+  portEXIT_CRITICAL(&perfLock);
+  return result;
+}
+
+uint32_t PerfCounters::getCount(PerfCounter counter) {
+  portENTER_CRITICAL(&perfLock);
+  uint32_t result = counters[counter];
+  portEXIT_CRITICAL(&perfLock);
+  return result;
+}
+
+void PerfCounters::reset() {
+  portENTER_CRITICAL(&perfLock);
+  memset(probes, 0, sizeof(probes));
+  memset(counters, 0, sizeof(counters));
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    probes[i].minUs = UINT32_MAX;
+  }
+  portEXIT_CRITICAL(&perfLock);
+  startUs = monotonicMicros();
+}
+
+uint32_t PerfCounters::percentileUs(const PerfProbeStats& stats, uint8_t percent) {
+  if (stats.count == 0) return 0;
+  uint64_t target = ((uint64_t)stats.count * percent + 99) / 100;  // Rank, rounded up
+  uint64_t seen = 0;
+  for (int i = 0; i < PERF_HISTOGRAM_BUCKETS - 1; i++) {
+    seen += stats.buckets[i];
+    if (seen >= target) {
+      uint32_t boundUs = 16UL << i;
+      return boundUs < stats.maxUs ? boundUs : stats.maxUs;
+    }
+  }
+  return stats.maxUs;
+}
+
+// Printed straight to Serial, not through the logger: it is a report
+// asked for over serial ('p'), and the histogram lines are built at run
+// time and longer than a log record holds
+void PerfCounters::dump() {
+  Serial.printf("[PERF] Since %lu s ago, free heap %lu, min free %lu\n",
+                (unsigned long)((monotonicMicros() - startUs) / 1000000),
+                (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+
+  for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+    Serial.printf("[PERF] %s: %lu\n", counterNames[i], (unsigned long)getCount((PerfCounter)i));
+  }
+
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    PerfProbeStats s = getStats((PerfProbe)i);
+    if (s.count == 0) continue;
+
+    Serial.printf("[PERF] %s: %lu, min %lu us, avg %lu us, max %lu us, p50 <=%lu us, p99 <=%lu us\n",
+                  probeNames[i], (unsigned long)s.count, (unsigned long)s.minUs,
+                  (unsigned long)(s.totalUs / s.count), (unsigned long)s.maxUs,
+                  (unsigned long)percentileUs(s, 50), (unsigned long)percentileUs(s, 99));
+
+    // Non-empty buckets by lower bound
+    char line[256];
+    int n = snprintf(line, sizeof(line), "[PERF]  ");
+    for (int b = 0; b < PERF_HISTOGRAM_BUCKETS && n < (int)sizeof(line); b++) {
+      if (s.buckets[b] == 0) continue;
+      n += snprintf(&line[n], sizeof(line) - n, " %lu+:%lu",
+                    b == 0 ? 0UL : (unsigned long)(8UL << b), (unsigned long)s.buckets[b]);
+    }
+    Serial.println(line);
+  }
+}
@@ -0,0 +1,53 @@
+#include "../include/rle_image.h"
+#include "../include/logger.h"
+
+void drawRLEImage(Adafruit_SPITFT& tft, int16_t x, int16_t y, const RLEImage& image) {
+  if (x < 0 || y < 0 || x + image.width > tft.width() || y + image.height > tft.height()) {
+    LOG_WARN("[RLE_IMAGE] %dx%d image at %d,%d is off screen", image.width, image.height, x, y);
+    return;
+  }
+
+  uint16_t line[RLE_LINE_PIXELS];
+  int buffered = 0;
+  uint32_t remaining = (uint32_t)image.width * image.height;
+  const uint8_t* packet = image.data;
+  const uint8_t* end = image.data + image.size;
+
+  tft.startWrite();
+  tft.setAddrWindow(x, y, image.width, image.height);
+
+  while (remaining > 0 && packet < end) {
+    uint8_t header = *packet++;
+    int count = (header & 0x7F) + 1;
+    bool run = header & 0x80;
+    uint16_t color = 0;
+
+    for (int i = 0; i < count && remaining > 0; i++) {
+      // A run reads its color once, a literal reads one per pixel
+      if (!run || i == 0) {
+        if (packet + 2 > end) {
+          packet = end;  // Truncated inside a color
+          break;
+        }
+        color = (packet[0] << 8) | packet[1];
+        packet += 2;
+      }
+      line[buffered++] = color;
+      remaining--;
+
+      if (buffered == RLE_LINE_PIXELS) {
+        tft.writePixels(line, buffered);
+        buffered = 0;
+      }
+    }
+  }
+
+  if (buffered > 0) {
+    tft.writePixels(line, buffered);
+  }
+  tft.endWrite();
+
+  if (remaining > 0) {
+    LOG_WARN("[RLE_IMAGE] Image data ends %lu pixels short", (unsigned long)remaining);
+  }
+}
@@ -0,0 +1,281 @@
+#include "../include/rtc_clock.h"
+#include "../include/logger.h"
+
+// Registers not covered by RTClib
+#define RTC_I2C_ADDRESS 0x68
+#define RTC_DS3231_SECONDS 0x00
+#define RTC_DS3231_AGING 0x10
+#define RTC_DS3231_CONV 0x20          // Control register: start a temperature conversion
+#define RTC_PCF8523_SECONDS 0x03
+
+// Holdover and calibration
+#define RTC_MIN_VALID_EPOCH 1704067200UL  // 2024-01-01, anything older was never set
+#define RTC_ROLLOVER_TIMEOUT_MS 1100      // A running RTC ticks within a second
+#define RTC_SET_WINDOW_MS 20              // Write only this soon after a second boundary
+#define RTC_MAX_ERROR_MS 50               // Rewrite the time beyond this error...
+#define RTC_MAX_BASELINE_ERROR_MS 1000    // ...or this one while measuring the drift
+#define RTC_MIN_CALIBRATION_S 43200       // Baseline that resolves 0.1 ppm...
+#define RTC_MIN_CALIBRATION_ERROR_MS 200  // ...or enough error to measure precisely
+#define DS3231_AGING_PPB 100              // Per aging step at 25 C, + = slower
+#define PCF8523_OFFSET_PPB 4340           // Per offset step in two hour mode, + = slower
+
+// Global RTC instance
+RtcClock rtcClock;
+
+RtcClock::RtcClock() {
+  chip = RTC_CHIP_NONE;
+  present = false;
+  measuring = false;
+  measureStartUs = 0;
+  lastReadUs = 0;
+  lastSeconds = 0;
+  handledSyncTime = 0;
+  lastErrorUs = 0;
+  haveReference = false;
+  referenceErrorUs = 0;
+  referenceTime = 0;
+  pendingSet = false;
+  verifyingSet = false;
+}
+
+// Register access
+
+uint8_t RtcClock::readRegister(uint8_t reg) {
+  Wire.beginTransmission(RTC_I2C_ADDRESS);
+  Wire.write(reg);
+  Wire.endTransmission();
+  Wire.requestFrom((uint8_t)RTC_I2C_ADDRESS, (uint8_t)1);
+  return Wire.read();
+}
+
+void RtcClock::writeRegister(uint8_t reg, uint8_t value) {
+  Wire.beginTransmission(RTC_I2C_ADDRESS);
+  Wire.write(reg);
+  Wire.write(value);
+  Wire.endTransmission();
+}
+
+uint8_t RtcClock::readSeconds() {
+  return readRegister(chip == RTC_CHIP_DS3231 ? RTC_DS3231_SECONDS : RTC_PCF8523_SECONDS) & 0x7F;
+}
+
+uint32_t RtcClock::readEpoch() {
+  return (chip == RTC_CHIP_DS3231 ? ds3231.now() : pcf8523.now()).unixtime();
+}
+
+int RtcClock::readTrim() {
+  if (chip == RTC_CHIP_DS3231) {
+    return (int8_t)readRegister(RTC_DS3231_AGING);
+  }
+  uint8_t offset = readRegister(PCF8523_OFFSET) & 0x7F;  // 7 bit two's complement
+  return (offset & 0x40) ? offset - 128 : offset;
+}
+
+void RtcClock::writeTrim(int trim) {
+  if (chip == RTC_CHIP_DS3231) {
+    writeRegister(RTC_DS3231_AGING, (uint8_t)(int8_t)trim);
+    // The aging value is applied at the next conversion, force one now
+    writeRegister(DS3231_CONTROL, readRegister(DS3231_CONTROL) | RTC_DS3231_CONV);
+  } else {
+    pcf8523.calibrate(PCF8523_TwoHours, (int8_t)trim);
+  }
+}
+
+// Holdover at boot
+
+// Busy-wait for the seconds register to change: the RTC's second
+// boundary, to within one register read
+bool RtcClock::waitForRollover(uint64_t& edgeUs) {
+  uint64_t startUs = monotonicMicros();
+  uint64_t previousUs = startUs;
+  uint8_t startSeconds = readSeconds();
+  
+  while (monotonicMicros() - startUs < RTC_ROLLOVER_TIMEOUT_MS * 1000ULL) {
+    uint64_t readUs = monotonicMicros();
+    if (readSeconds() != startSeconds) {
+      edgeUs = previousUs + (readUs - previousUs) / 2;
+      return true;
+    }
+    previousUs = readUs;
+  }
+  return false;
+}
+
+bool RtcClock::begin(RTCChip rtcChip) {
+  chip = rtcChip;
+  if (chip == RTC_CHIP_NONE) return false;
+  
+  present = (chip == RTC_CHIP_DS3231) ? ds3231.begin() : pcf8523.begin();
+  if (!present) {
+    LOG_WARN("[RTC] No RTC found");
+    return false;
+  }
+  
+  bool lostPower = (chip == RTC_CHIP_DS3231) ? ds3231.lostPower()
+                                             : (pcf8523.lostPower() || !pcf8523.initialized());
+  if (lostPower) {
+    LOG_WARN("[RTC] RTC lost power, waiting for NTP to set it");
+    pendingSet = true;
+    return true;
+  }
+  
+  // Wait for the seconds rollover so the time is known to a few ms,
+  // not just to the second (blocks for up to a second, at boot only)
+  uint64_t edgeUs;
+  if (!waitForRollover(edgeUs)) {
+    LOG_WARN("[RTC] RTC is not running");
+    pendingSet = true;
+    return true;
+  }
+  uint32_t epoch = readEpoch();
+  if (epoch < RTC_MIN_VALID_EPOCH) {
+    LOG_WARN("[RTC] RTC time %lu is not valid", (unsigned long)epoch);
+    pendingSet = true;
+    return true;
+  }
+  
+  LOG_DEBUG("[RTC] Trim register: %d", readTrim());
+  timeManager.setHoldoverTime((FixedTime)epoch << 32, edgeUs);
+  return true;
+}
+
+// Correction from NTP
+
+void RtcClock::startMeasurement() {
+  measuring = true;
+  measureStartUs = monotonicMicros();
+  lastReadUs = measureStartUs;
+  lastSeconds = readSeconds();
+}
+
+void RtcClock::update() {
+  if (!present || timeManager.getTimeSource() != TIME_SOURCE_NTP) return;
+  
+  // Look for the seconds rollover, one register read per loop
+  if (measuring) {
+    uint64_t readUs = monotonicMicros();
+    if (readSeconds() != lastSeconds) {
+      measuring = false;
+      finishMeasurement(lastReadUs + (readUs - lastReadUs) / 2);
+    } else if (readUs - measureStartUs > RTC_ROLLOVER_TIMEOUT_MS * 1000ULL) {
+      measuring = false;
+      haveReference = false;
+      LOG_WARN("[RTC] RTC is not running");
+      if (!verifyingSet) {
+        pendingSet = true;
+      }
+      verifyingSet = false;
+    }
+    lastReadUs = readUs;
+    return;
+  }
+  
+  // Just after a boundary the whole second written is within a few ms
+  if (pendingSet) {
+    if (timeManager.getMillisToNextSecond() >= 1000 - RTC_SET_WINDOW_MS) {
+      setTime();
+    }
+    return;
+  }
+  
+  // Compare against each new NTP sync
+  if (timeManager.getLastSyncTime() != handledSyncTime) {
+    handledSyncTime = timeManager.getLastSyncTime();
+    startMeasurement();
+  }
+}
+
+void RtcClock::finishMeasurement(uint64_t edgeUs) {
+  // The RTC second that started at the edge against the true time there
+  FixedTime trueTime = timeManager.getFixedTimeAt(edgeUs);
+  int64_t errorUs = (int64_t)readEpoch() * 1000000 - (int64_t)fixedToMicros(trueTime);
+  lastErrorUs = errorUs;
+  LOG_INFO("[RTC] Error against NTP: %ld ms", (long)getLastErrorMs());
+  
+  // Right after a write: the start of a new drift baseline
+  if (verifyingSet) {
+    verifyingSet = false;
+    haveReference = true;
+    referenceErrorUs = errorUs;
+    referenceTime = trueTime;
+    return;
+  }
+  
+  bool collecting = false;
+  if (!haveReference) {
+    haveReference = true;
+    referenceErrorUs = errorUs;
+    referenceTime = trueTime;
+  } else {
+    // Frequency error from how much the error grew since the baseline
+    int64_t intervalUs = (int64_t)(fixedToMicros(trueTime) - fixedToMicros(referenceTime));
+    int64_t growthUs = errorUs - referenceErrorUs;
+    if (intervalUs >= RTC_MIN_CALIBRATION_S * 1000000LL ||
+        (intervalUs > 0 && (growthUs >= RTC_MIN_CALIBRATION_ERROR_MS * 1000LL ||
+                            growthUs <= -RTC_MIN_CALIBRATION_ERROR_MS * 1000LL))) {
+      adjustTrim(growthUs * 1000000000LL / intervalUs);
+      referenceErrorUs = errorUs;
+      referenceTime = trueTime;
+    } else {
+      collecting = true;
+    }
+  }
+  
+  // Rewriting the time restarts the baseline, so allow more error while
+  // one is being collected
+  int64_t limitUs = (collecting ? RTC_MAX_BASELINE_ERROR_MS : RTC_MAX_ERROR_MS) * 1000LL;
+  if (errorUs > limitUs || errorUs < -limitUs) {
+    pendingSet = true;
+  }
+}
+
+void RtcClock::adjustTrim(int64_t fastPpb) {
+  int stepPpb = (chip == RTC_CHIP_DS3231) ? DS3231_AGING_PPB : PCF8523_OFFSET_PPB;
+  int steps = (int)((fastPpb >= 0 ? fastPpb + stepPpb / 2 : fastPpb - stepPpb / 2) / stepPpb);
+  int trim = readTrim();
+  if (steps == 0) {
+    LOG_INFO("[RTC] Running %ld ppb fast, trim %d kept", (long)fastPpb, trim);
+    return;
+  }
+  
+  int newTrim;
+  if (chip == RTC_CHIP_DS3231) {
+    newTrim = constrain(trim + steps, -128, 127);
+  } else {
+    newTrim = constrain(trim + steps, -64, 63);
+  }
+  writeTrim(newTrim);
+  LOG_INFO("[RTC] Running %ld ppb fast, trim %d -> %d", (long)fastPpb, trim, newTrim);
+}
+
+void RtcClock::setTime() {
+  FixedTime now = timeManager.getCurrentFixedTime();
+  DateTime dateTime((uint32_t)(now >> 32));
+  if (chip == RTC_CHIP_DS3231) {
+    ds3231.adjust(dateTime);
+  } else {
+    pcf8523.adjust(dateTime);
+    pcf8523.start();
+  }
+  LOG_INFO("[RTC] Time set to %lu", (unsigned long)dateTime.unixtime());
+  
+  // Measure straight away, the error after the write starts a new baseline
+  pendingSet = false;
+  haveReference = false;
+  verifyingSet = true;
+  startMeasurement();
+}
+
+// Status
+
+bool RtcClock::isPresent() {
+  return present;
+}
+
+bool RtcClock::isMeasuring() {
+  return measuring || (pendingSet && timeManager.getTimeSource() == TIME_SOURCE_NTP);
+}
+
+int32_t RtcClock::getLastErrorMs() {
+  return (int32_t)(lastErrorUs / 1000);
+}
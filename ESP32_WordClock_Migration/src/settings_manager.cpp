@@ -1,4 +1,6 @@
 #include "../include/settings_manager.h"
+#include "../include/civil_time.h"
+#include "../include/logger.h"
 
 // Global settings manager instance
 SettingsManager settingsManager;
@@ -7,6 +9,7 @@ SettingsManager settingsManager;
 const ClockSettings SettingsManager::defaultSettings = {
   -6,           // timezoneOffset: UTC-6 (CST)
   DST_US,       // dstRules: US DST rules
+  "",           // timezoneName: none, use offset and DST rules
   75,           // brightness: 75%
   true          // firstTimeSetup: true
 };
@@ -45,27 +48,28 @@ const int SettingsManager::timezoneCount = sizeof(SettingsManager::timezones) /
 // Constructor
 SettingsManager::SettingsManager() {
   currentSettings = defaultSettings;
+  updateTimezoneRule();
 }
 
 // Initialize the settings manager
 bool SettingsManager::initialize() {
-  Serial.println("[SETTINGS_MANAGER] Initializing...");
+  LOG_INFO("[SETTINGS_MANAGER] Initializing...");
   
   // Initialize preferences with namespace "clocksettings"
   if (!preferences.begin("clocksettings", false)) {
-    Serial.println("[SETTINGS_MANAGER] Failed to initialize preferences");
+    LOG_WARN("[SETTINGS_MANAGER] Failed to initialize preferences");
     return false;
   }
   
   // Load existing settings or use defaults
   if (!loadSettings()) {
-    Serial.println("[SETTINGS_MANAGER] No saved settings found, using defaults");
+    LOG_INFO("[SETTINGS_MANAGER] No saved settings found, using defaults");
     currentSettings = defaultSettings;
     saveSettings(); // Save defaults for next time
   }
   
-  Serial.printf("[SETTINGS_MANAGER] Initialized - Timezone: %d, DST: %d, Brightness: %d\n", 
-                currentSettings.timezoneOffset, currentSettings.dstRules, currentSettings.brightness);
+  LOG_INFO("[SETTINGS_MANAGER] Initialized - Timezone: %d, DST: %d, Brightness: %d",
+           currentSettings.timezoneOffset, currentSettings.dstRules, currentSettings.brightness);
   return true;
 }
 
@@ -76,11 +80,11 @@ void SettingsManager::cleanup() {
 
 // Load settings from flash memory
 bool SettingsManager::loadSettings() {
-  Serial.println("[SETTINGS_MANAGER] Loading settings from flash...");
+  LOG_DEBUG("[SETTINGS_MANAGER] Loading settings from flash...");
   
   // Check if settings exist
   if (!preferences.isKey("timezone")) {
-    Serial.println("[SETTINGS_MANAGER] No saved settings found");
+    LOG_INFO("[SETTINGS_MANAGER] No saved settings found");
     return false;
   }
   
@@ -89,50 +93,67 @@ bool SettingsManager::loadSettings() {
   int dstRules = preferences.getInt("dstRules", defaultSettings.dstRules);
   int brightness = preferences.getInt("brightness", defaultSettings.brightness);
   bool firstTime = preferences.getBool("firstTime", defaultSettings.firstTimeSetup);
+  char timezoneName[TZ_NAME_LENGTH] = "";
+  preferences.getString("tzName", timezoneName, sizeof(timezoneName));
   
   // Validate loaded values
   if (!isValidTimezoneOffset(timezone)) {
-    Serial.printf("[SETTINGS_MANAGER] Invalid timezone %d, using default\n", timezone);
+    LOG_WARN("[SETTINGS_MANAGER] Invalid timezone %d, using default", timezone);
     timezone = defaultSettings.timezoneOffset;
   }
   
   if (dstRules < DST_DISABLED || dstRules > DST_EU) {
-    Serial.printf("[SETTINGS_MANAGER] Invalid DST rules %d, using default\n", dstRules);
+    LOG_WARN("[SETTINGS_MANAGER] Invalid DST rules %d, using default", dstRules);
     dstRules = defaultSettings.dstRules;
   }
   
+  if (timezoneName[0] != '\0' && findTimezone(timezoneName) < 0) {
+    LOG_WARN("[SETTINGS_MANAGER] Unknown timezone %s, using offset", timezoneName);
+    timezoneName[0] = '\0';
+  }
+  
   if (!isValidBrightness(brightness)) {
-    Serial.printf("[SETTINGS_MANAGER] Invalid brightness %d, using default\n", brightness);
+    LOG_WARN("[SETTINGS_MANAGER] Invalid brightness %d, using default", brightness);
     brightness = defaultSettings.brightness;
   }
   
   // Apply loaded settings
   currentSettings.timezoneOffset = timezone;
   currentSettings.dstRules = (DSTRules)dstRules;
+  strcpy(currentSettings.timezoneName, timezoneName);
   currentSettings.brightness = brightness;
   currentSettings.firstTimeSetup = firstTime;
+  updateTimezoneRule();
   
-  Serial.printf("[SETTINGS_MANAGER] Settings loaded successfully\n");
+  LOG_INFO("[SETTINGS_MANAGER] Settings loaded successfully");
   return true;
 }
 
 // Save settings to flash memory
 bool SettingsManager::saveSettings() {
-  Serial.println("[SETTINGS_MANAGER] Saving settings to flash...");
+  LOG_DEBUG("[SETTINGS_MANAGER] Saving settings to flash...");
   
-  preferences.putInt("timezone", currentSettings.timezoneOffset);
-  preferences.putInt("dstRules", (int)currentSettings.dstRules);
-  preferences.putInt("brightness", currentSettings.brightness);
-  preferences.putBool("firstTime", currentSettings.firstTimeSetup);
+  // Each put returns the bytes written, 0 if the namespace is not open
+  // or the write failed; an empty zone name writes 0 bytes as well
+  bool written = preferences.putInt("timezone", currentSettings.timezoneOffset) != 0;
+  written &= preferences.putInt("dstRules", (int)currentSettings.dstRules) != 0;
+  preferences.putString("tzName", currentSettings.timezoneName);
+  written &= preferences.putInt("brightness", currentSettings.brightness) != 0;
+  written &= preferences.putBool("firstTime", currentSettings.firstTimeSetup) != 0;
+  if (!written) {
+    LOG_WARN("[SETTINGS_MANAGER] Failed to save settings");
+    return false;
+  }
   
-  Serial.printf("[SETTINGS_MANAGER] Settings saved successfully\n");
+  LOG_INFO("[SETTINGS_MANAGER] Settings saved successfully");
   return true;
 }
 
 // Reset to default settings
 void SettingsManager::resetToDefaults() {
-  Serial.println("[SETTINGS_MANAGER] Resetting to default settings");
+  LOG_INFO("[SETTINGS_MANAGER] Resetting to default settings");
   currentSettings = defaultSettings;
+  updateTimezoneRule();
   saveSettings();
 }
 
@@ -157,57 +178,78 @@ bool SettingsManager::isFirstTimeSetup() const {
   return currentSettings.firstTimeSetup;
 }
 
+const char* SettingsManager::getTimezoneName() const {
+  return currentSettings.timezoneName;
+}
+
+bool SettingsManager::hasTimezoneName() const {
+  return currentSettings.timezoneName[0] != '\0';
+}
+
 // Setters
 void SettingsManager::setTimezoneOffset(int offset) {
   if (isValidTimezoneOffset(offset)) {
     currentSettings.timezoneOffset = offset;
-    Serial.printf("[SETTINGS_MANAGER] Timezone offset set to %d\n", offset);
+    updateTimezoneRule();
+    LOG_INFO("[SETTINGS_MANAGER] Timezone offset set to %d", offset);
   } else {
-    Serial.printf("[SETTINGS_MANAGER] Invalid timezone offset %d ignored\n", offset);
+    LOG_WARN("[SETTINGS_MANAGER] Invalid timezone offset %d ignored", offset);
   }
 }
 
 void SettingsManager::setDSTRules(DSTRules rules) {
   if (rules >= DST_DISABLED && rules <= DST_EU) {
     currentSettings.dstRules = rules;
-    Serial.printf("[SETTINGS_MANAGER] DST rules set to %d\n", rules);
+    updateTimezoneRule();
+    LOG_INFO("[SETTINGS_MANAGER] DST rules set to %d", rules);
   } else {
-    Serial.printf("[SETTINGS_MANAGER] Invalid DST rules %d ignored\n", rules);
+    LOG_WARN("[SETTINGS_MANAGER] Invalid DST rules %d ignored", rules);
   }
 }
 
 void SettingsManager::setBrightness(int brightness) {
   if (isValidBrightness(brightness)) {
     currentSettings.brightness = brightness;
-    Serial.printf("[SETTINGS_MANAGER] Brightness set to %d\n", brightness);
+    LOG_INFO("[SETTINGS_MANAGER] Brightness set to %d", brightness);
   } else {
-    Serial.printf("[SETTINGS_MANAGER] Invalid brightness %d ignored\n", brightness);
+    LOG_WARN("[SETTINGS_MANAGER] Invalid brightness %d ignored", brightness);
   }
 }
 
 void SettingsManager::setFirstTimeSetup(bool firstTime) {
   currentSettings.firstTimeSetup = firstTime;
-  Serial.printf("[SETTINGS_MANAGER] First time setup set to %s\n", firstTime ? "true" : "false");
+  LOG_INFO("[SETTINGS_MANAGER] First time setup set to %s", firstTime ? "true" : "false");
+}
+
+void SettingsManager::setTimezoneName(const char* name) {
+  if (name[0] == '\0' || findTimezone(name) >= 0) {
+    strcpy(currentSettings.timezoneName, name);
+    updateTimezoneRule();
+    LOG_INFO("[SETTINGS_MANAGER] Timezone set to %s", name[0] ? name : "offset");
+  } else {
+    LOG_WARN("[SETTINGS_MANAGER] Unknown timezone %s ignored", name);
+  }
 }
 
 // Timezone helpers
-String SettingsManager::getTimezoneDisplayName(int offset) const {
+void SettingsManager::getTimezoneDisplayName(int offset, StringBuffer& out) const {
   for (int i = 0; i < timezoneCount; i++) {
     if (timezones[i].offset == offset) {
-      return String(timezones[i].name);
+      out = timezones[i].name;
+      return;
     }
   }
   
   // If not found in predefined list, create generic name
-  if (offset >= 0) {
-    return "UTC+" + String(offset);
-  } else {
-    return "UTC" + String(offset);
-  }
+  out.printf("UTC%+d", offset);
 }
 
-String SettingsManager::getCurrentTimezoneDisplayName() const {
-  return getTimezoneDisplayName(currentSettings.timezoneOffset);
+void SettingsManager::getCurrentTimezoneDisplayName(StringBuffer& out) const {
+  if (hasTimezoneName()) {
+    out = currentSettings.timezoneName;
+  } else {
+    getTimezoneDisplayName(currentSettings.timezoneOffset, out);
+  }
 }
 
 int SettingsManager::getNextTimezoneOffset(int currentOffset) const {
@@ -230,8 +272,109 @@ int SettingsManager::getPreviousTimezoneOffset(int currentOffset) const {
   return timezones[timezoneCount - 1].offset;
 }
 
+void SettingsManager::selectNextTimezone() {
+  if (hasTimezoneName()) {
+    int index = findTimezone(currentSettings.timezoneName);
+    if (index >= 0 && index + 1 < getTimezoneCount()) {
+      setTimezoneName(getTimezone(index + 1).name);
+    } else {
+      // Past the last zone, wrap to the first offset
+      setTimezoneName("");
+      setTimezoneOffset(timezones[0].offset);
+    }
+  } else if (currentSettings.timezoneOffset == timezones[timezoneCount - 1].offset) {
+    setTimezoneName(getTimezone(0).name);
+  } else {
+    setTimezoneOffset(getNextTimezoneOffset(currentSettings.timezoneOffset));
+  }
+}
+
 // DST helpers
-String SettingsManager::getDSTRulesDisplayName(DSTRules rules) const {
+
+// Build the rule for the selected zone, or from the offset and DST
+// rules settings, and drop the cached transitions
+void SettingsManager::updateTimezoneRule() {
+  int index = hasTimezoneName() ? findTimezone(currentSettings.timezoneName) : -1;
+  
+  if (index < 0 || !parseTZRule(getTimezone(index).rule, activeRule)) {
+    activeRule.stdOffset = currentSettings.timezoneOffset * 3600;
+    activeRule.dstOffset = activeRule.stdOffset + 3600;
+    activeRule.hasDST = currentSettings.dstRules != DST_DISABLED;
+    if (currentSettings.dstRules == DST_US) {
+      // 02:00 local time: second Sunday in March, first Sunday in November
+      activeRule.start = {'M', 3, 2, 0, 0, 2 * 3600};
+      activeRule.end = {'M', 11, 1, 0, 0, 2 * 3600};
+    } else {
+      // 01:00 UTC: last Sunday in March and October
+      activeRule.start = {'M', 3, 5, 0, 0, 3600 + activeRule.stdOffset};
+      activeRule.end = {'M', 10, 5, 0, 0, 3600 + activeRule.dstOffset};
+    }
+  }
+  
+  dstYear = 0;
+  offsetValidFrom = INT64_MAX;
+  offsetValidUntil = INT64_MIN;
+}
+
+void SettingsManager::computeDSTTransitions(int year) {
+  int count = 0;
+  
+  for (int y = year; y <= year + 1; y++) {
+    int64_t start = getTZTransitionTime(activeRule.start, y, activeRule.stdOffset);
+    int64_t end = getTZTransitionTime(activeRule.end, y, activeRule.dstOffset);
+    
+    // Insert in time order; southern hemisphere zones end DST first
+    for (int k = 0; k < 2; k++) {
+      int64_t when = k ? end : start;
+      int i = count++;
+      while (i > 0 && dstTransitions[i - 1] > when) {
+        dstTransitions[i] = dstTransitions[i - 1];
+        dstAfter[i] = dstAfter[i - 1];
+        i--;
+      }
+      dstTransitions[i] = when;
+      dstAfter[i] = (k == 0);
+    }
+  }
+  dstYear = year;
+  
+  LOG_DEBUG("[SETTINGS_MANAGER] DST transitions for %d-%d computed", year, year + 1);
+}
+
+// Normally a single range check; the transition table is only consulted
+// when utc leaves the cached range (a DST change, resync or new settings)
+int SettingsManager::getUTCOffsetAt(int64_t utc) {
+  if (utc >= offsetValidFrom && utc < offsetValidUntil) {
+    return cachedOffset;
+  }
+  
+  if (!activeRule.hasDST) {
+    cachedOffset = activeRule.stdOffset;
+    offsetValidFrom = INT64_MIN;
+    offsetValidUntil = INT64_MAX;
+    return cachedOffset;
+  }
+  
+  int year = civilFromDays(daysFromEpoch(utc)).year;
+  if (year != dstYear) {
+    computeDSTTransitions(year);
+  }
+  
+  // The next transition always lies within this year or the next
+  int next = 0;
+  while (next < 3 && utc >= dstTransitions[next]) {
+    next++;
+  }
+  
+  // Before the first transition the opposite of its new state holds
+  bool dst = next > 0 ? dstAfter[next - 1] : !dstAfter[0];
+  cachedOffset = dst ? activeRule.dstOffset : activeRule.stdOffset;
+  offsetValidFrom = next > 0 ? dstTransitions[next - 1] : daysFromCivil(year, 1, 1) * 86400;
+  offsetValidUntil = dstTransitions[next];
+  return cachedOffset;
+}
+
+const char* SettingsManager::getDSTRulesDisplayName(DSTRules rules) const {
   switch (rules) {
     case DST_DISABLED: return "Disabled";
     case DST_US: return "US Rules";
@@ -259,9 +402,13 @@ bool SettingsManager::isValidBrightness(int brightness) const {
 }
 
 // Status
-String SettingsManager::getStatusString() const {
-  String status = "TZ: " + getCurrentTimezoneDisplayName();
-  status += ", DST: " + getDSTRulesDisplayName(currentSettings.dstRules);
-  status += ", Brightness: " + String(currentSettings.brightness) + "%";
-  return status;
+void SettingsManager::getStatusString(StringBuffer& out) const {
+  out = "TZ: ";
+  StaticString<TZ_NAME_LENGTH> timezone;
+  getCurrentTimezoneDisplayName(timezone);
+  out.append(timezone.c_str());
+  if (!hasTimezoneName()) {
+    out.appendf(", DST: %s", getDSTRulesDisplayName(currentSettings.dstRules));
+  }
+  out.appendf(", Brightness: %d%%", currentSettings.brightness);
 }
@@ -1,121 +1,200 @@
 #include "../include/state_machine.h"
 #include "../include/wifi_manager.h"
+#include "../include/logger.h"
+#include "../include/perf_counters.h"
+#include "../include/telemetry.h"
+
+// Screen timings
+#define LOGO_DISPLAY_MS 4000
+#define STARTUP_MESSAGE_MS 3000
+#define SYNC_SUCCESS_MS 1000      // Result shown before the clock
+#define SYNC_FAILURE_MS 2000
+
+#define SETTINGS_COUNT 3          // Timezone, DST Rules, Brightness (then Save & Exit)
+
+// Clock screens redraw on their tick and when a background sync finishes
+#define CLOCK_WAKE (EVENT_BIT(EVENT_TICK) | EVENT_BIT(EVENT_NTP))
 
 // Character set for password entry
 const char StateMachine::characterSet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789!@#$%^&*()_+-=[]{}|;:,.<>? ";
 const int StateMachine::characterSetSize = sizeof(StateMachine::characterSet) - 1; // -1 to exclude null terminator
 
+// State table. Null hooks do nothing; without onInput, buttons go
+// straight to the transition table.
+const StateMachine::StateDef StateMachine::states[] = {
+  // state                   name                 onEnter                                 onTick                                onInput                                onExit                                 wakeOn
+  {STATE_INIT,              "INIT",              &StateMachine::enterInit,               nullptr,                              nullptr,                               nullptr,                               0},
+  {STATE_LOGO_DISPLAY,      "LOGO_DISPLAY",      &StateMachine::enterLogo,               &StateMachine::finish,                nullptr,                               nullptr,                               0},
+  {STATE_STARTUP_MESSAGE,   "STARTUP_MESSAGE",   &StateMachine::enterStartupMessage,     &StateMachine::tickStartupMessage,    nullptr,                               nullptr,                               0},
+  {STATE_WIFI_SCAN,         "WIFI_SCAN",         &StateMachine::enterWiFiScan,           &StateMachine::tickNetworkJob,        nullptr,                               nullptr,                               EVENT_BIT(EVENT_NETWORK)},
+  {STATE_WIFI_DISPLAY,      "WIFI_DISPLAY",      &StateMachine::enterWiFiDisplay,        nullptr,                              &StateMachine::inputWiFiDisplay,       nullptr,                               0},
+  {STATE_PASSWORD_ENTRY,    "PASSWORD_ENTRY",    &StateMachine::enterPasswordEntry,      nullptr,                              &StateMachine::inputPasswordEntry,     nullptr,                               0},
+  {STATE_WIFI_CONNECTING,   "WIFI_CONNECTING",   &StateMachine::enterWiFiConnecting,     &StateMachine::tickNetworkJob,        nullptr,                               nullptr,                               EVENT_BIT(EVENT_NETWORK)},
+  {STATE_WIFI_SUCCESS,      "WIFI_SUCCESS",      &StateMachine::enterWiFiSuccess,        nullptr,                              &StateMachine::inputWiFiSuccess,       nullptr,                               0},
+  {STATE_WIFI_FAILURE,      "WIFI_FAILURE",      &StateMachine::enterWiFiFailure,        nullptr,                              nullptr,                               nullptr,                               0},
+  {STATE_WIFI_CONNECT,      "WIFI_CONNECT",      &StateMachine::finish,                  nullptr,                              nullptr,                               nullptr,                               0},
+  {STATE_SETTINGS,          "SETTINGS",          &StateMachine::enterSettings,           nullptr,                              &StateMachine::inputSettings,          nullptr,                               0},
+  {STATE_TIME_SYNC,         "TIME_SYNC",         &StateMachine::enterTimeSync,           &StateMachine::tickTimeSync,          nullptr,                               nullptr,                               EVENT_BIT(EVENT_NTP)},
+  {STATE_CLOCK_DISPLAY,     "CLOCK_DISPLAY",     &StateMachine::enterClockDisplay,       &StateMachine::tickClockDisplay,      &StateMachine::inputClockDisplay,      nullptr,                               CLOCK_WAKE},
+  {STATE_WORDCLOCK_DISPLAY, "WORDCLOCK_DISPLAY", &StateMachine::enterWordClockDisplay,   &StateMachine::tickWordClockDisplay,  &StateMachine::inputClockDisplay,      &StateMachine::exitWordClockDisplay,   CLOCK_WAKE},
+};
+
+// Transition table: (state, input) -> next state. Inputs without a row
+// leave the state unchanged.
+const StateMachine::Transition StateMachine::transitions[] = {
+  {STATE_INIT,              INPUT_DONE,     STATE_LOGO_DISPLAY},
+  {STATE_INIT,              INPUT_SKIP,     STATE_CLOCK_DISPLAY},      // Time kept over a reset: no intro
+  {STATE_LOGO_DISPLAY,      INPUT_DONE,     STATE_STARTUP_MESSAGE},
+  {STATE_STARTUP_MESSAGE,   INPUT_DONE,     STATE_WIFI_SCAN},
+  {STATE_STARTUP_MESSAGE,   INPUT_SKIP,     STATE_CLOCK_DISPLAY},      // RTC has the time, WiFi from the clock (B)
+  {STATE_WIFI_SCAN,         INPUT_DONE,     STATE_WIFI_DISPLAY},
+  {STATE_WIFI_DISPLAY,      INPUT_DONE,     STATE_PASSWORD_ENTRY},     // B on a secured network
+  {STATE_WIFI_DISPLAY,      INPUT_SKIP,     STATE_WIFI_CONNECTING},    // B on an open network
+  {STATE_WIFI_DISPLAY,      INPUT_BUTTON_C, STATE_WIFI_SCAN},          // Rescan
+  {STATE_PASSWORD_ENTRY,    INPUT_BUTTON_C, STATE_WIFI_CONNECTING},    // Submit
+  {STATE_WIFI_CONNECTING,   INPUT_DONE,     STATE_WIFI_SUCCESS},
+  {STATE_WIFI_CONNECTING,   INPUT_FAILED,   STATE_WIFI_FAILURE},
+  {STATE_WIFI_SUCCESS,      INPUT_DONE,     STATE_SETTINGS},           // First time setup
+  {STATE_WIFI_SUCCESS,      INPUT_SKIP,     STATE_TIME_SYNC},          // Settings already configured
+  {STATE_WIFI_FAILURE,      INPUT_BUTTON_A, STATE_WIFI_CONNECTING},    // Retry with the same password
+  {STATE_WIFI_FAILURE,      INPUT_BUTTON_B, STATE_PASSWORD_ENTRY},     // New password
+  {STATE_WIFI_FAILURE,      INPUT_BUTTON_C, STATE_WIFI_DISPLAY},       // Back to network selection
+  {STATE_WIFI_CONNECT,      INPUT_DONE,     STATE_WIFI_DISPLAY},       // Not implemented yet
+  {STATE_SETTINGS,          INPUT_DONE,     STATE_TIME_SYNC},          // Saved
+  {STATE_SETTINGS,          INPUT_CANCEL,   STATE_CLOCK_DISPLAY},      // Changes discarded
+  {STATE_TIME_SYNC,         INPUT_DONE,     STATE_CLOCK_DISPLAY},      // Synced, or failed and the clock retries
+  {STATE_TIME_SYNC,         INPUT_FAILED,   STATE_WIFI_FAILURE},       // No network
+  {STATE_CLOCK_DISPLAY,     INPUT_BUTTON_A, STATE_SETTINGS},
+  {STATE_CLOCK_DISPLAY,     INPUT_BUTTON_C, STATE_WORDCLOCK_DISPLAY},
+  {STATE_CLOCK_DISPLAY,     INPUT_NO_WIFI,  STATE_WIFI_SCAN},
+  {STATE_WORDCLOCK_DISPLAY, INPUT_BUTTON_A, STATE_SETTINGS},
+  {STATE_WORDCLOCK_DISPLAY, INPUT_BUTTON_C, STATE_CLOCK_DISPLAY},
+  {STATE_WORDCLOCK_DISPLAY, INPUT_NO_WIFI,  STATE_WIFI_SCAN},
+};
+
 // Constructor
 StateMachine::StateMachine(Adafruit_ST7789& tftDisplay, Adafruit_NeoMatrix& neoMatrix)
-  : tft(tftDisplay), matrix(neoMatrix), currentState(STATE_INIT), previousState(STATE_INIT), 
-    displayNeedsUpdate(true), stateChanged(false), currentPassword(""), passwordPosition(0), currentCharIndex(0) {
+  : currentState(STATE_INIT), previousState(STATE_INIT), deadlineUs(0),
+    wordClockStarted(false), tft(tftDisplay), matrix(neoMatrix) {
+  passwordEntry.charIndex = 0;
+  settingsMenu.index = 0;
+  timeSync.finished = false;
 }
 
-// State management methods
-void StateMachine::changeState(SystemState newState) {
-  if (newState != currentState) {
-    previousState = currentState;
-    currentState = newState;
-    stateChanged = true;
-    displayNeedsUpdate = true;
-    Serial.printf("State transition: %d -> %d\n", previousState, currentState);
+void StateMachine::begin() {
+  static_assert(sizeof(states) / sizeof(states[0]) == STATE_COUNT, "One state table row per SystemState");
+  for (int i = 0; i < STATE_COUNT; i++) {
+    if (states[i].state != i) {
+      LOG_WARN("[STATE_MACHINE] State table row %d is out of order", i);
+    }
+  }
+
+  LOG_INFO("[STATE_MACHINE] Start in %s, Free Heap: %d", states[currentState].name, ESP.getFreeHeap());
+  StateInput input;
+  {
+    PERF_SCOPE(PERF_STATE_ENTER);
+    input = (this->*states[currentState].onEnter)();
   }
+  dispatch(input);
 }
 
-void StateMachine::handleWordClockDisplayState() {
-  Serial.printf("[STATE_WORDCLOCK_DISPLAY] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Initialize WordClock on first entry
-  static bool wordClockInitialized = false;
-  if (stateChanged && !wordClockInitialized) {
-    Serial.println("[WORDCLOCK_DISPLAY] Initializing WordClock...");
-    showWordClockStartup(matrix);
-    wordClockInitialized = true;
-  }
-  
-  // Update display when needed
-  static unsigned long lastDisplayUpdate = 0;
-  unsigned long currentTime = millis();
-  
-  if (stateChanged || displayNeedsUpdate || (currentTime - lastDisplayUpdate > 1000)) {
-    // Get current time from time manager
-    if (timeManager.getSyncStatus() == TIME_SYNC_SUCCESS) {
-      // Create a tm struct from TimeManager data
-      struct tm timeinfo;
-      timeinfo.tm_hour = timeManager.getHours();
-      timeinfo.tm_min = timeManager.getMinutes();
-      timeinfo.tm_sec = timeManager.getSeconds();
-      timeinfo.tm_mday = timeManager.getDay();
-      timeinfo.tm_mon = timeManager.getMonth() - 1; // tm_mon is 0-based
-      timeinfo.tm_year = timeManager.getYear() - 1900; // tm_year is years since 1900
-      
-      // Display WordClock mode (TFT shows status, matrix shows time as words)
-      displayWordClockMode(tft, matrix, &timeinfo);
-      
-      lastDisplayUpdate = currentTime;
-      stateChanged = false;
-      displayNeedsUpdate = false;
-      
-      Serial.printf("[WORDCLOCK_DISPLAY] Time: %02d:%02d:%02d\n", 
-                    timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-    } else {
-      // Time not synced, show error on TFT
-      clearTFTScreen(tft);
-      tft.setTextColor(ST77XX_RED);
-      tft.setTextSize(2);
-      tft.setCursor(10, 50);
-      tft.println("Time Not Synced");
-      tft.setTextSize(1);
-      tft.setCursor(10, 80);
-      tft.println("Press B to sync time");
+// Transition machinery
+void StateMachine::update(uint32_t events) {
+  PERF_SCOPE(PERF_STATE_UPDATE);
+
+  // Buttons: every gesture decoded since the last pass
+  ButtonEvent event;
+  while (nextButtonEvent(event)) {
+    PERF_COUNT(PERF_COUNT_BUTTON_EVENTS);
+    StateInput input = buttonInput(event);
+    const StateDef& def = states[currentState];
+    if (def.onInput) {
+      PERF_SCOPE(PERF_STATE_INPUT);
+      input = (this->*def.onInput)(input);
     }
+    dispatch(input);
   }
-  
-  // Handle button inputs for navigation and settings
-  ButtonEvent buttonEvent = handleButtons();
-  switch (buttonEvent) {
-    case BUTTON_A_PRESSED:
-      // Go to settings menu
-      Serial.println("Settings button pressed - going to settings");
-      changeState(STATE_SETTINGS);
-      break;
-      
-    case BUTTON_B_PRESSED:
-      // Force time sync
-      Serial.println("Force sync button pressed");
-      if (timeManager.forceSync()) {
-        Serial.println("Time sync successful!");
-        displayNeedsUpdate = true;
-      } else {
-        Serial.println("Time sync failed!");
-        displayNeedsUpdate = true;
-      }
-      break;
-      
-    case BUTTON_C_PRESSED:
-      // Switch back to regular clock display
-      Serial.println("Switching to regular clock display");
-      changeState(STATE_CLOCK_DISPLAY);
-      break;
-      
-    case NO_BUTTON:
-      // Stay in WordClock display state
-      break;
+
+  // Tick on the deadline, on the events the state follows, and on every
+  // pass while it follows an NTP sync in flight (replies post no event)
+  const StateDef& def = states[currentState];
+  if (!def.onTick) return;
+
+  bool due = false;
+  if (deadlineUs != 0) {
+    uint64_t nowUs = monotonicMicros();
+    if (nowUs >= deadlineUs) {
+      deadlineUs = 0;
+      due = true;
+    } else if (events & EVENT_BIT(EVENT_FRAME)) {
+      // An earlier frame (someone else's, or a left state's) took the
+      // timer: ask again for ours
+      eventLoop.requestFrame((uint32_t)((deadlineUs - nowUs + 999) / 1000));
+    }
   }
-  
-  // Check if time sync is needed periodically
-  if (timeManager.needsTimeSync()) {
-    Serial.println("[WORDCLOCK_DISPLAY] Time sync needed, attempting sync...");
-    if (timeManager.syncTime()) {
-      Serial.println("[WORDCLOCK_DISPLAY] Background sync successful");
-      displayNeedsUpdate = true;
+  bool syncing = (def.wakeOn & EVENT_BIT(EVENT_NTP)) && timeManager.isSyncing();
+
+  if (due || (events & def.wakeOn) || syncing) {
+    StateInput input;
+    {
+      PERF_SCOPE(PERF_STATE_TICK);
+      input = (this->*def.onTick)();
+    }
+    dispatch(input);
+  }
+}
+
+StateInput StateMachine::buttonInput(const ButtonEvent& event) {
+  static const StateInput firstInput[] = {INPUT_BUTTON_A, INPUT_DOUBLE_A, INPUT_LONG_A, INPUT_REPEAT_A};  // By ButtonGesture
+  return (StateInput)(firstInput[event.gesture] + event.button);
+}
+
+// Follow the table until a state waits: entering may finish at once
+// (a scan, a connection attempt)
+void StateMachine::dispatch(StateInput input) {
+  while (input != INPUT_NONE) {
+    const Transition* match = nullptr;
+    for (size_t i = 0; i < sizeof(transitions) / sizeof(transitions[0]); i++) {
+      if (transitions[i].state == currentState && transitions[i].input == input) {
+        match = &transitions[i];
+        break;
+      }
+    }
+    if (!match) return;  // Not handled in this state
+
+    enterState(match->next);
+    const StateDef& def = states[currentState];
+    if (def.onEnter) {
+      PERF_SCOPE(PERF_STATE_ENTER);
+      input = (this->*def.onEnter)();
     } else {
-      Serial.println("[WORDCLOCK_DISPLAY] Background sync failed");
+      input = INPUT_NONE;
     }
   }
 }
 
+void StateMachine::enterState(SystemState newState) {
+  const StateDef& from = states[currentState];
+  if (from.onExit) {
+    (this->*from.onExit)();
+  }
+
+  previousState = currentState;
+  currentState = newState;
+  PERF_COUNT(PERF_COUNT_TRANSITIONS);
+  telemetry.sendState(previousState, currentState);
+  deadlineUs = 0;
+  LOG_INFO("State transition: %s -> %s, Free Heap: %d, Min Free: %d",
+                states[previousState].name, states[currentState].name,
+                ESP.getFreeHeap(), ESP.getMinFreeHeap());
+}
+
+// Tick the current state once delayMs has passed; replaces any earlier deadline
+void StateMachine::setDeadline(uint32_t delayMs) {
+  deadlineUs = monotonicMicros() + delayMs * 1000ULL;
+  eventLoop.requestFrame(delayMs);
+}
+
 SystemState StateMachine::getCurrentState() const {
   return currentState;
 }
@@ -124,588 +203,505 @@ SystemState StateMachine::getPreviousState() const {
   return previousState;
 }
 
-bool StateMachine::hasStateChanged() const {
-  return stateChanged;
+StateInput StateMachine::finish() {
+  return INPUT_DONE;
 }
 
-bool StateMachine::needsDisplayUpdate() const {
-  return displayNeedsUpdate;
+// Startup
+StateInput StateMachine::enterInit() {
+  // Restarted with the time kept in RTC memory: no intro, show the clock
+  if (timeManager.getTimeSource() == TIME_SOURCE_RETAINED) {
+    return INPUT_SKIP;
+  }
+  return INPUT_DONE;
 }
 
-void StateMachine::clearStateChanged() {
-  stateChanged = false;
+StateInput StateMachine::enterLogo() {
+  displayClockLogo(tft);
+  setDeadline(LOGO_DISPLAY_MS);
+  return INPUT_NONE;
 }
 
-void StateMachine::setDisplayNeedsUpdate(bool needsUpdate) {
-  displayNeedsUpdate = needsUpdate;
+StateInput StateMachine::enterStartupMessage() {
+  displayStartupMessage(tft);
+  setDeadline(STARTUP_MESSAGE_MS);
+  return INPUT_NONE;
 }
 
-// Main state machine update method
-void StateMachine::update() {
-  switch (currentState) {
-    case STATE_INIT:
-      handleInitState();
-      break;
-      
-    case STATE_LOGO_DISPLAY:
-      handleLogoDisplayState();
-      break;
-      
-    case STATE_STARTUP_MESSAGE:
-      handleStartupMessageState();
-      break;
-      
-    case STATE_WIFI_SCAN:
-      handleWiFiScanState();
-      break;
-      
-    case STATE_WIFI_DISPLAY:
-      handleWiFiDisplayState();
-      break;
-      
-    case STATE_PASSWORD_ENTRY:
-      handlePasswordEntryState();
-      break;
-      
-    case STATE_WIFI_CONNECTING:
-      handleWiFiConnectingState();
-      break;
-      
-    case STATE_WIFI_SUCCESS:
-      handleWiFiSuccessState();
-      break;
-      
-    case STATE_WIFI_FAILURE:
-      handleWiFiFailureState();
-      break;
-      
-    case STATE_WIFI_CONNECT:
-      handleWiFiConnectState();
-      break;
-      
-    case STATE_SETTINGS:
-      handleSettingsState();
-      break;
-      
-    case STATE_TIME_SYNC:
-      handleTimeSyncState();
-      break;
-      
-    case STATE_CLOCK_DISPLAY:
-      handleClockDisplayState();
-      break;
-      
-    case STATE_WORDCLOCK_DISPLAY:
-      handleWordClockDisplayState();
-      break;
+StateInput StateMachine::tickStartupMessage() {
+  if (timeManager.getTimeSource() == TIME_SOURCE_RTC) {
+    // RTC kept the time: show it now, WiFi is set up from the clock (B)
+    LOG_INFO("[STARTUP_MESSAGE] Time from RTC - skipping WiFi setup");
+    return INPUT_SKIP;
   }
+  return INPUT_DONE;
 }
 
-// State-specific handlers
-void StateMachine::handleInitState() {
-  Serial.printf("[STATE_INIT] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Initialization complete, move to logo display
-  changeState(STATE_LOGO_DISPLAY);
+// WiFi setup
+// Scan and connect run on the network task; the screen stays live and
+// EVENT_NETWORK brings the result
+StateInput StateMachine::enterWiFiScan() {
+  LOG_DEBUG("[WIFI_SCAN] Before scan - Free Heap: %d", ESP.getFreeHeap());
+  if (!networkTask.startScan()) {
+    LOG_WARN("[WIFI_SCAN] Network busy, waiting");
+  }
+  return INPUT_NONE;
 }
 
-void StateMachine::handleLogoDisplayState() {
-  Serial.printf("[STATE_LOGO_DISPLAY] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Display logo only once when entering this state
-  if (stateChanged || displayNeedsUpdate) {
-    displayClockLogo(tft);
-    stateChanged = false;
-    displayNeedsUpdate = false;
-  }
-  
-  // Use static variable to track timing for this state
-  static unsigned long logoStartTime = 0;
-  
-  // Initialize timer on first entry
-  if (logoStartTime == 0) {
-    logoStartTime = millis();
-  }
-  
-  // Check if 4 seconds have elapsed
-  if (millis() - logoStartTime >= 4000) {
-    logoStartTime = 0; // Reset for next time
-    changeState(STATE_STARTUP_MESSAGE);
-  }
-}
-
-void StateMachine::handleStartupMessageState() {
-  Serial.printf("[STATE_STARTUP_MESSAGE] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Display startup message only once when entering this state
-  if (stateChanged || displayNeedsUpdate) {
-    displayStartupMessage(tft);
-    stateChanged = false;
-    displayNeedsUpdate = false;
-  }
-  
-  // Use static variable to track timing for this state
-  static unsigned long messageStartTime = 0;
-  
-  // Initialize timer on first entry
-  if (messageStartTime == 0) {
-    messageStartTime = millis();
-  }
-  
-  // Check if 3 seconds have elapsed
-  if (millis() - messageStartTime >= 3000) {
-    messageStartTime = 0; // Reset for next time
-    changeState(STATE_WIFI_SCAN);
-  }
-}
-
-void StateMachine::handleWiFiScanState() {
-  Serial.printf("[STATE_WIFI_SCAN] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Perform WiFi scan only once per state entry
-  if (stateChanged || displayNeedsUpdate) {
-    Serial.printf("[WIFI_SCAN] Before scan - Free Heap: %d\n", ESP.getFreeHeap());
-    scanWiFiNetworks();
-    Serial.printf("[WIFI_SCAN] After scan - Free Heap: %d\n", ESP.getFreeHeap());
-    stateChanged = false;
-    displayNeedsUpdate = true; // Will need to display results
+StateInput StateMachine::tickNetworkJob() {
+  switch (networkTask.getState()) {
+    case NETWORK_DONE:
+      return INPUT_DONE;
+    case NETWORK_FAILED:
+      return INPUT_FAILED;
+    default:
+      return INPUT_NONE;
   }
-  changeState(STATE_WIFI_DISPLAY);
 }
 
-void StateMachine::handleWiFiDisplayState() {
-  Serial.printf("[STATE_WIFI_DISPLAY] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Handle button inputs
-  ButtonEvent buttonEvent = handleButtons();
-  
-  // Display current network and handle navigation
+StateInput StateMachine::enterWiFiDisplay() {
   if (getNetworkCount() > 0) {
-    // Only update display when needed
-    if (displayNeedsUpdate || stateChanged) {
-      Serial.printf("[WIFI_DISPLAY] Before display - Free Heap: %d\n", ESP.getFreeHeap());
-      // Get current network info from wifi_manager
-      WiFiNetworkInfo networkInfo = getCurrentNetworkInfo();
-      // Display it using display_manager with current index and total count
-      displayCurrentNetwork(tft, matrix, networkInfo, currentNetwork, getNetworkCount());
-      Serial.printf("[WIFI_DISPLAY] After display - Free Heap: %d\n", ESP.getFreeHeap());
-      displayNeedsUpdate = false;
-      stateChanged = false;
-    }
-    
-    // Handle button events
-    switch (buttonEvent) {
-      case BUTTON_A_PRESSED:
-        nextNetwork();
-        displayNeedsUpdate = true;  // Network changed, need to update display
-        break;
-      case BUTTON_B_PRESSED:
-        {
-          selectCurrentNetwork();
-          // Check if network is open (no password required)
-          WiFiNetworkInfo networkInfo = getCurrentNetworkInfo();
-          if (networkInfo.encryption == WIFI_AUTH_OPEN) {
-            // Open network - set empty password and go to connecting state
-            Serial.println("Open network detected - connecting directly");
-            currentPassword = "";
-            changeState(STATE_WIFI_CONNECTING);
-          } else {
-            // Secured network - go to password entry
-            currentPassword = "";
-            passwordPosition = 0;
-            currentCharIndex = 0;
-            changeState(STATE_PASSWORD_ENTRY);
-          }
-        }
-        break;
-      case BUTTON_C_PRESSED:
-        changeState(STATE_WIFI_SCAN);  // Rescan
-        break;
-      case NO_BUTTON:
-        // Stay in display state - no update needed
-        break;
-    }
+    // Show all scanned networks with the current one highlighted
+    displayNetworkList(tft, matrix, currentNetwork, getNetworkCount());
   }
+  return INPUT_NONE;
 }
 
-void StateMachine::handleWiFiConnectState() {
-  // Future: Connect to selected WiFi network
-  Serial.println("WiFi Connect state - Not implemented yet");
-  changeState(STATE_WIFI_DISPLAY);
-}
+StateInput StateMachine::inputWiFiDisplay(StateInput input) {
+  if (getNetworkCount() == 0) {
+    // Nothing to pick: only a rescan
+    return input == INPUT_BUTTON_C ? input : INPUT_NONE;
+  }
 
-void StateMachine::handleTimeSyncState() {
-  Serial.printf("[STATE_TIME_SYNC] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Initialize time manager on first entry
-  static bool timeManagerInitialized = false;
-  if (stateChanged || displayNeedsUpdate) {
-    if (!timeManagerInitialized) {
-      Serial.println("[TIME_SYNC] Initializing time manager...");
-      if (timeManager.initialize()) {
-        timeManagerInitialized = true;
-        Serial.println("[TIME_SYNC] Time manager initialized successfully");
-      } else {
-        Serial.println("[TIME_SYNC] Failed to initialize time manager");
-        changeState(STATE_WIFI_FAILURE);
-        return;
+  switch (input) {
+    case INPUT_BUTTON_A:
+    case INPUT_REPEAT_A:  // Hold A to scroll
+      nextNetwork();
+      displayNetworkList(tft, matrix, currentNetwork, getNetworkCount());
+      return INPUT_NONE;
+
+    case INPUT_BUTTON_B:
+      {
+        selectCurrentNetwork();
+        // Check if network is open (no password required)
+        WiFiNetworkInfo networkInfo = getCurrentNetworkInfo();
+        if (networkInfo.encryption == WIFI_AUTH_OPEN) {
+          LOG_INFO("Open network detected - connecting directly");
+          passwordEntry.password = "";
+          return INPUT_SKIP;
+        }
+        return INPUT_DONE;
       }
-    }
-    
-    // Display sync status
-    displayTimeSyncStatus(tft, timeManager.getStatusString());
-    stateChanged = false;
-    displayNeedsUpdate = false;
-  }
-  
-  // Attempt time sync if not already synced
-  if (timeManager.getSyncStatus() == TIME_NOT_SYNCED || 
-      timeManager.getSyncStatus() == TIME_SYNC_FAILED) {
-    
-    Serial.println("[TIME_SYNC] Attempting NTP sync...");
-    if (timeManager.syncTime()) {
-      Serial.println("[TIME_SYNC] Time sync successful!");
-      // Brief delay to show success message
-      delay(1000);
-      changeState(STATE_CLOCK_DISPLAY);
-    } else {
-      Serial.println("[TIME_SYNC] Time sync failed!");
-      // Show failure for a moment, then retry or continue
-      displayTimeSyncStatus(tft, "Sync Failed");
-      delay(2000);
-      
-      // For now, continue to clock display even if sync failed
-      // In the future, could add retry logic or fallback
-      changeState(STATE_CLOCK_DISPLAY);
-    }
-  } else if (timeManager.getSyncStatus() == TIME_SYNC_SUCCESS) {
-    // Already synced, move to clock display
-    changeState(STATE_CLOCK_DISPLAY);
+
+    default:
+      return input;
   }
 }
 
-void StateMachine::handlePasswordEntryState() {
-  Serial.printf("[STATE_PASSWORD_ENTRY] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Handle button inputs
-  ButtonEvent buttonEvent = handleButtons();
-  
-  // Display password entry screen when needed
-  if (displayNeedsUpdate || stateChanged) {
-    displayPasswordEntry(tft, matrix, getSelectedSSID(), currentPassword, characterSet[currentCharIndex]);
-    
-    displayNeedsUpdate = false;
-    stateChanged = false;
-  }
-  
-  // Handle button events
-  switch (buttonEvent) {
-    case BUTTON_A_PRESSED:
-      // Cycle through characters
-      currentCharIndex = (currentCharIndex + 1) % characterSetSize;
-      displayNeedsUpdate = true;
-      Serial.printf("Character changed to: %c\n", characterSet[currentCharIndex]);
-      break;
-      
-    case BUTTON_B_PRESSED:
+StateInput StateMachine::enterPasswordEntry() {
+  passwordEntry.password = "";
+  passwordEntry.charIndex = 0;
+  drawPasswordEntry();
+  return INPUT_NONE;
+}
+
+StateInput StateMachine::inputPasswordEntry(StateInput input) {
+  switch (input) {
+    case INPUT_BUTTON_A:
+    case INPUT_REPEAT_A:
+      // Cycle through characters, fast while held
+      passwordEntry.charIndex = (passwordEntry.charIndex + 1) % characterSetSize;
+      drawPasswordEntry();
+      LOG_DEBUG("Character changed to: %c", characterSet[passwordEntry.charIndex]);
+      return INPUT_NONE;
+
+    case INPUT_BUTTON_B:
       // Confirm current character and add to password
-      currentPassword += characterSet[currentCharIndex];
-      passwordPosition++;
-      currentCharIndex = 0; // Reset to 'a' for next character
-      displayNeedsUpdate = true;
-      Serial.printf("Character confirmed. Password length: %d\n", currentPassword.length());
-      break;
-      
-    case BUTTON_C_PRESSED:
-      // Submit password and transition to connecting state
-      Serial.printf("Submitting password for %s\n", getSelectedSSID().c_str());
-      changeState(STATE_WIFI_CONNECTING);
-      break;
-      
-    case NO_BUTTON:
-      // Stay in password entry state
-      break;
+      passwordEntry.password.append(characterSet[passwordEntry.charIndex]);
+      passwordEntry.charIndex = 0; // Reset to 'a' for next character
+      drawPasswordEntry();
+      LOG_INFO("Character confirmed. Password length: %d", (int)passwordEntry.password.length());
+      return INPUT_NONE;
+
+    case INPUT_LONG_B:
+    case INPUT_REPEAT_B:
+      // Hold B to delete; the short press that started it doesn't come
+      if (passwordEntry.password.length() > 0) {
+        passwordEntry.password.truncate(passwordEntry.password.length() - 1);
+        drawPasswordEntry();
+        LOG_INFO("Character deleted. Password length: %d", (int)passwordEntry.password.length());
+      }
+      return INPUT_NONE;
+
+    case INPUT_BUTTON_C:
+      LOG_INFO("Submitting password for %s", getSelectedSSID().c_str());
+      return input;
+
+    default:
+      return input;
   }
 }
 
-void StateMachine::handleWiFiConnectingState() {
-  Serial.printf("[STATE_WIFI_CONNECTING] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Display connecting message when entering this state
-  if (stateChanged || displayNeedsUpdate) {
-    displayConnectingMessage(tft, getSelectedSSID());
-    stateChanged = false;
-    displayNeedsUpdate = false;
-  }
-  
-  // Attempt WiFi connection
-  Serial.printf("Attempting to connect to: %s\n", getSelectedSSID().c_str());
-  if (connectToNetwork(getSelectedSSID(), currentPassword)) {
-    Serial.println("WiFi connection successful!");
-    changeState(STATE_WIFI_SUCCESS);
-  } else {
-    Serial.println("WiFi connection failed!");
-    changeState(STATE_WIFI_FAILURE);
-  }
+void StateMachine::drawPasswordEntry() {
+  displayPasswordEntry(tft, matrix, getSelectedSSID().c_str(), passwordEntry.password.c_str(),
+                       characterSet[passwordEntry.charIndex]);
 }
 
-void StateMachine::handleWiFiSuccessState() {
-  Serial.printf("[STATE_WIFI_SUCCESS] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Display success message when entering this state
-  if (stateChanged || displayNeedsUpdate) {
-    // Get connection details
-    String ipAddress = WiFi.localIP().toString();
-    WiFiNetworkInfo networkInfo = getCurrentNetworkInfo();
-    
-    displayWiFiSuccess(tft, getSelectedSSID(), ipAddress, networkInfo.rssi);
-    stateChanged = false;
-    displayNeedsUpdate = false;
-  }
-  
-  // Handle button inputs - any button continues to next state
-  ButtonEvent buttonEvent = handleButtons();
-  if (buttonEvent != NO_BUTTON) {
-    Serial.println("Button pressed - continuing to settings");
-    // Initialize settings manager if this is first time setup
-    if (!settingsManager.initialize()) {
-      Serial.println("Failed to initialize settings manager, using defaults");
-    }
-    
-    // Check if this is first time setup
-    if (settingsManager.isFirstTimeSetup()) {
-      Serial.println("First time setup - going to settings");
-      changeState(STATE_SETTINGS);
-    } else {
-      Serial.println("Settings already configured - going to time sync");
-      changeState(STATE_TIME_SYNC);
-    }
-  }
+StateInput StateMachine::enterWiFiConnecting() {
+  displayConnectingMessage(tft, getSelectedSSID().c_str());
+
+  networkTask.startConnect(getSelectedSSID(), passwordEntry.password.c_str());
+  return INPUT_NONE;
 }
 
-void StateMachine::handleWiFiFailureState() {
-  Serial.printf("[STATE_WIFI_FAILURE] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Display failure message when entering this state
-  if (stateChanged || displayNeedsUpdate) {
-    displayWiFiFailure(tft, getSelectedSSID());
-    stateChanged = false;
-    displayNeedsUpdate = false;
-  }
-  
-  // Handle button inputs for retry options
-  ButtonEvent buttonEvent = handleButtons();
-  switch (buttonEvent) {
-    case BUTTON_A_PRESSED:
-      // Retry with same password
-      Serial.println("Retrying connection with same password");
-      changeState(STATE_WIFI_CONNECTING);
-      break;
-      
-    case BUTTON_B_PRESSED:
-      // Enter new password
-      Serial.println("Entering new password");
-      currentPassword = "";
-      passwordPosition = 0;
-      currentCharIndex = 0;
-      changeState(STATE_PASSWORD_ENTRY);
-      break;
-      
-    case BUTTON_C_PRESSED:
-      // Go back to network selection
-      Serial.println("Going back to network selection");
-      changeState(STATE_WIFI_DISPLAY);
-      break;
-      
-    case NO_BUTTON:
-      // Stay in failure state
-      break;
+StateInput StateMachine::enterWiFiSuccess() {
+  String ipAddress = WiFi.localIP().toString();
+  WiFiNetworkInfo networkInfo = getCurrentNetworkInfo();
+  displayWiFiSuccess(tft, getSelectedSSID().c_str(), ipAddress.c_str(), networkInfo.rssi);
+  return INPUT_NONE;
+}
+
+// Any button continues
+StateInput StateMachine::inputWiFiSuccess(StateInput input) {
+  if (input > INPUT_BUTTON_C) {
+    return INPUT_NONE;  // One press, not the rest of its gesture
+  }
+
+  if (settingsManager.isFirstTimeSetup()) {
+    LOG_INFO("First time setup - going to settings");
+    return INPUT_DONE;
   }
+  LOG_INFO("Settings already configured - going to time sync");
+  return INPUT_SKIP;
 }
 
-void StateMachine::handleSettingsState() {
-  Serial.printf("[STATE_SETTINGS] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Settings menu variables (static to persist across calls)
-  static int currentSettingIndex = 0;
-  static const int numSettings = 3; // Timezone, DST Rules, Brightness
-  
-  // Handle button inputs
-  ButtonEvent buttonEvent = handleButtons();
-  
-  // Display settings menu when needed
-  if (displayNeedsUpdate || stateChanged) {
-    // Get current settings
-    ClockSettings settings = settingsManager.getSettings();
-    
-    // Create settings display strings
-    String timezoneStr = "Timezone: " + settingsManager.getCurrentTimezoneDisplayName();
-    String dstStr = "DST: " + settingsManager.getDSTRulesDisplayName(settings.dstRules);
-    String brightnessStr = "Brightness: " + String(settings.brightness) + "%";
-    String saveStr = "Save & Exit";
-    
-    // Display settings menu (this function needs to be added to display_manager)
-    displaySettingsMenu(tft, currentSettingIndex, timezoneStr, dstStr, brightnessStr, saveStr);
-    
-    displayNeedsUpdate = false;
-    stateChanged = false;
-  }
-  
-  // Handle button events
-  switch (buttonEvent) {
-    case BUTTON_A_PRESSED:
+StateInput StateMachine::enterWiFiFailure() {
+  displayWiFiFailure(tft, getSelectedSSID().c_str());
+  return INPUT_NONE;
+}
+
+// Settings
+StateInput StateMachine::enterSettings() {
+  settingsMenu.index = 0;
+  drawSettings();
+  return INPUT_NONE;
+}
+
+StateInput StateMachine::inputSettings(StateInput input) {
+  switch (input) {
+    case INPUT_BUTTON_A:
+    case INPUT_REPEAT_A:
       // Navigate to next setting
-      currentSettingIndex = (currentSettingIndex + 1) % (numSettings + 1); // +1 for Save & Exit
-      displayNeedsUpdate = true;
-      Serial.printf("Settings navigation: index %d\n", currentSettingIndex);
+      settingsMenu.index = (settingsMenu.index + 1) % (SETTINGS_COUNT + 1); // +1 for Save & Exit
+      LOG_DEBUG("Settings navigation: index %d", settingsMenu.index);
       break;
-      
-    case BUTTON_B_PRESSED:
-      // Modify current setting
-      switch (currentSettingIndex) {
+
+    case INPUT_BUTTON_B:
+    case INPUT_REPEAT_B:
+      // Modify current setting; holding B steps through values, but
+      // never saves
+      if (input == INPUT_REPEAT_B && settingsMenu.index == SETTINGS_COUNT) {
+        return INPUT_NONE;
+      }
+      switch (settingsMenu.index) {
         case 0: // Timezone
           {
-            int currentOffset = settingsManager.getTimezoneOffset();
-            int nextOffset = settingsManager.getNextTimezoneOffset(currentOffset);
-            settingsManager.setTimezoneOffset(nextOffset);
-            Serial.printf("Timezone changed to: %s\n", settingsManager.getCurrentTimezoneDisplayName().c_str());
+            settingsManager.selectNextTimezone();
+            StaticString<TZ_NAME_LENGTH> timezoneName;
+            settingsManager.getCurrentTimezoneDisplayName(timezoneName);
+            LOG_INFO("Timezone changed to: %s", timezoneName.c_str());
           }
           break;
-          
+
         case 1: // DST Rules
-          {
+          if (settingsManager.hasTimezoneName()) {
+            LOG_INFO("DST follows the selected zone");
+          } else {
             DSTRules currentRules = settingsManager.getDSTRules();
             DSTRules nextRules = settingsManager.getNextDSTRules(currentRules);
             settingsManager.setDSTRules(nextRules);
-            Serial.printf("DST rules changed to: %s\n", settingsManager.getDSTRulesDisplayName(nextRules).c_str());
+            LOG_INFO("DST rules changed to: %s", settingsManager.getDSTRulesDisplayName(nextRules));
           }
           break;
-          
+
         case 2: // Brightness
           {
             int currentBrightness = settingsManager.getBrightness();
             int newBrightness = (currentBrightness + 25) % 125; // 0, 25, 50, 75, 100
             if (newBrightness == 0) newBrightness = 25; // Skip 0, start at 25
             settingsManager.setBrightness(newBrightness);
-            Serial.printf("Brightness changed to: %d%%\n", newBrightness);
+            LOG_INFO("Brightness changed to: %d%%", newBrightness);
           }
           break;
-          
+
         case 3: // Save & Exit
-          // Save settings and exit
-          Serial.println("Saving settings and exiting...");
+          LOG_INFO("Saving settings and exiting...");
           settingsManager.setFirstTimeSetup(false); // Mark setup as complete
           if (settingsManager.saveSettings()) {
-            Serial.println("Settings saved successfully");
-            changeState(STATE_TIME_SYNC);
+            LOG_INFO("Settings saved successfully");
           } else {
-            Serial.println("Failed to save settings");
-            // Still continue to time sync
-            changeState(STATE_TIME_SYNC);
+            LOG_WARN("Failed to save settings"); // Still continue to time sync
           }
-          break;
+          return INPUT_DONE;
       }
-      displayNeedsUpdate = true;
       break;
-      
-    case BUTTON_C_PRESSED:
-      // Cancel/Exit without saving (if coming from clock display)
-      if (previousState == STATE_CLOCK_DISPLAY) {
-        Serial.println("Canceling settings changes - returning to clock");
+
+    case INPUT_BUTTON_C:
+      // Cancel/Exit without saving (if coming from a clock screen)
+      if (previousState == STATE_CLOCK_DISPLAY || previousState == STATE_WORDCLOCK_DISPLAY) {
+        LOG_INFO("Canceling settings changes - returning to clock");
         // Reload settings to discard changes
         settingsManager.loadSettings();
-        changeState(STATE_CLOCK_DISPLAY);
-      } else {
-        // If coming from first-time setup, force save and continue
-        Serial.println("First-time setup - saving and continuing");
-        settingsManager.setFirstTimeSetup(false);
-        settingsManager.saveSettings();
-        changeState(STATE_TIME_SYNC);
+        return INPUT_CANCEL;
       }
-      break;
-      
-    case NO_BUTTON:
-      // Stay in settings state
-      break;
+      // If coming from first-time setup, force save and continue
+      LOG_INFO("First-time setup - saving and continuing");
+      settingsManager.setFirstTimeSetup(false);
+      settingsManager.saveSettings();
+      return INPUT_DONE;
+
+    default:
+      return input;
   }
+
+  drawSettings();
+  return INPUT_NONE;
 }
 
-void StateMachine::handleClockDisplayState() {
-  Serial.printf("[STATE_CLOCK_DISPLAY] Free Heap: %d, Min Free: %d\n", 
-                ESP.getFreeHeap(), ESP.getMinFreeHeap());
-  
-  // Update display when needed
-  static unsigned long lastDisplayUpdate = 0;
-  unsigned long currentTime = millis();
-  
-  if (stateChanged || displayNeedsUpdate || (currentTime - lastDisplayUpdate > 1000)) {
-    // Get current time and date from time manager
-    String timeString = timeManager.getFormattedTime();
-    String dateString = timeManager.getFormattedDate();
-    String statusString = timeManager.getStatusString();
-    
-    // Display the clock screen
-    displayClockScreen(tft, timeString, dateString, statusString);
-    
-    lastDisplayUpdate = currentTime;
-    stateChanged = false;
-    displayNeedsUpdate = false;
-    
-    Serial.printf("[CLOCK_DISPLAY] Time: %s, Date: %s, Status: %s\n", 
-                  timeString.c_str(), dateString.c_str(), statusString.c_str());
-  }
-  
-  // Handle button inputs for navigation and settings
-  ButtonEvent buttonEvent = handleButtons();
-  switch (buttonEvent) {
-    case BUTTON_A_PRESSED:
-      // Go to settings menu
-      Serial.println("Settings button pressed - going to settings");
-      changeState(STATE_SETTINGS);
-      break;
-      
-    case BUTTON_B_PRESSED:
-      // Force time sync
-      Serial.println("Force sync button pressed");
-      if (timeManager.forceSync()) {
-        Serial.println("Time sync successful!");
-        displayNeedsUpdate = true;
-      } else {
-        Serial.println("Time sync failed!");
-        displayNeedsUpdate = true;
-      }
+void StateMachine::drawSettings() {
+  ClockSettings settings = settingsManager.getSettings();
+
+  // Create settings display strings (fixed buffers, no heap)
+  StaticString<TZ_NAME_LENGTH> timezoneName;
+  settingsManager.getCurrentTimezoneDisplayName(timezoneName);
+  StaticString<48> timezoneStr;
+  timezoneStr.printf("Timezone: %s", timezoneName.c_str());
+  StaticString<30> dstStr;
+  // A named zone brings its own DST rules
+  dstStr.printf("DST: %s", settingsManager.hasTimezoneName() ? "Zone Rules" : settingsManager.getDSTRulesDisplayName(settings.dstRules));
+  StaticString<30> brightnessStr;
+  brightnessStr.printf("Brightness: %d%%", settings.brightness);
+
+  displaySettingsMenu(tft, settingsMenu.index, timezoneStr.c_str(), dstStr.c_str(), brightnessStr.c_str(), "Save & Exit");
+}
+
+// Time sync
+StateInput StateMachine::enterTimeSync() {
+  timeSync.finished = false;
+
+  // The time manager sets itself up on the first sync, given a network
+  if (WiFi.status() != WL_CONNECTED) {
+    LOG_WARN("[TIME_SYNC] WiFi not connected");
+    return INPUT_FAILED;
+  }
+
+  StaticString<48> servers;
+  servers.printf("Servers: %s +%d", timeManager.getNTPServer(), NTP_SERVER_COUNT - 1);
+  displayTimeSyncStatus(tft, timeManager.getStatusString(), servers.c_str());
+  if (timeManager.isSyncing()) {
+    return INPUT_NONE;  // Already in flight, follow it
+  }
+  if (timeManager.getSyncStatus() == TIME_SYNC_SUCCESS) {
+    return INPUT_DONE;  // Already synced
+  }
+
+  LOG_INFO("[TIME_SYNC] Attempting NTP sync...");
+  if (!timeManager.startSync()) {
+    showSyncResult(false);
+  }
+  return INPUT_NONE;
+}
+
+StateInput StateMachine::tickTimeSync() {
+  if (timeSync.finished) {
+    // Result on screen: leave once its deadline fired (it clears deadlineUs)
+    return deadlineUs == 0 ? INPUT_DONE : INPUT_NONE;
+  }
+
+  switch (timeManager.poll()) {
+    case NTP_POLL_SUCCESS:
+      LOG_INFO("[TIME_SYNC] Time sync successful!");
+      showSyncResult(true);
       break;
-      
-    case BUTTON_C_PRESSED:
-      // Switch to WordClock display mode
-      Serial.println("WordClock mode button pressed");
-      changeState(STATE_WORDCLOCK_DISPLAY);
+    case NTP_POLL_FAILED:
+      // Continue to the clock anyway, it retries in the background
+      LOG_WARN("[TIME_SYNC] Time sync failed!");
+      showSyncResult(false);
       break;
-      
-    case NO_BUTTON:
-      // Stay in clock display state
+    default:
       break;
   }
-  
-  // Check if time sync is needed periodically
+  return INPUT_NONE;
+}
+
+// Keep the result on screen for a moment before moving on
+void StateMachine::showSyncResult(bool success) {
+  StaticString<48> servers;
+  if (success) {
+    servers.printf("%s: %d of %d replied", timeManager.getSelectedServer(),
+                   timeManager.getServersReplied(), timeManager.getServersQueried());
+  } else {
+    servers.printf("%d of %d servers replied", timeManager.getServersReplied(), timeManager.getServersQueried());
+  }
+  displayTimeSyncStatus(tft, success ? timeManager.getStatusString() : "Sync Failed", servers.c_str());
+  timeSync.finished = true;
+  setDeadline(success ? SYNC_SUCCESS_MS : SYNC_FAILURE_MS);
+}
+
+// Background sync on the clock screens: start when due, then poll each
+// pass without blocking. True when a sync finished and the screen is stale.
+bool StateMachine::serviceTimeSync(const char* tag) {
   if (timeManager.needsTimeSync()) {
-    Serial.println("[CLOCK_DISPLAY] Time sync needed, attempting sync...");
-    if (timeManager.syncTime()) {
-      Serial.println("[CLOCK_DISPLAY] Background sync successful");
-      displayNeedsUpdate = true;
-    } else {
-      Serial.println("[CLOCK_DISPLAY] Background sync failed");
+    LOG_INFO("[%s] Time sync needed, starting sync...", tag);
+    timeManager.startSync();
+  }
+  switch (timeManager.poll()) {
+    case NTP_POLL_SUCCESS:
+      LOG_INFO("[%s] Background sync successful", tag);
+      return true;
+    case NTP_POLL_FAILED:
+      LOG_WARN("[%s] Background sync failed", tag);
+      armSyncRetry(true);
+      return true;
+    default:
+      armSyncRetry(false);
+      return false;
+  }
+}
+
+// Without valid time the clock gets no ticks, and a failed sync posts no
+// more events: tick again when the retry is due, needsTimeSync() starts it
+void StateMachine::armSyncRetry(bool failed) {
+  if (timeManager.isSyncing()) return;
+  if (failed || (!timeManager.isTimeValid() && deadlineUs == 0)) {
+    setDeadline(NTP_RETRY_INTERVAL_MS);
+  }
+}
+
+// Clock screens
+StateInput StateMachine::enterClockDisplay() {
+  tickScheduler.takeTicks();  // Drop stale ticks, arm the next one
+  armSyncRetry(false);
+  drawClock();
+  return INPUT_NONE;
+}
+
+StateInput StateMachine::tickClockDisplay() {
+  uint8_t ticks = tickScheduler.takeTicks();
+  bool stale = serviceTimeSync("CLOCK_DISPLAY");
+  if (stale || (ticks & TICK_SECOND)) {
+    drawClock();
+  }
+  return INPUT_NONE;
+}
+
+// Selected zone and the offset in effect now: "America/Chicago UTC-5",
+// or for a plain offset "UTC-6" with " DST" while daylight time applies
+static void formatZone(StringBuffer& out) {
+  settingsManager.getCurrentTimezoneDisplayName(out);
+  if (!timeManager.isTimeValid()) return;
+
+  int offset = settingsManager.getUTCOffsetAt(timeManager.getCurrentFixedTime() >> 32);
+  if (!settingsManager.hasTimezoneName()) {
+    if (offset != settingsManager.getTimezoneOffset() * 3600) {
+      out.append(" DST");
     }
+    return;
+  }
+  int minutes = abs(offset) / 60 % 60;
+  out.appendf(" UTC%c%d", offset < 0 ? '-' : '+', abs(offset) / 3600);
+  if (minutes) {
+    out.appendf(":%02d", minutes);
   }
 }
+
+void StateMachine::drawClock() {
+  StaticString<12> timeString;
+  StaticString<12> dateString;
+  timeManager.getFormattedTime(timeString);
+  timeManager.getFormattedDate(dateString);
+  const char* statusString = timeManager.getStatusString();
+  StaticString<TZ_NAME_LENGTH + 12> zoneString;
+  formatZone(zoneString);
+
+  // Update the clock screen widgets (only changed fields are redrawn)
+  displayClockScreen(tft, timeString.c_str(), dateString.c_str(), statusString, zoneString.c_str());
+
+  LOG_DEBUG("[CLOCK_DISPLAY] Time: %s, Date: %s, Status: %s",
+                timeString.c_str(), dateString.c_str(), statusString);
+}
+
+// Buttons on both clock screens: A settings, C switch screens (table), B sync
+StateInput StateMachine::inputClockDisplay(StateInput input) {
+  if (input != INPUT_BUTTON_B) {
+    return input;
+  }
+
+  // Started on RTC time without WiFi: set up WiFi first
+  if (WiFi.status() != WL_CONNECTED) {
+    LOG_INFO("Sync button pressed without WiFi - going to WiFi scan");
+    return INPUT_NO_WIFI;
+  }
+
+  // Force time sync; the screen redraws when it finishes (EVENT_NTP)
+  LOG_INFO("Force sync button pressed");
+  if (!timeManager.forceSync()) {
+    LOG_WARN("Time sync could not start!");
+  }
+  return INPUT_NONE;
+}
+
+StateInput StateMachine::enterWordClockDisplay() {
+  if (!wordClockStarted) {
+    LOG_INFO("[WORDCLOCK_DISPLAY] Initializing WordClock...");
+    matrixRenderer.showIntro();
+    wordClockStarted = true;
+  }
+
+  // Nothing on this screen shows seconds, so it only ticks on the minute
+  tickScheduler.setResolution(TICK_MINUTE);
+  tickScheduler.takeTicks();
+  armSyncRetry(false);
+  drawWordClock();
+  return INPUT_NONE;
+}
+
+StateInput StateMachine::tickWordClockDisplay() {
+  uint8_t ticks = tickScheduler.takeTicks();
+  bool stale = serviceTimeSync("WORDCLOCK_DISPLAY");
+  if (stale || (ticks & TICK_SECOND)) {
+    drawWordClock();
+  }
+  return INPUT_NONE;
+}
+
+// The other screens don't use the matrix: blank it, which also stops the
+// render task's frames (it then blocks on its queue)
+void StateMachine::exitWordClockDisplay() {
+  tickScheduler.setResolution(TICK_SECOND);
+  matrixRenderer.clear();
+}
+
+void StateMachine::drawWordClock() {
+  if (timeManager.getSyncStatus() != TIME_SYNC_SUCCESS) {
+    // Time not synced, show error on TFT
+    clearTFTScreen(tft);
+    tft.setTextColor(ST77XX_RED);
+    tft.setTextSize(2);
+    tft.setCursor(10, 50);
+    tft.println("Time Not Synced");
+    tft.setTextSize(1);
+    tft.setCursor(10, 80);
+    tft.println("Press B to sync time");
+    return;
+  }
+
+  // One cached local time snapshot instead of six separate conversions
+  struct tm timeinfo = timeManager.snapshot();
+
+  // Display WordClock mode (TFT shows status, matrix shows time as words)
+  displayWordClockMode(tft, matrix, &timeinfo);
+
+  LOG_DEBUG("[WORDCLOCK_DISPLAY] Time: %02d:%02d:%02d",
+                timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+}
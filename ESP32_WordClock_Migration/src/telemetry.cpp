@@ -0,0 +1,119 @@
+#include "../include/telemetry.h"
+#include "../include/logger.h"
+#include "../include/monotonic_clock.h"
+#include "../include/matrix_renderer.h"
+#include "../include/perf_counters.h"
+#include "../include/time_manager.h"
+#include "../include/version.h"
+
+#define TELEMETRY_SUMMARY_MS 10000    // Heap, render and probe frames
+
+// Global instance
+Telemetry telemetry;
+
+Telemetry::Telemetry() {
+  enabled = false;
+  lastSummaryUs = 0;
+}
+
+void Telemetry::send(uint8_t type, const void* payload, uint8_t length) {
+  if (!enabled || length > TELEMETRY_MAX_PAYLOAD) return;
+
+  uint8_t frame[TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD];
+  frame[0] = TELEMETRY_SYNC_BYTE;
+  frame[1] = type;
+  frame[2] = length;
+  memcpy(&frame[3], payload, length);
+  uint16_t crc = telemetryCrc16(&frame[1], length + 2, 0xFFFF);
+  frame[3 + length] = crc & 0xFF;
+  frame[4 + length] = crc >> 8;
+  logger.writeBinary(frame, length + TELEMETRY_FRAME_OVERHEAD);
+}
+
+void Telemetry::setEnabled(bool on) {
+  enabled = on;
+  if (!on) return;
+
+  TelemetryHello hello;
+  memset(&hello, 0, sizeof(hello));
+  hello.uptimeMs = millis();
+  hello.protocol = TELEMETRY_PROTOCOL_VERSION;
+  strncpy(hello.firmware, SOFTWARE_VERSION, sizeof(hello.firmware));
+  send(TELEMETRY_HELLO, &hello, sizeof(hello));
+  lastSummaryUs = 0;  // Summaries on the next update()
+}
+
+bool Telemetry::isEnabled() const {
+  return enabled;
+}
+
+void Telemetry::sendState(uint8_t from, uint8_t to) {
+  if (!enabled) return;
+
+  TelemetryState state;
+  state.uptimeMs = millis();
+  state.from = from;
+  state.to = to;
+  state.freeHeap = ESP.getFreeHeap();
+  send(TELEMETRY_STATE, &state, sizeof(state));
+}
+
+void Telemetry::sendSync(bool success, uint32_t durationMs) {
+  if (!enabled) return;
+
+  TelemetrySync sync;
+  sync.uptimeMs = millis();
+  sync.success = success;
+  sync.durationMs = durationMs;
+  sync.offsetMs = timeManager.getLastOffsetMs();
+  sync.delayMs = timeManager.getLastDelayMs();
+  sync.driftPpb = timeManager.getDriftPpb();
+  send(TELEMETRY_SYNC, &sync, sizeof(sync));
+}
+
+void Telemetry::update() {
+  if (!enabled) return;
+
+  uint64_t now = monotonicMicros();
+  if (lastSummaryUs != 0 && now - lastSummaryUs < TELEMETRY_SUMMARY_MS * 1000ULL) return;
+  lastSummaryUs = now;
+  sendSummaries();
+}
+
+void Telemetry::sendSummaries() {
+  uint32_t uptimeMs = millis();
+  RenderStats render = matrixRenderer.getStats();
+
+  TelemetryHeap heap;
+  heap.uptimeMs = uptimeMs;
+  heap.freeHeap = ESP.getFreeHeap();
+  heap.minFreeHeap = ESP.getMinFreeHeap();
+  heap.largestBlock = ESP.getMaxAllocHeap();
+  heap.uiStackFree = uxTaskGetStackHighWaterMark(NULL);
+  heap.renderStackFree = render.stackFree;
+  send(TELEMETRY_HEAP, &heap, sizeof(heap));
+
+  TelemetryRender frames;
+  frames.uptimeMs = uptimeMs;
+  frames.frames = render.frames;
+  frames.overruns = render.overruns;
+  frames.dropped = render.dropped;
+  frames.lateAvgUs = render.frames ? (uint32_t)(render.lateTotalUs / render.frames) : 0;
+  frames.lateMaxUs = render.lateMaxUs;
+  send(TELEMETRY_RENDER, &frames, sizeof(frames));
+
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    PerfProbeStats s = perfCounters.getStats((PerfProbe)i);
+    if (s.count == 0) continue;
+
+    TelemetryProbe probe;
+    probe.uptimeMs = uptimeMs;
+    probe.probe = i;
+    probe.count = s.count;
+    probe.minUs = s.minUs;
+    probe.avgUs = (uint32_t)(s.totalUs / s.count);
+    probe.maxUs = s.maxUs;
+    probe.p99Us = PerfCounters::percentileUs(s, 99);
+    send(TELEMETRY_PROBE, &probe, sizeof(probe));
+  }
+}
@@ -0,0 +1,103 @@
+#include "../include/tick_scheduler.h"
+#include "../include/time_manager.h"
+#include "../include/event_loop.h"
+#include "../include/logger.h"
+
+// Shared with the esp_timer task
+static portMUX_TYPE tickLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Global tick scheduler instance
+TickScheduler tickScheduler;
+
+TickScheduler::TickScheduler() {
+  timer = nullptr;
+  resolution = TICK_SECOND;
+  pendingTicks = TICK_NONE;
+  armed = false;
+  armedSyncTime = 0;
+  lastMinute = 0;
+}
+
+bool TickScheduler::begin() {
+  if (timer) return true;
+  
+  esp_timer_create_args_t args = {};
+  args.callback = &TickScheduler::onTimer;
+  args.arg = this;
+  args.name = "clock_tick";
+  if (esp_timer_create(&args, &timer) != ESP_OK) {
+    LOG_WARN("[TICK_SCHEDULER] Failed to create timer");
+    timer = nullptr;
+    return false;
+  }
+  
+  LOG_INFO("[TICK_SCHEDULER] Initialized");
+  return true;
+}
+
+// Runs in the esp_timer task: record the tick and wake the loop
+void TickScheduler::onTimer(void* arg) {
+  TickScheduler* self = static_cast<TickScheduler*>(arg);
+  portENTER_CRITICAL(&tickLock);
+  self->pendingTicks |= TICK_SECOND;
+  self->armed = false;
+  portEXIT_CRITICAL(&tickLock);
+  eventLoop.post(EVENT_TICK);
+}
+
+void TickScheduler::setResolution(TickEvent tickResolution) {
+  if (tickResolution == resolution) return;
+  resolution = tickResolution;
+  arm();
+}
+
+// One-shot timer for the next second or minute boundary. The time
+// manager's clock and esp_timer count the same microseconds, and the
+// delay is rounded up, so the timer never fires before the boundary.
+void TickScheduler::arm() {
+  if (!timer || !timeManager.isTimeValid()) return;
+  
+  if (lastMinute == 0) {
+    lastMinute = timeManager.getCurrentEpoch() / 60;  // No minute tick on the first second
+  }
+  
+  esp_timer_stop(timer);  // Fails harmlessly when not running
+  armedSyncTime = timeManager.getLastSyncTime();
+  
+  // Zone offsets are whole minutes, so local and UTC minutes align. The
+  // second is read first: a boundary passing in between makes the timer
+  // a second late, never early.
+  unsigned nextSecond = (unsigned)((timeManager.getCurrentEpoch() + 1) % 60);
+  uint64_t delayUs = timeManager.getMicrosToNextSecond();
+  if (resolution == TICK_MINUTE && nextSecond != 0) {
+    delayUs += (60 - nextSecond) * 1000000ULL;
+  }
+  if (esp_timer_start_once(timer, delayUs) == ESP_OK) {
+    armed = true;
+  } else {
+    LOG_WARN("[TICK_SCHEDULER] Failed to start timer");
+  }
+}
+
+uint8_t TickScheduler::takeTicks() {
+  portENTER_CRITICAL(&tickLock);
+  uint8_t ticks = pendingTicks;
+  pendingTicks = TICK_NONE;
+  bool running = armed;
+  portEXIT_CRITICAL(&tickLock);
+  
+  // Keep ticking; a sync may have moved the boundary the timer waits for
+  if (!running || armedSyncTime != timeManager.getLastSyncTime()) {
+    arm();
+  }
+  
+  // Decided here rather than when arming, so a late loop still sees it
+  if (ticks & TICK_SECOND) {
+    uint64_t minute = timeManager.getCurrentEpoch() / 60;
+    if (minute != lastMinute) {
+      lastMinute = minute;
+      ticks |= TICK_MINUTE;
+    }
+  }
+  return ticks;
+}
@@ -1,18 +1,79 @@
 #include "../include/time_manager.h"
+#include "../include/event_loop.h"
+#include "../include/logger.h"
+#include "../include/perf_counters.h"
+#include "../include/telemetry.h"
+#include "../include/network_task.h"
 
 // We need to include the NTPClient library from the available libraries
 // For now, we'll create a simple implementation that can be expanded
 #include <WiFi.h>
 #include <WiFiUdp.h>
+#include <esp_attr.h>
+#include <stddef.h>
 
 // Simple NTP implementation constants
 #define NTP_PACKET_SIZE 48
 #define NTP_DEFAULT_LOCAL_PORT 1337
 #define SEVENZYYEARS 2208988800UL
+#define NTP_PORT 123
+#define NTP_REPLY_TIMEOUT_MS 1500     // Per round
+#define NTP_MAX_ROUNDS 3              // Sent again while no server gives a usable reply
+#define NTP_MAX_DISTANCE_MS 1000      // Replies with a larger error bound are rejected
+#define NTP_DNS_REFRESH_MS 86400000UL // Pool addresses rotate, look the servers up again daily
+
+// Clock discipline and adaptive poll interval
+#define NTP_MIN_POLL_MS 900000UL      // 15 minutes
+#define NTP_MAX_POLL_MS 86400000UL    // 24 hours
+#define NTP_MIN_TRAIN_MS 60000UL      // Syncs closer than this don't train the drift
+#define NTP_TARGET_ERROR_MS 100       // Worst offset we accept at the next poll
+#define NTP_MAX_DRIFT_PPB 500000      // 500 ppm, anything beyond is a time step
+
+// Time carried over resets
+#define RETAINED_TIME_MAGIC 0x57435431   // "WCT1", bump when the layout changes
+#define RETAINED_MAX_AGE_S 86400         // Longer off, the RTC slow clock can't be trusted
+#define RETAIN_INTERVAL_MS 60000
+
+// Queried alongside the configured server, so one bad server is outvoted
+static const char* const fallbackNTPServers[] = {"time.google.com", "time.cloudflare.com"};
+static_assert(sizeof(fallbackNTPServers) / sizeof(fallbackNTPServers[0]) == NTP_SERVER_COUNT - 1,
+              "NTP_SERVER_COUNT counts the configured server and the fallbacks");
+static_assert(NTP_SERVER_COUNT <= NETWORK_RESOLVE_MAX, "One lookup job covers every server");
 
 // Global time manager instance
 TimeManager timeManager;
 
+// Last known time, in RTC slow memory. It survives software resets,
+// panics and deep sleep but holds garbage after power-on, hence the
+// checksum. No padding, so the checksum covers only real fields.
+struct RetainedTime {
+  FixedTime utc;                  // UTC at clockUs
+  uint64_t clockUs;               // retainedMicros() when saved
+  uint32_t magic;
+  uint32_t syncTime;              // UTC seconds of the sync the time came from
+  uint32_t syncErrorMs;           // Error bound of that sync
+  uint32_t source;                // TIME_SOURCE_NTP or TIME_SOURCE_RTC
+  int32_t driftPpb;
+  int32_t driftSamples;
+  uint32_t syncInterval;
+  uint32_t checksum;              // CRC-32 of the fields above
+};
+static_assert(sizeof(RetainedTime) == 48, "RetainedTime must not contain padding");
+
+static RTC_NOINIT_ATTR RetainedTime retainedTime;
+
+static uint32_t retainedChecksum(const RetainedTime& record) {
+  const uint8_t* data = (const uint8_t*)&record;
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < offsetof(RetainedTime, checksum); i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
 // Constructor
 TimeManager::TimeManager() {
   ntpUDP = nullptr;
@@ -20,9 +81,40 @@ TimeManager::TimeManager() {
   ntpServer = "pool.ntp.org";
   timezoneOffset = 0; // Will be set from settings
   lastSyncTime = 0;
-  lastSyncMillis = 0; // Track when the sync occurred in millis()
-  syncInterval = 3600000; // 1 hour in milliseconds
+  lastSyncUs = 0; // Track when the sync occurred in monotonic time
+  syncFixedTime = 0;
+  lastOffset = 0;
+  lastDelay = 0;
+  lastDistance = 0;
+  driftPpb = 0;
+  driftSamples = 0;
+  syncInterval = 3600000; // 1 hour in milliseconds, adapted after each sync
   syncStatus = TIME_NOT_SYNCED;
+  timeSource = TIME_SOURCE_NONE;
+  syncPending = false;
+  lookingUp = false;
+  syncAttempt = 0;
+  roundStartUs = 0;
+  syncStartUs = 0;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    requestUs[i] = 0;
+    requestNonce[i] = 0;
+    serverResolved[i] = false;
+    resolvedUs[i] = 0;
+    lookupPending[i] = false;
+    replyState[i] = NTP_REPLY_REJECTED;
+  }
+  memset(samples, 0, sizeof(samples));
+  roundQueried = 0;
+  roundReplied = 0;
+  selectedServer = -1;
+  lastSyncFailed = false;
+  lastFailureUs = 0;
+  lastRetainUs = 0;
+  memset(&cachedTime, 0, sizeof(cachedTime));
+  cachedUtc = 0;
+  cachedLocal = 0;
+  cacheValid = false;
 }
 
 // Destructor
@@ -32,11 +124,11 @@ TimeManager::~TimeManager() {
 
 // Initialize the time manager
 bool TimeManager::initialize() {
-  Serial.println("[TIME_MANAGER] Initializing...");
+  LOG_INFO("[TIME_MANAGER] Initializing...");
   
   // Check if WiFi is connected
   if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("[TIME_MANAGER] WiFi not connected");
+    LOG_WARN("[TIME_MANAGER] WiFi not connected");
     return false;
   }
   
@@ -46,11 +138,11 @@ bool TimeManager::initialize() {
   }
   
   if (!ntpUDP->begin(NTP_DEFAULT_LOCAL_PORT)) {
-    Serial.println("[TIME_MANAGER] Failed to start UDP");
+    LOG_WARN("[TIME_MANAGER] Failed to start UDP");
     return false;
   }
   
-  Serial.println("[TIME_MANAGER] Initialized successfully");
+  LOG_INFO("[TIME_MANAGER] Initialized successfully");
   return true;
 }
 
@@ -68,10 +160,93 @@ void TimeManager::cleanup() {
   }
 }
 
-// Simple NTP packet sending
-bool TimeManager::sendNTPPacket() {
+// Server index 0 is the configured one, then the fallbacks
+const char* TimeManager::getServer(int index) {
+  return index == 0 ? ntpServer : fallbackNTPServers[index - 1];
+}
+
+// Server addresses for sendNTPPacket(). hostByName() blocks for the DNS
+// round trip, seconds while the uplink is down, so the lookup runs on the
+// network task and the first round waits for it. An address is kept,
+// failed syncs included, and looked up again only daily; a name that did
+// not resolve is tried again next sync. A failed refresh keeps the old
+// address. Returns true if a lookup was started.
+bool TimeManager::startLookups() {
+  const char* hosts[NETWORK_RESOLVE_MAX] = {};
+  bool due = false;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    lookupPending[i] = !serverResolved[i] ||
+                       monotonicMicros() - resolvedUs[i] >= NTP_DNS_REFRESH_MS * 1000ULL;
+    if (lookupPending[i]) {
+      hosts[i] = getServer(i);
+      due = true;
+    }
+  }
+  lookingUp = due && networkTask.startResolve(hosts, NTP_SERVER_COUNT);
+  if (!lookingUp) {
+    for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+      lookupPending[i] = false;
+    }
+  }
+  return lookingUp;
+}
+
+// Take the addresses of a finished lookup
+void TimeManager::finishLookups() {
+  lookingUp = false;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    if (!lookupPending[i]) continue;
+    lookupPending[i] = false;
+    
+    IPAddress address;
+    if (!networkTask.getResolved(i, address)) {
+      LOG_WARN("[TIME_MANAGER] Cannot resolve %s", getServer(i));
+      continue;
+    }
+    serverIP[i] = address;
+    serverResolved[i] = true;
+    resolvedUs[i] = monotonicMicros();
+    LOG_DEBUG("[TIME_MANAGER] %s is %u.%u.%u.%u", getServer(i), address[0], address[1], address[2], address[3]);
+  }
+}
+
+// Ask every server at once; replies are collected by poll()
+bool TimeManager::sendNTPRound() {
   if (!ntpUDP) return false;
   
+  // Drop replies to earlier rounds still sitting in the socket
+  while (ntpUDP->parsePacket() > 0) {
+    ntpUDP->flush();
+  }
+  
+  LOG_DEBUG("[TIME_MANAGER] NTP round %d/%d", syncAttempt + 1, NTP_MAX_ROUNDS);
+  roundStartUs = monotonicMicros();
+  roundQueried = 0;
+  roundReplied = 0;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    replyState[i] = NTP_REPLY_REJECTED;
+    
+    // A server configured twice would get two votes
+    bool duplicate = false;
+    for (int j = 0; j < i; j++) {
+      if (strcmp(getServer(i), getServer(j)) == 0) {
+        duplicate = true;
+      }
+    }
+    if (duplicate) continue;
+    
+    if (sendNTPPacket(i)) {
+      replyState[i] = NTP_REPLY_WAITING;
+      roundQueried++;
+    } else {
+      LOG_WARN("[TIME_MANAGER] Failed to send NTP packet to %s", getServer(i));
+    }
+  }
+  return roundQueried > 0;
+}
+
+// Simple NTP packet sending
+bool TimeManager::sendNTPPacket(int index) {
   byte packetBuffer[NTP_PACKET_SIZE];
   memset(packetBuffer, 0, NTP_PACKET_SIZE);
   
@@ -87,78 +262,355 @@ bool TimeManager::sendNTPPacket() {
   packetBuffer[14] = 49;
   packetBuffer[15] = 52;
   
+  // Transmit timestamp carries a nonce so the reply can be matched. It is
+  // random: servers asked in the same microsecond must not share one.
+  uint32_t nonce = esp_random();
+  requestNonce[index] = nonce;
+  packetBuffer[44] = nonce >> 24;
+  packetBuffer[45] = nonce >> 16;
+  packetBuffer[46] = nonce >> 8;
+  packetBuffer[47] = nonce;
+  
   // Send packet
-  ntpUDP->beginPacket(ntpServer, 123);
+  if (!serverResolved[index] || !ntpUDP->beginPacket(serverIP[index], NTP_PORT)) {
+    return false;
+  }
   ntpUDP->write(packetBuffer, NTP_PACKET_SIZE);
-  return ntpUDP->endPacket();
+  bool sent = ntpUDP->endPacket();
+  requestUs[index] = monotonicMicros();  // T1, taken as close to the send as possible
+  return sent;
+}
+
+// NTP timestamp (seconds since 1900 + 32 bit fraction) to Unix fixed point.
+// The 32 bit subtraction wraps, so the 2036 NTP era rollover is handled.
+FixedTime TimeManager::readNTPTimestamp(const uint8_t* field) {
+  uint32_t seconds = (uint32_t)field[0] << 24 | (uint32_t)field[1] << 16 | (uint32_t)field[2] << 8 | field[3];
+  uint32_t fraction = (uint32_t)field[4] << 24 | (uint32_t)field[5] << 16 | (uint32_t)field[6] << 8 | field[7];
+  return (FixedTime)(uint32_t)(seconds - SEVENZYYEARS) << 32 | fraction;
+}
+
+// Read a pending reply into the sample of the server it answers
+void TimeManager::readNTPReply(int size) {
+  // Stamp T4 before anything else
+  uint64_t receiveUs = monotonicMicros();
+  
+  byte packetBuffer[NTP_PACKET_SIZE];
+  if (size < NTP_PACKET_SIZE) {
+    ntpUDP->flush();
+    return;
+  }
+  ntpUDP->read(packetBuffer, NTP_PACKET_SIZE);
+  
+  // Must echo the transmit timestamp of a request we are waiting on
+  uint32_t origin = (uint32_t)packetBuffer[28] << 24 | (uint32_t)packetBuffer[29] << 16 |
+                    (uint32_t)packetBuffer[30] << 8 | packetBuffer[31];
+  int index = -1;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    if (replyState[i] == NTP_REPLY_WAITING && origin == requestNonce[i]) {
+      index = i;
+    }
+  }
+  if (index < 0) {
+    LOG_WARN("[TIME_MANAGER] Ignoring unexpected NTP packet");
+    return;
+  }
+  
+  // T4 is the local receive time; T2/T3 are the server's receive and
+  // transmit times. Round trip delay = (T4 - T1) - (T3 - T2), and the
+  // reply left the server half the network delay before T4.
+  uint64_t roundTripUs = receiveUs - requestUs[index];
+  FixedTime serverReceive = readNTPTimestamp(&packetBuffer[32]);
+  FixedTime serverTransmit = readNTPTimestamp(&packetBuffer[40]);
+  int64_t serverHold = (int64_t)(serverTransmit - serverReceive);
+  if (serverHold < 0) {
+    serverHold = 0;  // Bogus receive timestamp, assume an instant reply
+  }
+  int64_t delay = (int64_t)fixedFromMicros(roundTripUs) - serverHold;
+  if (delay < 0) {
+    delay = 0;  // Server hold time is measured on a different clock
+  }
+  
+  // Root delay and dispersion are the server's own distance to its
+  // reference clock, 16.16 fixed point seconds
+  uint32_t rootDelay = (uint32_t)packetBuffer[4] << 24 | (uint32_t)packetBuffer[5] << 16 |
+                       (uint32_t)packetBuffer[6] << 8 | packetBuffer[7];
+  uint32_t rootDispersion = (uint32_t)packetBuffer[8] << 24 | (uint32_t)packetBuffer[9] << 16 |
+                            (uint32_t)packetBuffer[10] << 8 | packetBuffer[11];
+  FixedTime distance = delay / 2 + ((FixedTime)rootDelay << 15) + ((FixedTime)rootDispersion << 16);
+  
+  // Same checks as NTPClient::isValid(), plus the error bound
+  uint8_t leap = packetBuffer[0] >> 6;
+  uint8_t version = (packetBuffer[0] >> 3) & 0x07;
+  uint8_t mode = packetBuffer[0] & 0x07;
+  uint8_t stratum = packetBuffer[1];
+  bool hasReference = packetBuffer[16] | packetBuffer[17] | packetBuffer[18] | packetBuffer[19];
+  bool hasTransmit = packetBuffer[40] | packetBuffer[41] | packetBuffer[42] | packetBuffer[43];
+  const char* problem = nullptr;
+  if (mode != 4) {
+    problem = "not a server reply";
+  } else if (version < 3 || version > 4) {
+    problem = "unsupported version";
+  } else if (stratum == 0) {
+    // Kiss-o'-death, the reason code is in the reference id
+    LOG_WARN("[TIME_MANAGER] %s sent kiss code %c%c%c%c", getServer(index),
+                  packetBuffer[12], packetBuffer[13], packetBuffer[14], packetBuffer[15]);
+    problem = "kiss-o'-death";
+  } else if (leap == 3 || stratum > 15 || !hasReference) {
+    problem = "server not synchronized";
+  } else if (!hasTransmit) {
+    problem = "no transmit timestamp";
+  } else if (fixedToMillis(distance) > NTP_MAX_DISTANCE_MS) {
+    problem = "root distance too large";
+  }
+  if (problem) {
+    LOG_WARN("[TIME_MANAGER] Rejected reply from %s: %s", getServer(index), problem);
+    replyState[index] = NTP_REPLY_REJECTED;
+    return;
+  }
+  
+  NTPSample& sample = samples[index];
+  sample.time = serverTransmit + delay / 2;
+  sample.receiveUs = receiveUs;
+  sample.delay = delay;
+  sample.distance = distance;
+  sample.stratum = stratum;
+  replyState[index] = NTP_REPLY_VALID;
+  LOG_DEBUG("[TIME_MANAGER] Reply from %s: stratum %d, delay %lu ms, distance %lu ms", getServer(index),
+                stratum, (unsigned long)fixedToMillis(delay), (unsigned long)fixedToMillis(distance));
+}
+
+// NTP selection: each sample claims the true time lies within its
+// distance of its own time. Find the largest group whose intervals
+// share a common point (a majority must agree, Marzullo's algorithm),
+// drop the others as falsetickers, then take the survivor with the
+// smallest distance, as the clock filter prefers the least delayed
+// sample. Returns -1 if no majority agrees.
+int TimeManager::selectNTPSample() {
+  // Intervals relative to the first valid sample, all at the same local instant
+  int64_t low[NTP_SERVER_COUNT];
+  int64_t high[NTP_SERVER_COUNT];
+  int index[NTP_SERVER_COUNT];
+  FixedTime reference = 0;
+  int count = 0;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    if (replyState[i] != NTP_REPLY_VALID) continue;
+    const NTPSample& sample = samples[i];
+    FixedTime atRound = sample.time - fixedFromMicros(sample.receiveUs - roundStartUs);
+    if (count == 0) {
+      reference = atRound;
+    }
+    int64_t offset = (int64_t)(atRound - reference);
+    low[count] = offset - (int64_t)sample.distance;
+    high[count] = offset + (int64_t)sample.distance;
+    index[count] = i;
+    count++;
+  }
+  if (count == 0) return -1;
+  
+  // Allow ever more falsetickers until the rest intersect; an interval
+  // endpoint that lies within enough other intervals bounds the intersection
+  for (int falsetickers = 0; 2 * falsetickers < count; falsetickers++) {
+    int needed = count - falsetickers;
+    bool foundLow = false;
+    bool foundHigh = false;
+    int64_t lowest = 0;
+    int64_t highest = 0;
+    for (int i = 0; i < count; i++) {
+      int lowInside = 0;
+      int highInside = 0;
+      for (int j = 0; j < count; j++) {
+        if (low[j] <= low[i] && low[i] <= high[j]) lowInside++;
+        if (low[j] <= high[i] && high[i] <= high[j]) highInside++;
+      }
+      if (lowInside >= needed && (!foundLow || low[i] < lowest)) {
+        lowest = low[i];
+        foundLow = true;
+      }
+      if (highInside >= needed && (!foundHigh || high[i] > highest)) {
+        highest = high[i];
+        foundHigh = true;
+      }
+    }
+    if (!foundLow || !foundHigh || lowest > highest) continue;
+    
+    // Survivors overlap the intersection; the best has the smallest distance
+    int best = -1;
+    for (int i = 0; i < count; i++) {
+      if (high[i] < lowest || low[i] > highest) {
+        LOG_WARN("[TIME_MANAGER] Falseticker: %s", getServer(index[i]));
+        continue;
+      }
+      if (best < 0 || samples[index[i]].distance < samples[best].distance) {
+        best = index[i];
+      }
+    }
+    return best;
+  }
+  return -1;
 }
 
-// Synchronize time with NTP server
-bool TimeManager::syncTime() {
+// Adopt a selected sample as the new time base
+void TimeManager::applyNTPSample(const NTPSample& sample) {
+  // Offset against our own estimate, only meaningful after a sync. RTC
+  // holdover time says nothing about the local oscillator.
+  lastOffset = 0;
+  if (syncStatus == TIME_SYNC_SUCCESS) {
+    lastOffset = (int64_t)(sample.time - getFixedTimeAt(sample.receiveUs));
+    if (timeSource == TIME_SOURCE_NTP) {
+      disciplineClock(lastOffset, (sample.receiveUs - lastSyncUs) / 1000);
+    }
+  }
+  lastDelay = sample.delay;
+  lastDistance = sample.distance;
+  
+  // Store the synchronized time (UTC) and when it occurred
+  syncFixedTime = sample.time;
+  lastSyncTime = sample.time >> 32;
+  lastSyncUs = sample.receiveUs;
+  syncStatus = TIME_SYNC_SUCCESS;
+  timeSource = TIME_SOURCE_NTP;
+  cacheValid = false;
+  
+  // Debug output
+  LOG_DEBUG("[TIME_MANAGER] UTC Epoch: %llu.%03u", (unsigned long long)lastSyncTime, (unsigned)(fixedToMillis(sample.time) % 1000));
+  LOG_DEBUG("[TIME_MANAGER] Sync uptime: %lu s, offset %ld ms, delay %lu ms",
+                (unsigned long)(lastSyncUs / 1000000), (long)getLastOffsetMs(), (unsigned long)getLastDelayMs());
+  LOG_DEBUG("[TIME_MANAGER] Timezone offset: %d seconds", calculateTimezoneOffset(lastSyncTime));
+  StaticString<20> dateTime;
+  getFormattedDateTime(dateTime);
+  LOG_INFO("[TIME_MANAGER] Time synced successfully: %s", dateTime.c_str());
+  
+  writeRetainedTime();
+}
+
+void TimeManager::finishSync(bool success) {
+  syncPending = false;
+  uint32_t durationUs = (uint32_t)(monotonicMicros() - syncStartUs);
+  PERF_RECORD(PERF_NTP_SYNC, durationUs);
+  telemetry.sendSync(success, durationUs / 1000);
+  PERF_COUNT(PERF_COUNT_NTP_SYNCS);
+  if (!success) {
+    PERF_COUNT(PERF_COUNT_NTP_FAILURES);
+  }
+  eventLoop.post(EVENT_NTP);
+  lastSyncFailed = !success;
+  if (!success) {
+    lastFailureUs = monotonicMicros();
+    // Time from an earlier sync stays valid, only report failure without one
+    if (syncStatus != TIME_SYNC_SUCCESS) {
+      syncStatus = TIME_SYNC_FAILED;
+    }
+  }
+}
+
+// Send the first NTP round and return; poll() finishes the sync
+bool TimeManager::startSync() {
+  if (syncPending) return true;
+  
+  syncStartUs = monotonicMicros();
   if (!ntpUDP) {
     if (!initialize()) {
-      syncStatus = TIME_SYNC_FAILED;
+      finishSync(false);
       return false;
     }
   }
   
-  Serial.printf("[TIME_MANAGER] Syncing time with %s\n", ntpServer);
-  syncStatus = TIME_SYNCING;
+  LOG_INFO("[TIME_MANAGER] Syncing time with %s and fallbacks", ntpServer);
+  if (syncStatus != TIME_SYNC_SUCCESS) {
+    syncStatus = TIME_SYNCING;
+  }
   
-  // Send NTP packet
-  if (!sendNTPPacket()) {
-    Serial.println("[TIME_MANAGER] Failed to send NTP packet");
-    syncStatus = TIME_SYNC_FAILED;
+  syncAttempt = 0;
+  syncPending = true;
+  if (startLookups() && networkTask.isResolving()) {
+    return true;  // poll() sends the first round
+  }
+  return sendFirstRound();
+}
+
+// First round of a sync, after the server lookup if there was one
+bool TimeManager::sendFirstRound() {
+  finishLookups();
+  if (!sendNTPRound()) {
+    LOG_WARN("[TIME_MANAGER] Failed to send NTP packets");
+    finishSync(false);
     return false;
   }
+  return true;
+}
+
+// Collect replies without waiting. Servers are given NTP_REPLY_TIMEOUT_MS;
+// if none of them answered usefully the round is sent again.
+NTPPollResult TimeManager::poll() {
+  if (!syncPending) return NTP_POLL_IDLE;
   
-  // Wait for response
-  unsigned long startTime = millis();
-  while (millis() - startTime < 5000) { // 5 second timeout
-    if (ntpUDP->parsePacket()) {
-      byte packetBuffer[NTP_PACKET_SIZE];
-      ntpUDP->read(packetBuffer, NTP_PACKET_SIZE);
-      
-      // Extract timestamp from packet
-      unsigned long highWord = word(packetBuffer[40], packetBuffer[41]);
-      unsigned long lowWord = word(packetBuffer[42], packetBuffer[43]);
-      unsigned long secsSince1900 = highWord << 16 | lowWord;
-      
-      // Convert to Unix timestamp (do NOT apply timezone here - keep UTC)
-      unsigned long epoch = secsSince1900 - SEVENZYYEARS;
-      
-      // Store the synchronized time and when it occurred
-      lastSyncTime = epoch;  // Store UTC time
-      lastSyncMillis = millis();  // Store when sync occurred
-      syncStatus = TIME_SYNC_SUCCESS;
-      
-      // Debug output
-      Serial.printf("[TIME_MANAGER] UTC Epoch: %lu\n", epoch);
-      Serial.printf("[TIME_MANAGER] Sync millis: %lu\n", lastSyncMillis);
-      Serial.printf("[TIME_MANAGER] Timezone offset: %d seconds\n", calculateTimezoneOffset());
-      Serial.printf("[TIME_MANAGER] Time synced successfully: %s\n", getFormattedDateTime().c_str());
-      return true;
+  if (lookingUp) {
+    if (networkTask.isResolving()) return NTP_POLL_PENDING;
+    return sendFirstRound() ? NTP_POLL_PENDING : NTP_POLL_FAILED;
+  }
+  
+  int size;
+  while ((size = ntpUDP->parsePacket()) > 0) {
+    readNTPReply(size);
+  }
+  
+  int waiting = 0;
+  int valid = 0;
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    if (replyState[i] == NTP_REPLY_WAITING) waiting++;
+    if (replyState[i] == NTP_REPLY_VALID) valid++;
+  }
+  if (waiting > 0 && monotonicMicros() - roundStartUs < NTP_REPLY_TIMEOUT_MS * 1000ULL) {
+    return NTP_POLL_PENDING;
+  }
+  roundReplied = valid;
+  
+  if (valid == 0) {
+    LOG_WARN("[TIME_MANAGER] No usable NTP reply");
+    while (++syncAttempt < NTP_MAX_ROUNDS) {
+      if (sendNTPRound()) {
+        return NTP_POLL_PENDING;
+      }
     }
-    delay(100);
+    LOG_WARN("[TIME_MANAGER] NTP sync timeout");
+    finishSync(false);
+    return NTP_POLL_FAILED;
   }
   
-  Serial.println("[TIME_MANAGER] NTP sync timeout");
-  syncStatus = TIME_SYNC_FAILED;
-  return false;
+  int best = selectNTPSample();
+  if (best < 0) {
+    LOG_WARN("[TIME_MANAGER] NTP servers disagree, keeping current time");
+    finishSync(false);
+    return NTP_POLL_FAILED;
+  }
+  LOG_INFO("[TIME_MANAGER] Selected %s (%d of %d replies)", getServer(best), valid, roundQueried);
+  selectedServer = best;
+  applyNTPSample(samples[best]);
+  finishSync(true);
+  return NTP_POLL_SUCCESS;
 }
 
 // Force immediate sync
 bool TimeManager::forceSync() {
-  return syncTime();
+  return startSync();
+}
+
+bool TimeManager::isSyncing() {
+  return syncPending;
 }
 
 // Check if time sync is needed
 bool TimeManager::needsTimeSync() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return true;
+  if (syncPending) return false;
+  
+  // Back off after a failed sync instead of retrying every loop
+  if (lastSyncFailed && monotonicMicros() - lastFailureUs < NTP_RETRY_INTERVAL_MS * 1000ULL) return false;
+  
+  if (syncStatus != TIME_SYNC_SUCCESS || timeSource != TIME_SOURCE_NTP) return true;
   
   // Check if enough time has passed since last sync
-  unsigned long elapsedMs = millis() - lastSyncMillis;
-  return elapsedMs > syncInterval;
+  uint64_t elapsedUs = monotonicMicros() - lastSyncUs;
+  return elapsedUs > syncInterval * 1000ULL;
 }
 
 // Get sync status
@@ -167,201 +619,327 @@ TimeSyncStatus TimeManager::getSyncStatus() {
 }
 
 // Get last sync time
-unsigned long TimeManager::getLastSyncTime() {
+uint64_t TimeManager::getLastSyncTime() {
   return lastSyncTime;
 }
 
-// Calculate current timezone offset including DST
-int TimeManager::calculateTimezoneOffset() {
-  // Get timezone offset from settings (in hours)
-  int baseOffsetHours = settingsManager.getTimezoneOffset();
-  int baseOffsetSeconds = baseOffsetHours * 3600;
-  
-  // Check if DST should be applied
-  DSTRules dstRules = settingsManager.getDSTRules();
-  if (dstRules == DST_DISABLED) {
-    return baseOffsetSeconds;
-  }
+TimeSource TimeManager::getTimeSource() {
+  return timeSource;
+}
+
+// Start from RTC time so the clock runs before WiFi and NTP are up.
+// NTP replaces it, and it never overrides NTP time.
+void TimeManager::setHoldoverTime(FixedTime utc, uint64_t localUs) {
+  if (timeSource == TIME_SOURCE_NTP) return;
   
-  // Get current date for DST calculation
-  time_t rawTime = lastSyncTime;
-  struct tm* timeInfo = gmtime(&rawTime);
+  syncFixedTime = utc;
+  lastSyncTime = utc >> 32;
+  lastSyncUs = localUs;
+  syncStatus = TIME_SYNC_SUCCESS;
+  timeSource = TIME_SOURCE_RTC;
+  lastDistance = 0;
+  cacheValid = false;
+  LOG_INFO("[TIME_MANAGER] Holdover time from RTC: %llu", (unsigned long long)lastSyncTime);
   
-  int month = timeInfo->tm_mon + 1;
-  int day = timeInfo->tm_mday;
-  int year = timeInfo->tm_year + 1900;
+  writeRetainedTime();
+}
+
+// Save the current time with the point on the retained clock it belongs
+// to, so it can be carried forward after a reset
+void TimeManager::writeRetainedTime() {
+  if (syncStatus != TIME_SYNC_SUCCESS) return;
   
-  // Apply DST rules
-  bool isDSTActive = false;
-  if (dstRules == DST_US) {
-    isDSTActive = isDST(month, day, year);
-  } else if (dstRules == DST_EU) {
-    isDSTActive = isDSTEU(month, day, year);
+  RetainedTime record;
+  record.magic = RETAINED_TIME_MAGIC;
+  uint64_t localUs = monotonicMicros();
+  record.clockUs = retainedMicros();
+  record.utc = getFixedTimeAt(localUs);
+  record.syncTime = (uint32_t)lastSyncTime;
+  record.syncErrorMs = (uint32_t)fixedToMillis(lastDistance);
+  record.source = timeSource;
+  record.driftPpb = driftPpb;
+  record.driftSamples = driftSamples;
+  record.syncInterval = syncInterval;
+  record.checksum = retainedChecksum(record);
+  retainedTime = record;
+  lastRetainUs = localUs;
+}
+
+// Re-anchor the saved time now and then, so after a reset only the time
+// spent in reset is bridged by the RTC slow clock. A restored time is
+// never saved again: repeated resets cannot stretch it past
+// RETAINED_MAX_AGE_S.
+void TimeManager::retainTime() {
+  if (timeSource != TIME_SOURCE_NTP && timeSource != TIME_SOURCE_RTC) return;
+  if (monotonicMicros() - lastRetainUs < RETAIN_INTERVAL_MS * 1000ULL) return;
+  writeRetainedTime();
+}
+
+// Carry the time saved before a reset forward by the retained clock. The
+// result is flagged TIME_SOURCE_RETAINED and replaced by RTC or NTP time.
+bool TimeManager::restoreRetainedTime() {
+  RetainedTime record = retainedTime;
+  if (record.magic != RETAINED_TIME_MAGIC || record.checksum != retainedChecksum(record)) {
+    LOG_INFO("[TIME_MANAGER] No retained time (power-on reset)");
+    return false;
   }
   
-  // Add 1 hour (3600 seconds) if DST is active
-  if (isDSTActive) {
-    return baseOffsetSeconds + 3600;
-  } else {
-    return baseOffsetSeconds;
+  uint64_t localUs = monotonicMicros();
+  uint64_t clockUs = retainedMicros();
+  if (clockUs < record.clockUs || clockUs - record.clockUs > RETAINED_MAX_AGE_S * 1000000ULL) {
+    LOG_INFO("[TIME_MANAGER] Retained time is stale, ignored");
+    return false;
   }
+  
+  syncFixedTime = record.utc + fixedFromMicros(clockUs - record.clockUs);
+  lastSyncTime = syncFixedTime >> 32;
+  lastSyncUs = localUs;
+  driftPpb = constrain(record.driftPpb, -NTP_MAX_DRIFT_PPB, NTP_MAX_DRIFT_PPB);
+  driftSamples = record.driftSamples;
+  syncInterval = constrain((unsigned long)record.syncInterval, NTP_MIN_POLL_MS, NTP_MAX_POLL_MS);
+  syncStatus = TIME_SYNC_SUCCESS;
+  timeSource = TIME_SOURCE_RETAINED;
+  cacheValid = false;
+  
+  LOG_INFO("[TIME_MANAGER] Retained time: %llu, %lu ms since saved, %s sync %lu s earlier (+/-%lu ms), drift %ld ppb",
+                (unsigned long long)lastSyncTime, (unsigned long)((clockUs - record.clockUs) / 1000),
+                record.source == TIME_SOURCE_NTP ? "NTP" : "RTC",
+                (unsigned long)(lastSyncTime - record.syncTime), (unsigned long)record.syncErrorMs, (long)driftPpb);
+  return true;
 }
 
-// DST calculation for US rules
-bool TimeManager::isDST(int month, int day, int year) {
-  if (month < 3 || month > 11) return false;
-  if (month > 3 && month < 11) return true;
+int32_t TimeManager::getLastOffsetMs() {
+  // Shift first so the multiply cannot overflow
+  return (int32_t)(((lastOffset >> 16) * 1000) >> 16);
+}
+
+uint32_t TimeManager::getLastDelayMs() {
+  return (uint32_t)fixedToMillis(lastDelay);
+}
+
+int32_t TimeManager::getDriftPpb() {
+  return driftPpb;
+}
+
+unsigned long TimeManager::getSyncInterval() {
+  return syncInterval;
+}
+
+// Frequency-locked discipline. The offset left after a drift-corrected
+// interval is the residual frequency error; fold it into driftPpb (in
+// full the first time, then half, which averages out offset jitter) and
+// stretch the poll interval while the residual stays small.
+void TimeManager::disciplineClock(int64_t offset, uint64_t intervalMs) {
+  if (intervalMs < NTP_MIN_TRAIN_MS) return;  // Forced resync, too short to measure
   
-  // Calculate the second Sunday in March (DST starts)
-  if (month == 3) {
-    // Find the first Sunday in March
-    int firstSunday = 1;
-    int dayOfWeek = (1 + 2*month + (3*(month+1))/5 + year + year/4 - year/100 + year/400) % 7;
-    firstSunday = 8 - dayOfWeek;
-    if (firstSunday > 7) firstSunday -= 7;
-    
-    // Second Sunday is first Sunday + 7
-    int secondSunday = firstSunday + 7;
-    return day >= secondSunday;
+  int64_t offsetUs = ((offset >> 16) * 1000000) >> 16;
+  int64_t residualPpb = offsetUs * 1000000 / (int64_t)intervalMs;
+  int32_t offsetMs = (int32_t)(offsetUs / 1000);
+  
+  if (residualPpb > NTP_MAX_DRIFT_PPB || residualPpb < -NTP_MAX_DRIFT_PPB) {
+    // No crystal is this far off: the time was stepped, start learning again
+    LOG_INFO("[TIME_MANAGER] Time step of %ld ms, drift estimate reset", (long)offsetMs);
+    driftPpb = 0;
+    driftSamples = 0;
+    syncInterval = NTP_MIN_POLL_MS;
+    return;
   }
   
-  // Calculate the first Sunday in November (DST ends)
-  if (month == 11) {
-    // Find the first Sunday in November
-    int dayOfWeek = (1 + 2*month + (3*(month+1))/5 + year + year/4 - year/100 + year/400) % 7;
-    int firstSunday = 8 - dayOfWeek;
-    if (firstSunday > 7) firstSunday -= 7;
-    
-    return day < firstSunday;
+  int64_t drift = driftPpb + (driftSamples == 0 ? residualPpb : residualPpb / 2);
+  driftPpb = (int32_t)constrain(drift, (int64_t)-NTP_MAX_DRIFT_PPB, (int64_t)NTP_MAX_DRIFT_PPB);
+  driftSamples++;
+  
+  // Poll less often while the drift is well predicted, more often if not
+  int32_t error = offsetMs < 0 ? -offsetMs : offsetMs;
+  if (error > NTP_TARGET_ERROR_MS) {
+    syncInterval = max(syncInterval / 2, NTP_MIN_POLL_MS);
+  } else if (error < NTP_TARGET_ERROR_MS / 4 && driftSamples >= 2) {
+    syncInterval = min(syncInterval * 2, NTP_MAX_POLL_MS);
   }
   
-  return false;
+  LOG_INFO("[TIME_MANAGER] Drift %ld ppb (residual %ld ppb over %lu s), next sync in %lu min",
+                (long)driftPpb, (long)residualPpb, (unsigned long)(intervalMs / 1000), syncInterval / 60000);
+}
+
+// Timezone offset including DST in effect at the given UTC time
+int TimeManager::calculateTimezoneOffset(uint64_t utc) {
+  return settingsManager.getUTCOffsetAt(utc);
 }
 
-// DST calculation for EU rules
-bool TimeManager::isDSTEU(int month, int day, int year) {
-  if (month < 3 || month > 10) return false;
-  if (month > 3 && month < 10) return true;
+// Get current time as Unix timestamp
+uint64_t TimeManager::getCurrentEpoch() {
+  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
   
-  // Calculate the last Sunday in March (DST starts)
-  if (month == 3) {
-    // Find the last Sunday in March
-    int lastSunday = 31;
-    int dayOfWeek = (31 + 2*month + (3*(month+1))/5 + year + year/4 - year/100 + year/400) % 7;
-    lastSunday = 31 - dayOfWeek;
-    if (lastSunday > 31) lastSunday -= 7;
-    
-    return day >= lastSunday;
+  // Current UTC time, then apply timezone offset
+  uint64_t utcTime = getCurrentFixedTime() >> 32;
+  return utcTime + calculateTimezoneOffset(utcTime);
+}
+
+// UTC from the sync point plus elapsed monotonic time, in fixed point
+FixedTime TimeManager::getCurrentFixedTime() {
+  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
+  return getFixedTimeAt(monotonicMicros());
+}
+
+// Elapsed local time is corrected by the learnt drift before it is added
+FixedTime TimeManager::getFixedTimeAt(uint64_t localUs) {
+  uint64_t elapsedUs = localUs - lastSyncUs;
+  // Whole milliseconds keep the product in range for centuries of uptime
+  int64_t correctionUs = (int64_t)(elapsedUs / 1000) * driftPpb / 1000000;
+  return syncFixedTime + fixedFromMicros(elapsedUs + correctionUs);
+}
+
+uint64_t TimeManager::getCurrentEpochMs() {
+  return fixedToMillis(getCurrentFixedTime());
+}
+
+// Lets renders land on the true second instead of a free-running 1 s timer
+unsigned long TimeManager::getMillisToNextSecond() {
+  if (syncStatus != TIME_SYNC_SUCCESS) return 1000;
+  return 1000 - getCurrentEpochMs() % 1000;
+}
+
+uint32_t TimeManager::getMicrosToNextSecond() {
+  if (syncStatus != TIME_SYNC_SUCCESS) return 1000000;
+  uint64_t fraction = getCurrentFixedTime() & 0xFFFFFFFFULL;
+  return (uint32_t)((((1ULL << 32) - fraction) * 1000000 + 0xFFFFFFFFULL) >> 32);
+}
+
+// Broken-down local time. The timezone offset and date are only worked
+// out when the UTC second changes; small forward steps (normal ticking)
+// advance the cached fields instead of converting from scratch.
+const struct tm& TimeManager::snapshot() {
+  if (syncStatus != TIME_SYNC_SUCCESS) {
+    memset(&cachedTime, 0, sizeof(cachedTime));
+    cacheValid = false;
+    return cachedTime;
   }
   
-  // Calculate the last Sunday in October (DST ends)
-  if (month == 10) {
-    // Find the last Sunday in October
-    int lastSunday = 31;
-    int dayOfWeek = (31 + 2*month + (3*(month+1))/5 + year + year/4 - year/100 + year/400) % 7;
-    lastSunday = 31 - dayOfWeek;
-    if (lastSunday > 31) lastSunday -= 7;
-    
-    return day < lastSunday;
+  uint64_t utc = getCurrentFixedTime() >> 32;
+  if (cacheValid && utc == cachedUtc) {
+    return cachedTime;
   }
   
-  return false;
+  uint64_t local = utc + calculateTimezoneOffset(utc);
+  if (cacheValid && local > cachedLocal && local - cachedLocal <= 60) {
+    while (cachedLocal < local) {
+      advanceSecond(cachedTime);
+      cachedLocal++;
+    }
+  } else {
+    // First call, resync or offset change (DST/timezone): full conversion
+    epochToTm(local, cachedTime);
+    cachedLocal = local;
+    cacheValid = true;
+  }
+  cachedUtc = utc;
+  return cachedTime;
 }
 
-// Get current time as Unix timestamp
-unsigned long TimeManager::getCurrentEpoch() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
+// Step a broken-down time forward by one second
+void TimeManager::advanceSecond(struct tm& t) {
+  static const uint8_t daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
   
-  // Calculate elapsed time since last sync in seconds
-  unsigned long elapsedMs = millis() - lastSyncMillis;
-  unsigned long elapsedSeconds = elapsedMs / 1000;
+  if (++t.tm_sec < 60) return;
+  t.tm_sec = 0;
+  if (++t.tm_min < 60) return;
+  t.tm_min = 0;
+  if (++t.tm_hour < 24) return;
+  t.tm_hour = 0;
   
-  // Add elapsed time to the stored UTC time, then apply timezone offset
-  unsigned long utcTime = lastSyncTime + elapsedSeconds;
-  return utcTime + calculateTimezoneOffset();
+  // New day
+  t.tm_wday = (t.tm_wday + 1) % 7;
+  t.tm_yday++;
+  int monthDays = daysInMonth[t.tm_mon] + (t.tm_mon == 1 && isLeapYear(t.tm_year + 1900) ? 1 : 0);
+  if (++t.tm_mday <= monthDays) return;
+  t.tm_mday = 1;
+  if (++t.tm_mon < 12) return;
+  t.tm_mon = 0;
+  t.tm_year++;
+  t.tm_yday = 0;
 }
 
 // Format time as HH:MM:SS
-String TimeManager::getFormattedTime() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return "--:--:--";
-  
-  unsigned long epoch = getCurrentEpoch();
-  int hours = (epoch % 86400L) / 3600;
-  int minutes = (epoch % 3600) / 60;
-  int seconds = epoch % 60;
+void TimeManager::getFormattedTime(StringBuffer& out) {
+  if (syncStatus != TIME_SYNC_SUCCESS) {
+    out = "--:--:--";
+    return;
+  }
   
-  char timeStr[9];
-  sprintf(timeStr, "%02d:%02d:%02d", hours, minutes, seconds);
-  return String(timeStr);
+  const struct tm& timeInfo = snapshot();
+  out.printf("%02d:%02d:%02d", timeInfo.tm_hour, timeInfo.tm_min, timeInfo.tm_sec);
 }
 
 // Format date as YYYY-MM-DD
-String TimeManager::getFormattedDate() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return "----/--/--";
-  
-  unsigned long epoch = getCurrentEpoch();
-  time_t rawTime = epoch;
-  struct tm* timeInfo = gmtime(&rawTime);
+void TimeManager::getFormattedDate(StringBuffer& out) {
+  if (syncStatus != TIME_SYNC_SUCCESS) {
+    out = "----/--/--";
+    return;
+  }
   
-  char dateStr[11];
-  sprintf(dateStr, "%04d-%02d-%02d", 
-          timeInfo->tm_year + 1900, 
-          timeInfo->tm_mon + 1, 
-          timeInfo->tm_mday);
-  return String(dateStr);
+  const struct tm& timeInfo = snapshot();
+  out.printf("%04d-%02d-%02d", 
+             timeInfo.tm_year + 1900, 
+             timeInfo.tm_mon + 1, 
+             timeInfo.tm_mday);
 }
 
 // Format date and time
-String TimeManager::getFormattedDateTime() {
-  return getFormattedDate() + " " + getFormattedTime();
+void TimeManager::getFormattedDateTime(StringBuffer& out) {
+  StaticString<12> time;
+  getFormattedDate(out);
+  getFormattedTime(time);
+  out.append(' ').append(time.c_str());
 }
 
-// Get individual time components
+// Get individual time components (0 when not synced)
 int TimeManager::getHours() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
-  unsigned long epoch = getCurrentEpoch();
-  return (epoch % 86400L) / 3600;
+  return snapshot().tm_hour;
 }
 
 int TimeManager::getMinutes() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
-  unsigned long epoch = getCurrentEpoch();
-  return (epoch % 3600) / 60;
+  return snapshot().tm_min;
 }
 
 int TimeManager::getSeconds() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
-  unsigned long epoch = getCurrentEpoch();
-  return epoch % 60;
+  return snapshot().tm_sec;
 }
 
 int TimeManager::getDay() {
-  if (syncStatus != TIME_SYNC_SUCCESS) return 0;
-  unsigned long epoch = getCurrentEpoch();
-  time_t rawTime = epoch;
-  struct tm* timeInfo = gmtime(&rawTime);
-  return timeInfo->tm_mday;
+  return snapshot().tm_mday;
 }
 
 int TimeManager::getMonth() {
   if (syncStatus != TIME_SYNC_SUCCESS) return 0;
-  unsigned long epoch = getCurrentEpoch();
-  time_t rawTime = epoch;
-  struct tm* timeInfo = gmtime(&rawTime);
-  return timeInfo->tm_mon + 1;
+  return snapshot().tm_mon + 1;
 }
 
 int TimeManager::getYear() {
   if (syncStatus != TIME_SYNC_SUCCESS) return 0;
-  unsigned long epoch = getCurrentEpoch();
-  time_t rawTime = epoch;
-  struct tm* timeInfo = gmtime(&rawTime);
-  return timeInfo->tm_year + 1900;
+  return snapshot().tm_year + 1900;
 }
 
 // Configuration methods
 void TimeManager::setNTPServer(const char* server) {
   ntpServer = server;
+  serverResolved[0] = false;
+  lookupPending[0] = false;   // A lookup in flight is for the old name
+}
+
+const char* TimeManager::getNTPServer() {
+  return ntpServer;
+}
+
+const char* TimeManager::getSelectedServer() {
+  return selectedServer < 0 ? "" : getServer(selectedServer);
+}
+
+int TimeManager::getServersQueried() {
+  return roundQueried;
+}
+
+int TimeManager::getServersReplied() {
+  return roundReplied;
 }
 
 void TimeManager::setSyncInterval(unsigned long intervalMs) {
@@ -373,11 +951,13 @@ bool TimeManager::isTimeValid() {
   return syncStatus == TIME_SYNC_SUCCESS;
 }
 
-String TimeManager::getStatusString() {
+const char* TimeManager::getStatusString() {
   switch (syncStatus) {
     case TIME_NOT_SYNCED: return "Not Synced";
     case TIME_SYNCING: return "Syncing...";
-    case TIME_SYNC_SUCCESS: return "Synced";
+    case TIME_SYNC_SUCCESS:
+      if (timeSource == TIME_SOURCE_RETAINED) return "Unsynced";
+      return timeSource == TIME_SOURCE_RTC ? "RTC Time" : "Synced";
     case TIME_SYNC_FAILED: return "Sync Failed";
     default: return "Unknown";
   }
@@ -0,0 +1,164 @@
+#include "../include/tz_rules.h"
+#include "../include/tz_zones.h"
+#include "../include/civil_time.h"
+
+// Parsing helpers: each consumes from p and returns false on bad input
+
+// Zone abbreviation: 3+ letters, or anything quoted in <>
+static bool parseName(const char*& p) {
+  const char* start = p;
+  if (*p == '<') {
+    while (*p && *p != '>') p++;
+    if (*p != '>') return false;
+    p++;
+    return p - start >= 5;
+  }
+  while (isalpha((unsigned char)*p)) p++;
+  return p - start >= 3;
+}
+
+static bool parseNumber(const char*& p, int maxValue, int& value) {
+  if (!isdigit((unsigned char)*p)) return false;
+  value = 0;
+  while (isdigit((unsigned char)*p)) {
+    value = value * 10 + (*p++ - '0');
+    if (value > maxValue) return false;
+  }
+  return true;
+}
+
+// [+-]hh[:mm[:ss]], in seconds
+static bool parseTime(const char*& p, int maxHours, int32_t& seconds) {
+  int sign = 1;
+  if (*p == '+' || *p == '-') {
+    sign = (*p++ == '-') ? -1 : 1;
+  }
+
+  int hours, minutes = 0, secs = 0;
+  if (!parseNumber(p, maxHours, hours)) return false;
+  if (*p == ':') {
+    p++;
+    if (!parseNumber(p, 59, minutes)) return false;
+    if (*p == ':') {
+      p++;
+      if (!parseNumber(p, 59, secs)) return false;
+    }
+  }
+  seconds = sign * (hours * 3600 + minutes * 60 + secs);
+  return true;
+}
+
+static bool parseTransition(const char*& p, TZTransitionRule& transition) {
+  int value;
+  transition.month = transition.week = transition.weekday = 0;
+  transition.day = 0;
+
+  if (*p == 'M') {
+    p++;
+    int week, weekday;
+    if (!parseNumber(p, 12, value) || value < 1 || *p++ != '.') return false;
+    if (!parseNumber(p, 5, week) || week < 1 || *p++ != '.') return false;
+    if (!parseNumber(p, 6, weekday)) return false;
+    transition.type = 'M';
+    transition.month = value;
+    transition.week = week;
+    transition.weekday = weekday;
+  } else if (*p == 'J') {
+    p++;
+    if (!parseNumber(p, 365, value) || value < 1) return false;
+    transition.type = 'J';
+    transition.day = value;
+  } else {
+    if (!parseNumber(p, 365, value)) return false;
+    transition.type = 'D';
+    transition.day = value;
+  }
+
+  // Default change time is 02:00 local
+  transition.time = 2 * 3600;
+  if (*p == '/') {
+    p++;
+    return parseTime(p, 167, transition.time);
+  }
+  return true;
+}
+
+bool parseTZRule(const char* spec, TZRule& rule) {
+  const char* p = spec;
+  int32_t offset;
+
+  // POSIX offsets count hours west of UTC, ours count east
+  if (!parseName(p) || !parseTime(p, 24, offset)) return false;
+  rule.stdOffset = -offset;
+  rule.dstOffset = rule.stdOffset;
+  rule.hasDST = false;
+  if (*p == '\0') return true;
+
+  if (!parseName(p)) return false;
+  rule.hasDST = true;
+  rule.dstOffset = rule.stdOffset + 3600;
+  if (*p != ',' && *p != '\0') {
+    if (!parseTime(p, 24, offset)) return false;
+    rule.dstOffset = -offset;
+  }
+
+  if (*p == '\0') {
+    // No rules given: POSIX leaves this to the implementation, use US rules
+    p = ",M3.2.0,M11.1.0";
+  }
+  if (*p++ != ',' || !parseTransition(p, rule.start)) return false;
+  if (*p++ != ',' || !parseTransition(p, rule.end)) return false;
+  return *p == '\0';
+}
+
+int64_t getTZTransitionTime(const TZTransitionRule& transition, int year, int32_t offset) {
+  int64_t days;
+
+  if (transition.type == 'M') {
+    int nextMonth = transition.month % 12 + 1;
+    int64_t monthEnd = daysFromCivil(nextMonth == 1 ? year + 1 : year, nextMonth, 1);
+    int64_t first = daysFromCivil(year, transition.month, 1);
+    days = first + (transition.weekday + 7 - weekdayFromDays(first)) % 7 + 7 * (transition.week - 1);
+    // Week 5 means the last such weekday, which may be the 4th
+    while (days >= monthEnd) {
+      days -= 7;
+    }
+  } else if (transition.type == 'J') {
+    int dayOfYear = transition.day - 1;
+    if (isLeapYear(year) && transition.day >= 60) {
+      dayOfYear++;
+    }
+    days = daysFromCivil(year, 1, 1) + dayOfYear;
+  } else {
+    days = daysFromCivil(year, 1, 1) + transition.day;
+  }
+
+  return days * 86400 + transition.time - offset;
+}
+
+// Zone table
+
+int findTimezone(const char* name) {
+  int low = 0;
+  int high = tzZoneCount - 1;
+
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    int cmp = strcmp(name, tzZones[mid].name);
+    if (cmp == 0) return mid;
+    if (cmp < 0) {
+      high = mid - 1;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return -1;
+}
+
+int getTimezoneCount() {
+  return tzZoneCount;
+}
+
+const TZZone& getTimezone(int index) {
+  return tzZones[index];
+}
@@ -0,0 +1,198 @@
+#include "../include/ui_widgets.h"
+#include "../include/display_manager.h"
+#include "../include/perf_counters.h"
+#include "../include/logger.h"
+
+// Global widget tree instance
+WidgetTree uiTree;
+
+// Constructor
+WidgetTree::WidgetTree() {
+  widgetCount = 0;
+  screen = UI_SCREEN_NONE;
+  background = ST77XX_BLACK;
+  fullRedraw = true;
+}
+
+// Screen management
+bool WidgetTree::beginScreen(UIScreenId id, uint16_t bg) {
+  if (id == screen && !fullRedraw) {
+    return false; // Layout already built and on screen
+  }
+
+  LOG_DEBUG("[UI] Building screen %d", id);
+  screen = id;
+  background = bg;
+  widgetCount = 0;
+  fullRedraw = true;
+  return true;
+}
+
+void WidgetTree::invalidate() {
+  // Something else drew on the TFT; rebuild the layout on next beginScreen()
+  screen = UI_SCREEN_NONE;
+  fullRedraw = true;
+}
+
+UIScreenId WidgetTree::getScreen() const {
+  return screen;
+}
+
+// Layout
+int WidgetTree::addWidget(WidgetType type, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (widgetCount >= UI_MAX_WIDGETS) {
+    LOG_WARN("[UI] Widget pool full (%d), screen %d", UI_MAX_WIDGETS, screen);
+    return -1;
+  }
+
+  Widget& widget = widgets[widgetCount];
+  widget.type = type;
+  widget.x = x;
+  widget.y = y;
+  widget.w = w;
+  widget.h = h;
+  widget.textSize = 1;
+  widget.color = color;
+  widget.text[0] = '\0';
+  widget.value = 0;
+  widget.drawnWidth = 0;
+  widget.dirty = true;
+  return widgetCount++;
+}
+
+int WidgetTree::addText(int16_t x, int16_t y, uint8_t size, uint16_t color, const char* text) {
+  int id = addWidget(WIDGET_TEXT, x, y, 0, 8 * size, color);
+  if (id >= 0) {
+    widgets[id].textSize = size;
+    strncpy(widgets[id].text, text, UI_TEXT_LENGTH - 1);
+    widgets[id].text[UI_TEXT_LENGTH - 1] = '\0';
+  }
+  return id;
+}
+
+int WidgetTree::addRule(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  return addWidget(WIDGET_RULE, x, y, w, 1, color);
+}
+
+int WidgetTree::addSignalBars(int16_t x, int16_t y) {
+  int id = addWidget(WIDGET_SIGNAL_BARS, x, y, 30, 12, ST77XX_GREEN);
+  if (id >= 0) {
+    widgets[id].value = -100; // No bars until setSignal()
+  }
+  return id;
+}
+
+int WidgetTree::addListRow(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  return addWidget(WIDGET_LIST_ROW, x, y, w, h, color);
+}
+
+// Value updates
+void WidgetTree::setText(int id, const char* text) {
+  if (id < 0 || id >= widgetCount) return;
+
+  Widget& widget = widgets[id];
+  if (strncmp(widget.text, text, UI_TEXT_LENGTH - 1) != 0) {
+    strncpy(widget.text, text, UI_TEXT_LENGTH - 1);
+    widget.text[UI_TEXT_LENGTH - 1] = '\0';
+    widget.dirty = true;
+  }
+}
+
+void WidgetTree::setColor(int id, uint16_t color) {
+  if (id < 0 || id >= widgetCount) return;
+
+  if (widgets[id].color != color) {
+    widgets[id].color = color;
+    widgets[id].dirty = true;
+  }
+}
+
+void WidgetTree::setSignal(int id, int32_t rssi) {
+  if (id < 0 || id >= widgetCount) return;
+
+  // Only a change in bar count is visible
+  Widget& widget = widgets[id];
+  if (getSignalBarCount(widget.value) != getSignalBarCount(rssi)) {
+    widget.dirty = true;
+  }
+  widget.value = rssi;
+}
+
+void WidgetTree::setSelected(int id, bool selected) {
+  if (id < 0 || id >= widgetCount) return;
+
+  if ((widgets[id].value != 0) != selected) {
+    widgets[id].value = selected ? 1 : 0;
+    widgets[id].dirty = true;
+  }
+}
+
+// Rendering
+int WidgetTree::render(Adafruit_ST7789& tft) {
+  if (fullRedraw) {
+    PERF_COUNT(PERF_COUNT_TFT_CLEARS);
+    tft.fillScreen(background);
+    for (int i = 0; i < widgetCount; i++) {
+      widgets[i].drawnWidth = 0; // Cleared along with the screen
+      widgets[i].dirty = true;
+    }
+    fullRedraw = false;
+  }
+
+  int drawn = 0;
+  for (int i = 0; i < widgetCount; i++) {
+    if (widgets[i].dirty) {
+      drawWidget(tft, widgets[i]);
+      widgets[i].dirty = false;
+      drawn++;
+    }
+  }
+  return drawn;
+}
+
+void WidgetTree::drawText(Adafruit_ST7789& tft, Widget& widget, uint16_t color, uint16_t bg) {
+  // Opaque text overwrites the old value in place, no clear/flicker
+  tft.setTextWrap(false);
+  tft.setTextSize(widget.textSize);
+  tft.setTextColor(color, bg);
+  tft.setCursor(widget.x, widget.y);
+  tft.print(widget.text);
+  tft.setTextWrap(true); // Imperative screens still rely on wrapping
+
+  // Erase whatever is left of a longer previous value
+  int16_t width = strlen(widget.text) * 6 * widget.textSize;
+  if (width < widget.drawnWidth) {
+    tft.fillRect(widget.x + width, widget.y, widget.drawnWidth - width, 8 * widget.textSize, bg);
+  }
+  widget.drawnWidth = width;
+}
+
+void WidgetTree::drawWidget(Adafruit_ST7789& tft, Widget& widget) {
+  switch (widget.type) {
+    case WIDGET_TEXT:
+      drawText(tft, widget, widget.color, background);
+      break;
+
+    case WIDGET_RULE:
+      tft.drawFastHLine(widget.x, widget.y, widget.w, widget.color);
+      break;
+
+    case WIDGET_SIGNAL_BARS:
+      drawSignalBars(tft, widget.value, widget.x, widget.y);
+      break;
+
+    case WIDGET_LIST_ROW:
+      {
+        // Highlight fills the whole row, text sits 2px in
+        uint16_t fill = widget.value ? ST77XX_YELLOW : background;
+        uint16_t textColor = widget.value ? ST77XX_BLACK : widget.color;
+        tft.fillRect(widget.x, widget.y, widget.w, widget.h, fill);
+        Widget label = widget;
+        label.x += 2;
+        label.y += 2;
+        label.drawnWidth = 0; // Row fill already cleared it
+        drawText(tft, label, textColor, fill);
+      }
+      break;
+  }
+}
@@ -1,4 +1,5 @@
 #include "../include/wifi_manager.h"
+#include "../include/logger.h"
 
 // WiFi scanning variables
 int networkCount = 0;
@@ -10,7 +11,7 @@ const unsigned long SCAN_INTERVAL = 10000; // Scan every 10 seconds
 String selectedSSID = "";
 
 void scanWiFiNetworks() {
-  Serial.println("Scanning for WiFi networks...");
+  LOG_INFO("Scanning for WiFi networks...");
   
   // Perform WiFi scan
   int totalNetworks = WiFi.scanNetworks();
@@ -19,29 +20,33 @@ void scanWiFiNetworks() {
   // Limit to top networks by signal strength (WiFi.scanNetworks() sorts by RSSI)
   networkCount = min(totalNetworks, MAX_NETWORKS);
   
-  Serial.printf("Found %d networks, showing top %d by signal strength\n", totalNetworks, networkCount);
+  LOG_INFO("Found %d networks, showing top %d by signal strength", totalNetworks, networkCount);
   
   if (networkCount > 0) {
     currentNetwork = 0; // Reset to first network
     
     // Safe output - just show we have networks without the problematic loop
-    Serial.printf("Strongest network: %s (%d dBm)\n", 
+    LOG_INFO("Strongest network: %s (%d dBm)", 
                   WiFi.SSID(0).c_str(), WiFi.RSSI(0));
     if (networkCount > 1) {
-      Serial.printf("Total available for selection: %d networks\n", networkCount);
+      LOG_INFO("Total available for selection: %d networks", networkCount);
     }
   } else {
-    Serial.println("No WiFi networks found");
+    LOG_WARN("No WiFi networks found");
   }
 }
 
 WiFiNetworkInfo getCurrentNetworkInfo() {
+  return getNetworkInfo(currentNetwork);
+}
+
+WiFiNetworkInfo getNetworkInfo(int index) {
   WiFiNetworkInfo info;
   
-  if (networkCount > 0 && currentNetwork >= 0 && currentNetwork < networkCount) {
-    info.ssid = WiFi.SSID(currentNetwork);
-    info.rssi = WiFi.RSSI(currentNetwork);
-    info.encryption = WiFi.encryptionType(currentNetwork);
+  if (networkCount > 0 && index >= 0 && index < networkCount) {
+    info.ssid = WiFi.SSID(index);
+    info.rssi = WiFi.RSSI(index);
+    info.encryption = WiFi.encryptionType(index);
   } else {
     info.ssid = "";
     info.rssi = -100;
@@ -90,7 +95,7 @@ void nextNetwork() {
     currentNetwork = (currentNetwork + 1) % networkCount;
     // Add bounds checking before accessing WiFi data
     if (currentNetwork >= 0 && currentNetwork < networkCount) {
-      Serial.printf("Next network: %d (%s)\n", currentNetwork + 1, WiFi.SSID(currentNetwork).c_str());
+      LOG_DEBUG("Next network: %d (%s)", currentNetwork + 1, WiFi.SSID(currentNetwork).c_str());
     }
   }
 }
@@ -98,12 +103,12 @@ void nextNetwork() {
 void selectCurrentNetwork() {
   if (networkCount > 0 && currentNetwork >= 0 && currentNetwork < networkCount) {
     selectedSSID = WiFi.SSID(currentNetwork);
-    Serial.printf("Selected network: %s\n", selectedSSID.c_str());
+    LOG_INFO("Selected network: %s", selectedSSID.c_str());
   }
 }
 
 bool connectToNetwork(String ssid, String password) {
-  Serial.printf("Attempting to connect to: %s\n", ssid.c_str());
+  LOG_INFO("Attempting to connect to: %s", ssid.c_str());
   
   // Begin WiFi connection
   WiFi.begin(ssid.c_str(), password.c_str());
@@ -114,15 +119,14 @@ bool connectToNetwork(String ssid, String password) {
   
   while (WiFi.status() != WL_CONNECTED && millis() - startTime < timeout) {
     delay(500);
-    Serial.print(".");
   }
   
   if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\nWiFi connected successfully!");
-    Serial.printf("IP address: %s\n", WiFi.localIP().toString().c_str());
+    LOG_INFO("WiFi connected successfully!");
+    LOG_INFO("IP address: %s", WiFi.localIP().toString().c_str());
     return true;
   } else {
-    Serial.println("\nWiFi connection failed!");
+    LOG_WARN("WiFi connection failed!");
     return false;
   }
 }
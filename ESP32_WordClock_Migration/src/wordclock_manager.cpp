@@ -1,4 +1,6 @@
 #include "../include/wordclock_manager.h"
+#include "../include/perf_counters.h"
+#include "../include/logger.h"
 
 // Global variables
 uint64_t wordMask = 0;
@@ -6,7 +8,7 @@ int colorShiftIndex = 0;
 Adafruit_NeoMatrix* wordClockMatrix = nullptr;
 
 void initializeWordClock(Adafruit_NeoMatrix& matrix) {
-  Serial.println("Initializing WordClock...");
+  LOG_DEBUG("Initializing WordClock...");
   
   // Store reference to the matrix
   wordClockMatrix = &matrix;
@@ -21,12 +23,12 @@ void initializeWordClock(Adafruit_NeoMatrix& matrix) {
   wordMask = 0;
   colorShiftIndex = 0;
   
-  Serial.println("WordClock initialization complete");
+  LOG_INFO("WordClock initialization complete");
 }
 
 void displayWordClockTime(struct tm* timeinfo) {
   if (!wordClockMatrix || !timeinfo) {
-    Serial.println("WordClock: Invalid matrix or time info");
+    LOG_WARN("WordClock: Invalid matrix or time info");
     return;
   }
   
@@ -150,7 +152,7 @@ void clearWordMask() {
 
 void applyWordMask() {
   if (!wordClockMatrix) {
-    Serial.println("WordClock: Matrix not initialized");
+    LOG_WARN("WordClock: Matrix not initialized");
     return;
   }
   
@@ -168,11 +170,11 @@ void applyWordMask() {
     }
   }
   
-  // Show the result
-  wordClockMatrix->show();
-  
-  // Add delay for color shifting effect
-  delay(SHIFTDELAY);
+  // Show the result (the renderer paces frames at SHIFTDELAY)
+  {
+    PERF_SCOPE(PERF_MATRIX_SHOW);
+    wordClockMatrix->show();
+  }
   
   // Move the colors forward
   colorShiftIndex++;
@@ -198,7 +200,7 @@ uint32_t colorWheel(byte wheelPos) {
 
 void rainbowCycle(uint8_t wait) {
   if (!wordClockMatrix) {
-    Serial.println("WordClock: Matrix not initialized for rainbow cycle");
+    LOG_WARN("WordClock: Matrix not initialized for rainbow cycle");
     return;
   }
   
@@ -215,11 +217,11 @@ void rainbowCycle(uint8_t wait) {
 
 void flashWords() {
   if (!wordClockMatrix) {
-    Serial.println("WordClock: Matrix not initialized for flash words");
+    LOG_WARN("WordClock: Matrix not initialized for flash words");
     return;
   }
   
-  Serial.println("WordClock: Starting flash words sequence");
+  LOG_INFO("WordClock: Starting flash words sequence");
   
   // Flash the hidden signature first
   clearWordMask();
@@ -330,7 +332,7 @@ void flashWords() {
   applyWordMask();
   delay(FLASHDELAY);
   
-  Serial.println("WordClock: Flash words sequence complete");
+  LOG_INFO("WordClock: Flash words sequence complete");
 }
 
 void adjustWordClockBrightness(struct tm* timeinfo) {
@@ -349,24 +351,24 @@ void adjustWordClockBrightness(struct tm* timeinfo) {
 }
 
 void testNeoMatrix(Adafruit_NeoMatrix& matrix) {
-  Serial.println("WordClock: Testing NeoMatrix with simple patterns...");
+  LOG_INFO("WordClock: Testing NeoMatrix with simple patterns...");
   
   // Test 1: Single red pixel at (0,0)
-  Serial.println("WordClock: Test 1 - Red pixel at (0,0)");
+  LOG_DEBUG("WordClock: Test 1 - Red pixel at (0,0)");
   matrix.fillScreen(0);
   matrix.drawPixel(0, 0, matrix.Color(255, 0, 0)); // Red
   matrix.show();
   delay(1000);
   
   // Test 2: Single green pixel at (7,7)
-  Serial.println("WordClock: Test 2 - Green pixel at (7,7)");
+  LOG_DEBUG("WordClock: Test 2 - Green pixel at (7,7)");
   matrix.fillScreen(0);
   matrix.drawPixel(7, 7, matrix.Color(0, 255, 0)); // Green
   matrix.show();
   delay(1000);
   
   // Test 3: Blue diagonal line
-  Serial.println("WordClock: Test 3 - Blue diagonal line");
+  LOG_DEBUG("WordClock: Test 3 - Blue diagonal line");
   matrix.fillScreen(0);
   for(int i = 0; i < 8; i++) {
     matrix.drawPixel(i, i, matrix.Color(0, 0, 255)); // Blue
@@ -375,16 +377,16 @@ void testNeoMatrix(Adafruit_NeoMatrix& matrix) {
   delay(1000);
   
   // Test 4: Fill entire matrix with dim white
-  Serial.println("WordClock: Test 4 - Dim white fill");
+  LOG_DEBUG("WordClock: Test 4 - Dim white fill");
   matrix.fillScreen(matrix.Color(50, 50, 50)); // Dim white
   matrix.show();
   delay(1000);
   
   // Test 5: Clear matrix
-  Serial.println("WordClock: Test 5 - Clear matrix");
+  LOG_DEBUG("WordClock: Test 5 - Clear matrix");
   matrix.fillScreen(0);
   matrix.show();
   delay(500);
   
-  Serial.println("WordClock: NeoMatrix test complete!");
+  LOG_INFO("WordClock: NeoMatrix test complete!");
 }
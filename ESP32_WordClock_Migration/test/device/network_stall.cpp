@@ -0,0 +1,40 @@
+// Render jitter check on the hardware, not part of the firmware: a task at
+// the network task's priority hogs the CPU for NETWORK_STALL_TEST_MS every
+// NETWORK_STALL_PERIOD_MS, like a stalled driver call, and logs the
+// renderer's frame timing after each stall. Built in by
+//
+//   NETWORK_STALL_TEST_MS=2000 ./compile.sh
+//
+// which copies this file into the sketch and defines the duration. Keep
+// it under the task watchdog's 5 s.
+
+#include "../include/matrix_renderer.h"
+#include "../include/monotonic_clock.h"
+#include "../include/task_config.h"
+#include "../include/logger.h"
+
+#ifndef NETWORK_STALL_TEST_MS
+#define NETWORK_STALL_TEST_MS 2000
+#endif
+#define NETWORK_STALL_PERIOD_MS 10000
+
+static void stallTask(void*) {
+  for (;;) {
+    vTaskDelay(pdMS_TO_TICKS(NETWORK_STALL_PERIOD_MS));
+
+    matrixRenderer.resetStats();
+    uint64_t endUs = monotonicMicros() + NETWORK_STALL_TEST_MS * 1000ULL;
+    while (monotonicMicros() < endUs) {
+      // Busy, never yields
+    }
+    LOG_INFO("[STALL_TEST] Simulated %d ms stall", NETWORK_STALL_TEST_MS);
+    matrixRenderer.logStats();
+  }
+}
+
+// Called from setup() in stall test builds
+void startNetworkStallTest() {
+  if (xTaskCreate(stallTask, "stall", NETWORK_TASK_STACK, nullptr, NETWORK_TASK_PRIORITY, nullptr) != pdPASS) {
+    LOG_WARN("[STALL_TEST] Failed to create task");
+  }
+}
@@ -0,0 +1,115 @@
+#ifndef FAKE_NTP_H
+#define FAKE_NTP_H
+
+// Simulated NTP servers for the host tests: they answer the requests
+// TimeManager sends through the WiFiUDP stub with the true time, which
+// the tests control (trueUtcUs()), and can be made to misbehave.
+
+#include "host.h"
+#include "../include/time_manager.h"
+
+#define UNIX_TO_NTP 2208988800ULL
+
+// True UTC at boot; the servers answer with it plus elapsed time
+static const uint64_t BOOT_UTC_US = 1717243200ULL * 1000000;   // 2024-06-01 12:00
+
+// Local oscillator error: true time runs this much faster than hostNowUs()
+static int32_t localSlowPpm = 0;
+
+static inline uint64_t trueUtcUs() {
+  return BOOT_UTC_US + hostNowUs() + (int64_t)hostNowUs() * localSlowPpm / 1000000;
+}
+
+struct FakeServer {
+  const char* name;
+  IPAddress ip;
+  bool wrongNonce;     // Origin timestamp that matches no request
+  uint8_t leap;        // 3 = clock not synchronized
+  uint8_t stratum;     // 0 = kiss-o'-death
+  bool zeroTransmit;   // Transmit timestamp left empty
+  int64_t errorUs;     // Added to the time it sends
+  uint8_t dispersion;  // Root dispersion in 1/65536 s
+};
+
+static FakeServer servers[NTP_SERVER_COUNT] = {
+  {"pool.ntp.org", IPAddress(10, 0, 0, 1), false, 0, 2, false, 0, 0x40},
+  {"time.google.com", IPAddress(10, 0, 0, 2), false, 0, 2, false, 0, 0x40},
+  {"time.cloudflare.com", IPAddress(10, 0, 0, 3), false, 0, 2, false, 0, 0x40},
+};
+
+static inline void putTimestamp(uint8_t* field, uint64_t unixUs) {
+  uint64_t seconds = unixUs / 1000000 + UNIX_TO_NTP;
+  uint32_t fraction = (uint32_t)(((unixUs % 1000000) << 32) / 1000000);
+  for (int i = 0; i < 4; i++) {
+    field[i] = (uint8_t)(seconds >> (24 - 8 * i));
+    field[4 + i] = (uint8_t)(fraction >> (24 - 8 * i));
+  }
+}
+
+// Server reply to a request, stamped with the true time now
+static inline void reply(const FakeServer& server, const std::vector<uint8_t>& request) {
+  uint8_t packet[48];
+  memset(packet, 0, sizeof(packet));
+  packet[0] = server.leap << 6 | 4 << 3 | 4;   // Version 4, server
+  packet[1] = server.stratum;
+  packet[11] = server.dispersion;
+  memcpy(&packet[12], server.stratum ? "GPS" : "RATE", server.stratum ? 3 : 4);  // Reference id or kiss code
+  uint64_t now = trueUtcUs() + server.errorUs;
+  putTimestamp(&packet[16], now - 1000000);
+  memcpy(&packet[24], &request[40], 8);   // Origin: the request's transmit timestamp
+  if (server.wrongNonce) packet[31] ^= 1;
+  putTimestamp(&packet[32], now);
+  if (!server.zeroTransmit) putTimestamp(&packet[40], now);
+  hostDeliverPacket(server.ip, packet, sizeof(packet));
+}
+
+// Every request sent so far is answered halfway through a 20 ms round trip
+static inline int answerRequests() {
+  std::vector<HostPacket> requests = hostSentPackets();
+  hostSentPackets().clear();
+  hostAdvanceMs(10);
+  for (size_t r = 0; r < requests.size(); r++) {
+    for (int s = 0; s < NTP_SERVER_COUNT; s++) {
+      if (requests[r].ip == servers[s].ip && requests[r].port == 123) reply(servers[s], requests[r].data);
+    }
+  }
+  hostAdvanceMs(10);
+  return (int)requests.size();
+}
+
+// Polls like the state machine until the sync finishes
+static inline NTPPollResult finishSync() {
+  NTPPollResult result;
+  while ((result = timeManager.poll()) == NTP_POLL_PENDING) {
+    hostAdvanceMs(100);
+  }
+  return result;
+}
+
+// A whole sync, every round answered
+static inline NTPPollResult sync() {
+  timeManager.forceSync();
+  NTPPollResult result;
+  while ((result = timeManager.poll()) == NTP_POLL_PENDING) {
+    if (hostSentPackets().empty()) {
+      hostAdvanceMs(100);
+    } else {
+      answerRequests();
+    }
+  }
+  return result;
+}
+
+// Local clock minus true time, in microseconds
+static inline int64_t clockErrorUs() {
+  return (int64_t)(fixedToMicros(timeManager.getCurrentFixedTime()) - trueUtcUs());
+}
+
+// Makes the servers' names resolve
+static inline void addFakeServers() {
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    hostAddServer(servers[i].name, servers[i].ip);
+  }
+}
+
+#endif // FAKE_NTP_H
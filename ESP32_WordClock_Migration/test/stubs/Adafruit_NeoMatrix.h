@@ -0,0 +1,50 @@
+#ifndef HOST_ADAFRUIT_NEOMATRIX_H
+#define HOST_ADAFRUIT_NEOMATRIX_H
+
+// An 8x8 NeoPixel matrix in memory: pixels are kept as 24-bit colors,
+// scaled by brightness only when shown, as the real strip does
+
+#include <Adafruit_GFX.h>
+
+#define NEO_MATRIX_TOP 0x00
+#define NEO_MATRIX_LEFT 0x00
+#define NEO_MATRIX_ROWS 0x00
+#define NEO_MATRIX_PROGRESSIVE 0x00
+#define NEO_GRB 0x52
+#define NEO_KHZ800 0x0000
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoMatrix : public Adafruit_GFX {
+public:
+  uint32_t pixels[64];
+  uint8_t brightness;
+  uint32_t shows;
+
+  Adafruit_NeoMatrix(int w, int h, uint8_t, uint8_t, neoPixelType)
+      : Adafruit_GFX(w, h), brightness(255), shows(0) {
+    memset(pixels, 0, sizeof(pixels));
+  }
+
+  void begin() {}
+  void show() { shows++; }
+  void setBrightness(uint8_t b) { brightness = b; }
+  uint16_t numPixels() const { return 64; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= 8 || y >= 8) return;
+    uint32_t r = (color >> 11) * 255 / 31, g = ((color >> 5) & 0x3F) * 255 / 63, b = (color & 0x1F) * 255 / 31;
+    pixels[y * 8 + x] = r << 16 | g << 8 | b;
+  }
+  void setPixelColor(uint16_t n, uint32_t c) {
+    if (n < 64) pixels[n] = c;
+  }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, (uint32_t)r << 16 | (uint32_t)g << 8 | b);
+  }
+  static uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+  }
+};
+
+#endif // HOST_ADAFRUIT_NEOMATRIX_H
@@ -0,0 +1,8 @@
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+// Pulled in by Adafruit_NeoMatrix on the device; the matrix stub has all
+// main.cpp uses
+#include <Adafruit_NeoMatrix.h>
+
+#endif // HOST_ADAFRUIT_NEOPIXEL_H
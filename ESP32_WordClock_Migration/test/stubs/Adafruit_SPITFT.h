@@ -0,0 +1,35 @@
+#ifndef HOST_ADAFRUIT_SPITFT_H
+#define HOST_ADAFRUIT_SPITFT_H
+
+// A TFT that draws into a 16-bit canvas, so tests can read pixels back.
+// setAddrWindow()/writePixels() fill the window left to right, top down,
+// like the controller's RAM pointer.
+
+#include <Adafruit_GFX.h>
+
+class Adafruit_SPITFT : public GFXcanvas16 {
+private:
+  int16_t windowX, windowY, windowW, windowH;
+  uint32_t windowPos;
+
+public:
+  Adafruit_SPITFT(uint16_t w, uint16_t h)
+      : GFXcanvas16(w, h), windowX(0), windowY(0), windowW(0), windowH(0), windowPos(0) {}
+
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    windowX = x;
+    windowY = y;
+    windowW = w;
+    windowH = h;
+    windowPos = 0;
+  }
+
+  void writePixels(uint16_t* colors, uint32_t len, bool = true, bool = false) {
+    for (uint32_t i = 0; i < len && windowW > 0; i++, windowPos++) {
+      if (windowPos >= (uint32_t)windowW * windowH) return;
+      drawPixel(windowX + windowPos % windowW, windowY + windowPos / windowW, colors[i]);
+    }
+  }
+};
+
+#endif // HOST_ADAFRUIT_SPITFT_H
@@ -0,0 +1,236 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the Arduino-ESP32 core: just enough of Arduino.h and
+// the FreeRTOS API for the modules under test. Time is simulated; see
+// host.h for the controls tests use and host.cpp for the implementation.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define F(x) x
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(const uint16_t*)(a))
+#define pgm_read_dword(a) (*(const uint32_t*)(a))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define INPUT_PULLDOWN 3
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+#define digitalPinToInterrupt(p) (p)
+
+// ESP32-S2 Reverse TFT Feather pins
+#define A0 18
+#define A1 17
+#define A2 16
+#define A3 15
+#define A4 14
+#define A5 8
+#define TFT_BACKLITE 45
+#define TFT_CS 42
+#define TFT_DC 40
+#define TFT_RST 41
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+
+// Arduino String: every non-empty value lives on the heap, as with the
+// real one (no small string buffer), so allocation tests see it
+class String {
+private:
+  char* buffer;
+  unsigned len;
+
+  void assign(const char* text, unsigned n) {
+    char* copy = (char*)malloc(n + 1);
+    memcpy(copy, text, n);
+    copy[n] = '\0';
+    free(buffer);
+    buffer = copy;
+    len = n;
+  }
+
+public:
+  String(const char* text = "") : buffer(nullptr), len(0) { assign(text ? text : "", text ? strlen(text) : 0); }
+  String(const String& other) : buffer(nullptr), len(0) { assign(other.buffer, other.len); }
+  String(char c) : buffer(nullptr), len(0) { assign(&c, 1); }
+  String(int v) : buffer(nullptr), len(0) { *this = std::to_string(v).c_str(); }
+  String(unsigned v) : buffer(nullptr), len(0) { *this = std::to_string(v).c_str(); }
+  String(long v) : buffer(nullptr), len(0) { *this = std::to_string(v).c_str(); }
+  String(unsigned long v) : buffer(nullptr), len(0) { *this = std::to_string(v).c_str(); }
+  ~String() { free(buffer); }
+
+  String& operator=(const String& other) {
+    if (this != &other) assign(other.buffer, other.len);
+    return *this;
+  }
+  String& operator=(const char* text) {
+    assign(text, strlen(text));
+    return *this;
+  }
+
+  const char* c_str() const { return buffer; }
+  unsigned length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+  char operator[](unsigned i) const { return i < len ? buffer[i] : 0; }
+
+  String& operator+=(const char* text) {
+    std::string joined = std::string(buffer) + text;
+    assign(joined.c_str(), joined.size());
+    return *this;
+  }
+  String& operator+=(const String& other) { return *this += other.buffer; }
+  String& operator+=(char c) {
+    char text[2] = {c, '\0'};
+    return *this += text;
+  }
+  String operator+(const String& other) const {
+    String result(*this);
+    return result += other;
+  }
+  bool operator==(const String& other) const { return strcmp(buffer, other.buffer) == 0; }
+  bool operator==(const char* other) const { return strcmp(buffer, other) == 0; }
+  bool operator!=(const char* other) const { return strcmp(buffer, other) != 0; }
+
+  int indexOf(char c) const {
+    const char* p = strchr(buffer, c);
+    return p ? (int)(p - buffer) : -1;
+  }
+  String substring(unsigned from, unsigned to = ~0u) const {
+    if (from > len) from = len;
+    if (to > len) to = len;
+    String result;
+    if (to > from) result.assign(buffer + from, to - from);
+    return result;
+  }
+  void remove(unsigned index) {
+    if (index < len) {
+      len = index;
+      buffer[len] = '\0';
+    }
+  }
+  int toInt() const { return atoi(buffer); }
+};
+
+#include "Print.h"
+
+// Output is dropped unless HOST_SERIAL is set in the environment
+class HardwareSerial : public Print {
+public:
+  using Print::write;
+  void begin(unsigned long) {}
+  size_t write(uint8_t c);
+  int available() { return 0; }
+  int read() { return -1; }
+  operator bool() { return true; }
+};
+extern HardwareSerial Serial;
+
+struct EspClass {
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 180000; }
+  uint32_t getMaxAllocHeap() { return 100000; }
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getCycleCount();
+  void restart() {}
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+uint32_t esp_random();
+long random(long max);
+long random(long min, long max);
+uint32_t getCpuFrequencyMhz();
+uint32_t getXtalFrequencyMhz();
+
+template <class T> T constrain(T x, T a, T b) { return x < a ? a : (x > b ? b : x); }
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+using std::min;
+using std::max;
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+  size_t length = strlen(src);
+  if (size) {
+    size_t n = length < size - 1 ? length : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return length;
+}
+
+// FreeRTOS, single threaded: tasks are never created (modules fall back
+// to running inline) and a blocking receive advances simulated time
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void (*TaskFunction_t)(void*);
+typedef struct { volatile int owner; } portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portTICK_PERIOD_MS 1
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+#define portYIELD_FROM_ISR() do {} while (0)
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                       UBaseType_t priority, TaskHandle_t* handle);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority);
+void vTaskDelay(TickType_t ticks);
+
+#endif // HOST_ARDUINO_H
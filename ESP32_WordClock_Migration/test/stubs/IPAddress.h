@@ -0,0 +1,31 @@
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include "Arduino.h"
+
+class IPAddress {
+private:
+  uint8_t bytes[4];
+
+public:
+  IPAddress() { memset(bytes, 0, sizeof(bytes)); }
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+    bytes[0] = a;
+    bytes[1] = b;
+    bytes[2] = c;
+    bytes[3] = d;
+  }
+
+  uint8_t operator[](int index) const { return bytes[index]; }
+  operator uint32_t() const { return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24; }
+  bool operator==(const IPAddress& other) const { return memcmp(bytes, other.bytes, 4) == 0; }
+  bool operator!=(const IPAddress& other) const { return !(*this == other); }
+
+  String toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+    return String(text);
+  }
+};
+
+#endif // HOST_IPADDRESS_H
@@ -0,0 +1,53 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include "Arduino.h"
+#include <map>
+
+// NVS in a map; survives end() and begin() like flash does. As on the
+// device, nothing is read or written while the namespace is not open:
+// puts return 0 and gets the fallback.
+class Preferences {
+private:
+  static std::map<std::string, std::string>& store() {
+    static std::map<std::string, std::string> values;
+    return values;
+  }
+  std::string name;
+  bool started = false;
+  std::string key(const char* k) const { return name + "/" + k; }
+
+public:
+  bool begin(const char* space, bool = false) {
+    if (started) return false;
+    name = space;
+    started = true;
+    return true;
+  }
+  void end() { started = false; }
+  bool isKey(const char* k) { return started && store().count(key(k)) != 0; }
+  bool remove(const char* k) { return started && store().erase(key(k)) != 0; }
+
+  size_t putInt(const char* k, int32_t v) {
+    if (!started) return 0;
+    store()[key(k)] = std::to_string(v);
+    return 4;
+  }
+  size_t putBool(const char* k, bool v) { return putInt(k, v) ? 1 : 0; }
+  size_t putString(const char* k, const char* v) {
+    if (!started) return 0;
+    store()[key(k)] = v;
+    return strlen(v);
+  }
+
+  int32_t getInt(const char* k, int32_t fallback = 0) {
+    return isKey(k) ? atoi(store()[key(k)].c_str()) : fallback;
+  }
+  bool getBool(const char* k, bool fallback = false) { return getInt(k, fallback) != 0; }
+  size_t getString(const char* k, char* value, size_t size) {
+    if (!isKey(k) || size == 0) return 0;
+    return strlcpy(value, store()[key(k)].c_str(), size);
+  }
+};
+
+#endif // HOST_PREFERENCES_H
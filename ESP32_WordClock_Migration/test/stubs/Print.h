@@ -0,0 +1,47 @@
+#ifndef HOST_PRINT_H
+#define HOST_PRINT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+class String;
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) write(buffer[i]);
+    return size;
+  }
+  virtual void flush() {}
+
+  size_t print(const char* text) {
+    size_t n = 0;
+    while (*text) n += write((uint8_t)*text++);
+    return n;
+  }
+  size_t print(const String& text);
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int = 10) { return printf("%d", v); }
+  size_t print(unsigned v, int = 10) { return printf("%u", v); }
+  size_t print(long v, int = 10) { return printf("%ld", v); }
+  size_t print(unsigned long v, int = 10) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+
+  size_t println() { return print("\r\n"); }
+  template <class T> size_t println(T v) { return print(v) + println(); }
+  template <class T> size_t println(T v, int format) { return print(v, format) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return print(buffer);
+  }
+};
+
+#endif // HOST_PRINT_H
@@ -0,0 +1,12 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <stdint.h>
+
+class SPIClass {
+public:
+  void begin() {}
+};
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
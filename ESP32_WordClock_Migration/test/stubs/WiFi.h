@@ -0,0 +1,55 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+typedef enum {
+  WIFI_AUTH_OPEN,
+  WIFI_AUTH_WEP,
+  WIFI_AUTH_WPA_PSK,
+  WIFI_AUTH_WPA2_PSK,
+  WIFI_AUTH_WPA_WPA2_PSK,
+  WIFI_AUTH_WPA2_ENTERPRISE,
+  WIFI_AUTH_WPA3_PSK,
+  WIFI_AUTH_WPA2_WPA3_PSK
+} wifi_auth_mode_t;
+
+enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4, WL_DISCONNECTED = 6 };
+
+#define WIFI_STA 1
+
+struct HostNetwork {
+  const char* ssid;
+  int32_t rssi;
+  wifi_auth_mode_t encryption;
+};
+
+// Scan results and link state come from the public fields, set by tests
+class WiFiClass {
+public:
+  const HostNetwork* networks = nullptr;
+  int networkCount = 0;
+  int linkStatus = WL_CONNECTED;
+
+  void mode(int) {}
+  void disconnect(bool = false) {}
+  void begin() {}
+  void begin(const char*, const char* = nullptr) {}
+  int status() { return linkStatus; }
+  IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+
+  int scanNetworks() { return networkCount; }
+  void scanDelete() {}
+  String SSID(int index = 0) { return index < networkCount ? networks[index].ssid : ""; }
+  int32_t RSSI(int index = 0) { return index < networkCount ? networks[index].rssi : 0; }
+  wifi_auth_mode_t encryptionType(int index) {
+    return index < networkCount ? networks[index].encryption : WIFI_AUTH_OPEN;
+  }
+
+  // Names registered with hostAddServer() (host.h); 0 for unknown names
+  int hostByName(const char* host, IPAddress& result);
+};
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
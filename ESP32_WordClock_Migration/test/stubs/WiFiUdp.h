@@ -0,0 +1,35 @@
+#ifndef HOST_WIFIUDP_H
+#define HOST_WIFIUDP_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include <vector>
+
+// Datagrams go to and come from the simulated network in host.cpp: sent
+// ones are collected for tests (hostSentPackets()), and tests queue the
+// replies (hostDeliverPacket()). Sending to a name looks it up first,
+// like the real one, and counts as a lookup.
+class WiFiUDP {
+private:
+  IPAddress destination;
+  uint16_t destinationPort = 0;
+  std::vector<uint8_t> sending;
+  std::vector<uint8_t> received;
+  size_t readPosition = 0;
+  IPAddress source;
+
+public:
+  uint8_t begin(uint16_t) { return 1; }
+  void stop() {}
+  int beginPacket(const char* host, uint16_t port);
+  int beginPacket(IPAddress ip, uint16_t port);
+  size_t write(const uint8_t* data, size_t size);
+  int endPacket();
+  int parsePacket();
+  int read(uint8_t* buffer, size_t size);
+  void flush();
+  IPAddress remoteIP() { return source; }
+  uint16_t remotePort() { return 123; }
+};
+
+#endif // HOST_WIFIUDP_H
@@ -0,0 +1,36 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+#include <vector>
+
+// A simulated I2C device: the bus hands it each write transaction whole
+// (register pointer first), and reads continue from its register pointer
+class HostI2CDevice {
+public:
+  virtual ~HostI2CDevice() {}
+  virtual void write(const uint8_t* data, size_t size) = 0;
+  virtual uint8_t read() = 0;
+};
+
+// I2C bus with the devices attached by hostAttachI2C() (host.h); transfers
+// to any other address are NACKed
+class TwoWire {
+private:
+  uint8_t address = 0;
+  std::vector<uint8_t> transmit;
+  std::vector<uint8_t> received;
+  size_t readPosition = 0;
+
+public:
+  bool begin() { return true; }
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t value);
+  uint8_t endTransmission(bool stop = true);   // 0 ACK, 2 address NACK
+  uint8_t requestFrom(uint8_t address, uint8_t count);
+  int available() { return (int)(received.size() - readPosition); }
+  int read() { return readPosition < received.size() ? received[readPosition++] : -1; }
+};
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,9 @@
+#ifndef HOST_ESP_ATTR_H
+#define HOST_ESP_ATTR_H
+
+// Plain RAM on the host. RTC_NOINIT_ATTR data is gathered in one section,
+// which hostBoot() (host.h) carries over a simulated reset.
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR __attribute__((section("host_rtc_noinit")))
+
+#endif // HOST_ESP_ATTR_H
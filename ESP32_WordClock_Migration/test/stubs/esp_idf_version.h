@@ -0,0 +1,6 @@
+#ifndef HOST_ESP_IDF_VERSION_H
+#define HOST_ESP_IDF_VERSION_H
+
+#define ESP_IDF_VERSION_MAJOR 4
+
+#endif // HOST_ESP_IDF_VERSION_H
@@ -0,0 +1,17 @@
+#ifndef HOST_ESP_PM_H
+#define HOST_ESP_PM_H
+
+#include "esp_timer.h"
+
+#define ESP_ERR_NOT_SUPPORTED 0x106
+
+typedef struct {
+  int max_freq_mhz;
+  int min_freq_mhz;
+  bool light_sleep_enable;
+} esp_pm_config_esp32s2_t;
+
+// Always ESP_ERR_NOT_SUPPORTED: the host never sleeps
+esp_err_t esp_pm_configure(const void* config);
+
+#endif // HOST_ESP_PM_H
@@ -0,0 +1,413 @@
+// Simulated board behind the stubs: clock, esp_timer, queues and the
+// core's globals. Single threaded; see host.h.
+
+#include "host.h"
+#include <SPI.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <Wire.h>
+#include <esp_pm.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+WiFiClass WiFi;
+TwoWire Wire;
+
+static uint64_t nowUs = 0;
+static uint64_t retainedBaseSeconds = 0;
+static uint64_t wakeByUs = 0;
+
+// ---- esp_timer
+
+struct esp_timer {
+  esp_timer_create_args_t args;
+  uint64_t dueUs;   // 0 when stopped
+};
+
+static std::vector<esp_timer*> timers;
+
+static esp_timer* earliestTimer() {
+  esp_timer* next = nullptr;
+  for (esp_timer* t : timers) {
+    if (t->dueUs && (!next || t->dueUs < next->dueUs)) next = t;
+  }
+  return next;
+}
+
+uint64_t hostNowUs() {
+  return nowUs;
+}
+
+uint64_t hostNextTimerUs() {
+  esp_timer* next = earliestTimer();
+  return next ? next->dueUs : 0;
+}
+
+void hostAdvanceUs(uint64_t us) {
+  uint64_t endUs = nowUs + us;
+  esp_timer* next;
+  while ((next = earliestTimer()) && next->dueUs <= endUs) {
+    if (next->dueUs > nowUs) nowUs = next->dueUs;
+    next->dueUs = 0;
+    next->args.callback(next->args.arg);
+  }
+  nowUs = endUs;
+}
+
+void hostWakeBy(uint64_t us) {
+  wakeByUs = us;
+}
+
+void hostSetRetainedBase(uint64_t seconds) {
+  retainedBaseSeconds = seconds;
+}
+
+int64_t esp_timer_get_time() {
+  return (int64_t)nowUs;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+  esp_timer* t = new esp_timer;
+  t->args = *args;
+  t->dueUs = 0;
+  timers.push_back(t);
+  *handle = t;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs) {
+  if (timer->dueUs) return ESP_FAIL;  // Already running, like ESP_ERR_INVALID_STATE
+  timer->dueUs = nowUs + (timeoutUs ? timeoutUs : 1);
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  if (!timer->dueUs) return ESP_FAIL;
+  timer->dueUs = 0;
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_configure(const void*) {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+// The RTC timer: keeps its own base, moves with simulated time
+extern "C" int gettimeofday(struct timeval* tv, void*) {
+  uint64_t us = retainedBaseSeconds * 1000000ULL + nowUs;
+  tv->tv_sec = us / 1000000;
+  tv->tv_usec = us % 1000000;
+  return 0;
+}
+
+// ---- Reset
+
+// The linker brackets the section; weak, so tests without any
+// RTC_NOINIT_ATTR data still link
+extern uint8_t __start_host_rtc_noinit[] __attribute__((weak));
+extern uint8_t __stop_host_rtc_noinit[] __attribute__((weak));
+
+uint8_t* hostRetainedMemory(size_t* size) {
+  *size = __start_host_rtc_noinit ? __stop_host_rtc_noinit - __start_host_rtc_noinit : 0;
+  return __start_host_rtc_noinit;
+}
+
+int hostBoot(int (*boot)()) {
+  size_t size;
+  uint8_t* memory = hostRetainedMemory(&size);
+  int fds[2];
+  fflush(stdout);
+  if (pipe(fds) != 0) return 1;
+  pid_t pid = fork();
+  if (pid == 0) {
+    // The board: run, then hand RTC memory back through the pipe
+    close(fds[0]);
+    int result = boot();
+    fflush(stdout);
+    size_t sent = 0;
+    while (sent < size) {
+      ssize_t n = write(fds[1], memory + sent, size - sent);
+      if (n <= 0) break;
+      sent += n;
+    }
+    _exit(result);
+  }
+  close(fds[1]);
+  if (pid < 0) {
+    close(fds[0]);
+    return 1;
+  }
+  std::vector<uint8_t> kept(size);
+  size_t received = 0;
+  while (received < size) {
+    ssize_t n = read(fds[0], kept.data() + received, size - received);
+    if (n <= 0) break;
+    received += n;
+  }
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (received == size && size > 0) memcpy(memory, kept.data(), size);
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+// ---- FreeRTOS
+
+struct HostQueue {
+  std::deque<std::vector<uint8_t> > items;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  HostQueue* q = new HostQueue;
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+  delete static_cast<HostQueue*>(queue);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t) {
+  HostQueue* q = static_cast<HostQueue*>(queue);
+  if (q->items.size() >= q->length) return pdFALSE;
+  const uint8_t* bytes = static_cast<const uint8_t*>(item);
+  q->items.push_back(std::vector<uint8_t>(bytes, bytes + q->itemSize));
+  return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {
+  if (woken) *woken = pdFALSE;
+  return xQueueSend(queue, item, 0);
+}
+
+// Waiting lets time run to the next timer until something arrives. With
+// nothing due, a wait forever returns empty instead of hanging the test.
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+  HostQueue* q = static_cast<HostQueue*>(queue);
+  uint64_t endUs = wait == portMAX_DELAY ? UINT64_MAX : nowUs + wait * 1000ULL;
+  if (wait != portMAX_DELAY && wakeByUs > nowUs && wakeByUs < endUs) endUs = wakeByUs;
+  while (q->items.empty() && nowUs < endUs) {
+    uint64_t nextUs = hostNextTimerUs();
+    if (!nextUs && wait == portMAX_DELAY) break;
+    uint64_t stepTo = nextUs && nextUs < endUs ? nextUs : endUs;
+    hostAdvanceUs(stepTo - nowUs);
+  }
+  if (q->items.empty()) return pdFALSE;
+  memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  return pdTRUE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t* handle) {
+  if (handle) *handle = nullptr;
+  return pdFAIL;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return nullptr; }
+void xTaskNotifyGive(TaskHandle_t) {}
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
+void vTaskPrioritySet(TaskHandle_t, UBaseType_t) {}
+void vTaskDelay(TickType_t ticks) { hostAdvanceMs(ticks); }
+
+// ---- Arduino core
+
+size_t HardwareSerial::write(uint8_t c) {
+  static bool echo = getenv("HOST_SERIAL") != nullptr;
+  if (echo) putchar(c);
+  return 1;
+}
+
+size_t Print::print(const String& text) {
+  return print(text.c_str());
+}
+
+uint32_t EspClass::getCycleCount() {
+  return (uint32_t)(nowUs * 240);
+}
+
+unsigned long millis() { return (unsigned long)(nowUs / 1000); }
+unsigned long micros() { return (unsigned long)nowUs; }
+void delay(unsigned long ms) { hostAdvanceMs(ms); }
+void delayMicroseconds(unsigned int us) { hostAdvanceUs(us); }
+void yield() {}
+
+uint32_t getCpuFrequencyMhz() { return 240; }
+uint32_t getXtalFrequencyMhz() { return 40; }
+
+// Input levels, HIGH until a test sets them, and the CHANGE interrupts
+// attached to them
+struct HostPin {
+  uint8_t level = HIGH;
+  void (*handler)(void*) = nullptr;
+  void* arg = nullptr;
+};
+static HostPin pins[64];
+
+void hostSetPin(uint8_t pin, int level) {
+  HostPin& p = pins[pin & 63];
+  if (p.level == (uint8_t)level) return;
+  p.level = (uint8_t)level;
+  if (p.handler) p.handler(p.arg);
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t pin) { return pins[pin & 63].level; }
+int analogRead(uint8_t) { return 0; }
+static void callPlain(void* handler) { ((void (*)(void))handler)(); }
+void attachInterrupt(uint8_t pin, void (*handler)(void), int) {
+  pins[pin & 63].handler = callPlain;
+  pins[pin & 63].arg = (void*)handler;
+}
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int) {
+  pins[pin & 63].handler = handler;
+  pins[pin & 63].arg = arg;
+}
+void detachInterrupt(uint8_t pin) { pins[pin & 63].handler = nullptr; }
+
+uint32_t esp_random() { return (uint32_t)rand() << 16 ^ (uint32_t)rand(); }
+long random(long max) { return max > 0 ? rand() % max : 0; }
+long random(long min, long max) { return max > min ? min + rand() % (max - min) : min; }
+
+// ---- I2C
+
+static HostI2CDevice* i2cDevices[128];
+
+// Transfers take bus time at 100 kHz, 9 clocks a byte, address included,
+// so code that polls a device sees time pass
+static void i2cTransfer(size_t bytes) {
+  hostAdvanceUs((bytes + 1) * 90);
+}
+
+void hostAttachI2C(uint8_t address, HostI2CDevice* device) {
+  i2cDevices[address & 0x7F] = device;
+}
+
+void TwoWire::beginTransmission(uint8_t to) {
+  address = to & 0x7F;
+  transmit.clear();
+}
+
+size_t TwoWire::write(uint8_t value) {
+  transmit.push_back(value);
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+  HostI2CDevice* device = i2cDevices[address];
+  if (!device) {
+    i2cTransfer(0);
+    return 2;
+  }
+  i2cTransfer(transmit.size());
+  device->write(transmit.data(), transmit.size());
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t from, uint8_t count) {
+  HostI2CDevice* device = i2cDevices[from & 0x7F];
+  received.clear();
+  readPosition = 0;
+  if (!device) {
+    i2cTransfer(0);
+    return 0;
+  }
+  i2cTransfer(count);
+  for (uint8_t i = 0; i < count; i++) {
+    received.push_back(device->read());
+  }
+  return count;
+}
+
+// ---- Network
+
+static std::map<std::string, IPAddress> servers;
+static int lookups = 0;
+static std::vector<HostPacket> sentPackets;
+static std::deque<HostPacket> incoming;
+
+void hostAddServer(const char* name, IPAddress ip) {
+  servers[name] = ip;
+}
+
+int hostLookups() {
+  return lookups;
+}
+
+std::vector<HostPacket>& hostSentPackets() {
+  return sentPackets;
+}
+
+void hostDeliverPacket(IPAddress from, const uint8_t* data, size_t size) {
+  HostPacket packet;
+  packet.ip = from;
+  packet.port = 123;
+  packet.data.assign(data, data + size);
+  incoming.push_back(packet);
+}
+
+int WiFiClass::hostByName(const char* host, IPAddress& result) {
+  lookups++;
+  std::map<std::string, IPAddress>::iterator it = servers.find(host);
+  if (it == servers.end()) return 0;
+  result = it->second;
+  return 1;
+}
+
+int WiFiUDP::beginPacket(const char* host, uint16_t port) {
+  IPAddress ip;
+  return WiFi.hostByName(host, ip) ? beginPacket(ip, port) : 0;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+  destination = ip;
+  destinationPort = port;
+  sending.clear();
+  return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t* data, size_t size) {
+  sending.insert(sending.end(), data, data + size);
+  return size;
+}
+
+int WiFiUDP::endPacket() {
+  HostPacket packet;
+  packet.ip = destination;
+  packet.port = destinationPort;
+  packet.data = sending;
+  sentPackets.push_back(packet);
+  return 1;
+}
+
+int WiFiUDP::parsePacket() {
+  if (incoming.empty()) return 0;
+  received = incoming.front().data;
+  source = incoming.front().ip;
+  incoming.pop_front();
+  readPosition = 0;
+  return (int)received.size();
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t size) {
+  size_t n = std::min(size, received.size() - readPosition);
+  memcpy(buffer, received.data() + readPosition, n);
+  readPosition += n;
+  return (int)n;
+}
+
+void WiFiUDP::flush() {
+  readPosition = received.size();
+}
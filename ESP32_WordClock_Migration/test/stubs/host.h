@@ -0,0 +1,59 @@
+#ifndef HOST_H
+#define HOST_H
+
+// Controls for the simulated board, used by tests. Time only moves when a
+// test calls hostAdvanceUs(), or when the code under test blocks (delay(),
+// a queue receive with a timeout); esp_timer callbacks run as it passes
+// their due time, in order.
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <vector>
+
+// Microseconds since "boot", what esp_timer_get_time() returns
+uint64_t hostNowUs();
+void hostAdvanceUs(uint64_t us);
+inline void hostAdvanceMs(uint32_t ms) { hostAdvanceUs(ms * 1000ULL); }
+
+// Due time of the earliest running esp_timer, 0 if none
+uint64_t hostNextTimerUs();
+
+// Queue receives with a timeout give up by this time at the latest, so a
+// test can stop a blocked loop() at a point in time; 0 clears it
+void hostWakeBy(uint64_t us);
+
+// gettimeofday() counts from this many seconds at boot (retainedMicros())
+void hostSetRetainedBase(uint64_t seconds);
+
+// Runs boot() in a child process, as the board after a reset: it starts
+// from the state the caller is in (at the top of main(), as after power
+// on) and leaves nothing behind but RTC memory. Returns boot()'s result,
+// or 1 if the child crashed.
+int hostBoot(int (*boot)());
+
+// RTC memory (RTC_NOINIT_ATTR data), for tests to corrupt between boots
+uint8_t* hostRetainedMemory(size_t* size);
+
+// GPIO: set an input's level; an interrupt attached to it fires on a change
+void hostSetPin(uint8_t pin, int level);
+
+// I2C: attach a simulated device at an address, nullptr detaches
+class HostI2CDevice;
+void hostAttachI2C(uint8_t address, HostI2CDevice* device);
+
+// Network: names WiFi.hostByName() resolves, and how often it was asked
+void hostAddServer(const char* name, IPAddress ip);
+int hostLookups();
+
+// Datagrams sent through WiFiUDP, oldest first; tests may clear it
+struct HostPacket {
+  IPAddress ip;
+  uint16_t port;
+  std::vector<uint8_t> data;
+};
+std::vector<HostPacket>& hostSentPackets();
+
+// Queue a datagram for the next WiFiUDP::parsePacket()
+void hostDeliverPacket(IPAddress from, const uint8_t* data, size_t size);
+
+#endif // HOST_H
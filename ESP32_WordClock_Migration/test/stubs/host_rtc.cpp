@@ -0,0 +1,150 @@
+// Simulated RTC chips; see host_rtc.h
+
+#include "host_rtc.h"
+#include "host.h"
+#include "civil_time.h"
+
+#define DS3231_AGING 0x10
+#define DS3231_CONTROL 0x0E
+#define DS3231_STATUS 0x0F
+#define DS3231_CONV 0x20
+#define DS3231_AGING_PPB 100      // Per step, + = slower
+#define PCF8523_CONTROL_1 0x00
+#define PCF8523_CONTROL_3 0x02
+#define PCF8523_OFFSET 0x0E
+#define PCF8523_STOP 0x20
+#define PCF8523_OFFSET_PPB 4340   // Per step in two hour mode
+#define PCF8523_MINUTE_PPB 4069   // Per step in one minute mode
+
+static uint8_t toBCD(int value) { return (uint8_t)((value / 10) << 4 | value % 10); }
+static int fromBCD(uint8_t value) { return (value >> 4) * 10 + (value & 0x0F); }
+
+HostRTC::HostRTC(HostRTCChip rtcChip) : chip(rtcChip), pointer(0), fastPpb(0), appliedTrim(0) {
+  memset(registers, 0, sizeof(registers));
+  anchorHostUs = hostNowUs();
+  anchorRtcUs = daysFromCivil(2000, 1, 1) * 86400 * 1000000LL;
+  if (chip == HOST_RTC_DS3231) {
+    registers[DS3231_CONTROL] = 0x1C;
+    registers[DS3231_STATUS] = 0x80;    // OSF
+  } else {
+    registers[PCF8523_CONTROL_3] = 0xE0;  // Standby, not initialized
+  }
+  loadTime();
+  if (chip == HOST_RTC_PCF8523) {
+    registers[timeRegister()] |= 0x80;   // OS
+  }
+}
+
+// Net frequency error; + = fast
+int64_t HostRTC::ratePpb() const {
+  if (chip == HOST_RTC_DS3231) {
+    return fastPpb - (int64_t)appliedTrim * DS3231_AGING_PPB;
+  }
+  uint8_t offset = registers[PCF8523_OFFSET];
+  int steps = (offset & 0x40) ? (offset & 0x7F) - 128 : (offset & 0x7F);
+  return fastPpb - (int64_t)steps * ((offset & 0x80) ? PCF8523_MINUTE_PPB : PCF8523_OFFSET_PPB);
+}
+
+bool HostRTC::stopped() const {
+  return chip == HOST_RTC_PCF8523 && (registers[PCF8523_CONTROL_1] & PCF8523_STOP);
+}
+
+int64_t HostRTC::nowUs() {
+  if (stopped()) return anchorRtcUs;
+  int64_t elapsedUs = (int64_t)(hostNowUs() - anchorHostUs);
+  return anchorRtcUs + elapsedUs + elapsedUs / 1000 * ratePpb() / 1000000;
+}
+
+// Start a new stretch at the current time, before the rate changes
+void HostRTC::reanchor() {
+  anchorRtcUs = nowUs();
+  anchorHostUs = hostNowUs();
+}
+
+void HostRTC::loadTime() {
+  int64_t us = nowUs();
+  struct tm t;
+  epochToTm(us >= 0 ? us / 1000000 : (us - 999999) / 1000000, t);
+  uint8_t* r = &registers[timeRegister()];
+  uint8_t stopFlag = r[0] & 0x80;
+  r[0] = toBCD(t.tm_sec) | (chip == HOST_RTC_PCF8523 ? stopFlag : 0);
+  r[1] = toBCD(t.tm_min);
+  r[2] = toBCD(t.tm_hour);
+  if (chip == HOST_RTC_DS3231) {
+    r[3] = toBCD(t.tm_wday == 0 ? 7 : t.tm_wday);
+    r[4] = toBCD(t.tm_mday);
+    r[5] = toBCD(t.tm_mon + 1);
+  } else {
+    r[3] = toBCD(t.tm_mday);
+    r[4] = toBCD(t.tm_wday);
+    r[5] = toBCD(t.tm_mon + 1);
+  }
+  r[6] = toBCD(t.tm_year + 1900 - 2000);
+}
+
+// Writing the time resets the divider chain: the new second starts now
+void HostRTC::storeTime() {
+  const uint8_t* r = &registers[timeRegister()];
+  struct tm t;
+  memset(&t, 0, sizeof(t));
+  t.tm_sec = fromBCD(r[0] & 0x7F);
+  t.tm_min = fromBCD(r[1]);
+  t.tm_hour = fromBCD(r[2]);
+  t.tm_mday = fromBCD(chip == HOST_RTC_DS3231 ? r[4] : r[3]);
+  t.tm_mon = fromBCD(r[5] & 0x1F) - 1;
+  t.tm_year = fromBCD(r[6]) + 100;
+  anchorRtcUs = tmToEpoch(t) * 1000000LL;
+  anchorHostUs = hostNowUs();
+}
+
+void HostRTC::write(const uint8_t* data, size_t size) {
+  if (size == 0) return;
+  pointer = data[0];
+  if (size == 1) return;
+
+  loadTime();
+  bool timeWritten = false;
+  for (size_t i = 1; i < size; i++) {
+    uint8_t reg = pointer++ % sizeof(registers);
+    if (reg >= timeRegister() && reg < timeRegister() + 7) {
+      timeWritten = true;
+    }
+    if (reg == PCF8523_OFFSET || reg == PCF8523_CONTROL_1) {
+      reanchor();
+    }
+    registers[reg] = data[i];
+    if (chip == HOST_RTC_DS3231 && reg == DS3231_CONTROL && (data[i] & DS3231_CONV)) {
+      // Temperature conversion: the new aging value takes effect
+      reanchor();
+      appliedTrim = (int8_t)registers[DS3231_AGING];
+      registers[DS3231_CONTROL] &= ~DS3231_CONV;
+    }
+  }
+  if (timeWritten) {
+    storeTime();
+  }
+}
+
+uint8_t HostRTC::read() {
+  if (pointer >= timeRegister() && pointer < timeRegister() + 7) {
+    loadTime();
+  }
+  return registers[pointer++ % sizeof(registers)];
+}
+
+void HostRTC::setFastPpb(int64_t ppb) {
+  reanchor();
+  fastPpb = ppb;
+}
+
+void HostRTC::setTime(int64_t unixUs) {
+  anchorRtcUs = unixUs;
+  anchorHostUs = hostNowUs();
+  if (chip == HOST_RTC_DS3231) {
+    registers[DS3231_STATUS] &= ~0x80;
+  } else {
+    registers[timeRegister()] &= ~0x80;
+    registers[PCF8523_CONTROL_3] = 0x00;
+    registers[PCF8523_CONTROL_1] &= ~PCF8523_STOP;
+  }
+}
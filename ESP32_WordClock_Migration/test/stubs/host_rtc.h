@@ -0,0 +1,47 @@
+#ifndef HOST_RTC_H
+#define HOST_RTC_H
+
+// Simulated DS3231 and PCF8523 for the I2C bus stub: a register file
+// whose time registers follow a clock with its own frequency error,
+// trimmed by the aging (DS3231) or offset (PCF8523) register as the
+// chips do. Both power up as after a battery change: oscillator stop
+// flag set, time invalid.
+
+#include <Wire.h>
+
+enum HostRTCChip {
+  HOST_RTC_DS3231,
+  HOST_RTC_PCF8523
+};
+
+class HostRTC : public HostI2CDevice {
+private:
+  HostRTCChip chip;
+  uint8_t registers[32];
+  uint8_t pointer;
+  int64_t fastPpb;        // Crystal error before trimming
+  int appliedTrim;        // DS3231 aging only takes effect on a conversion
+  uint64_t anchorHostUs;  // hostNowUs() when the RTC read anchorRtcUs
+  int64_t anchorRtcUs;    // RTC time, Unix microseconds
+
+  uint8_t timeRegister() const { return chip == HOST_RTC_DS3231 ? 0x00 : 0x03; }
+  int64_t ratePpb() const;
+  void reanchor();
+  void loadTime();        // Time registers from the clock
+  void storeTime();       // Clock from the time registers
+  bool stopped() const;
+
+public:
+  HostRTC(HostRTCChip chip);
+
+  void write(const uint8_t* data, size_t size);
+  uint8_t read();
+
+  // Test controls
+  void setFastPpb(int64_t ppb);
+  void setTime(int64_t unixUs);   // Valid, running, stop flag cleared
+  int64_t nowUs();                // RTC time, Unix microseconds
+  uint8_t registerValue(uint8_t reg) const { return registers[reg]; }
+};
+
+#endif // HOST_RTC_H
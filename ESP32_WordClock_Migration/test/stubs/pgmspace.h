@@ -0,0 +1,7 @@
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+// Flash is plain memory on the host; the pgm_read_* macros are in Arduino.h
+#include "Arduino.h"
+
+#endif // HOST_PGMSPACE_H
@@ -0,0 +1,136 @@
+// The refresh paths must not touch the heap: the clock, WordClock and
+// settings screens run for the life of the device, and fragmentation
+// from String formatting there is what used to wear the heap down.
+// operator new and the modules' malloc() (linked with --wrap, see the
+// Makefile) are counted while each path runs, after one warm-up pass
+// that builds the screen layouts.
+
+#include "test_check.h"
+#include "host.h"
+#include <new>
+#include <Adafruit_ST7789.h>
+#include <Adafruit_NeoMatrix.h>
+#include "../include/display_manager.h"
+#include "../include/matrix_renderer.h"
+#include "../include/settings_manager.h"
+#include "../include/static_string.h"
+#include "../include/time_manager.h"
+#include "../include/wifi_manager.h"
+
+static bool counting = false;
+static long allocations = 0;
+
+static void* counted(void* p) {
+  if (counting) allocations++;
+  return p;
+}
+
+void* operator new(size_t size) { return counted(malloc(size)); }
+void* operator new[](size_t size) { return counted(malloc(size)); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t size);
+void* __wrap_malloc(size_t size) { return counted(__real_malloc(size)); }
+void* __wrap_calloc(size_t n, size_t size) { return counted(__real_calloc(n, size)); }
+void* __wrap_realloc(void* p, size_t size) { return counted(__real_realloc(p, size)); }
+}
+
+static Adafruit_ST7789 tft(TFT_CS, TFT_DC, TFT_RST);
+static Adafruit_NeoMatrix matrix(8, 8, 0, 0, 0);
+
+// Runs fn once to warm up, then n more times counting allocations
+template <class Fn>
+static long allocationsIn(int n, Fn fn) {
+  fn(0);
+  allocations = 0;
+  counting = true;
+  for (int i = 1; i <= n; i++) fn(i);
+  counting = false;
+  return allocations;
+}
+
+// As StateMachine::drawClock()
+static void drawClock(int) {
+  StaticString<12> timeString;
+  StaticString<12> dateString;
+  timeManager.getFormattedTime(timeString);
+  timeManager.getFormattedDate(dateString);
+  displayClockScreen(tft, timeString.c_str(), dateString.c_str(), timeManager.getStatusString(), "UTC-6 DST");
+  hostAdvanceMs(1000);
+}
+
+// As StateMachine::drawWordClock()
+static void drawWordClock(int) {
+  struct tm timeinfo = timeManager.snapshot();
+  displayWordClockMode(tft, matrix, &timeinfo);
+  hostAdvanceMs(60000);
+}
+
+// As StateMachine::drawSettings(), cycling through every option
+static void drawSettings(int i) {
+  switch (i % 3) {
+    case 0: settingsManager.selectNextTimezone(); break;
+    case 1: settingsManager.setDSTRules(settingsManager.getNextDSTRules(settingsManager.getDSTRules())); break;
+    case 2: settingsManager.setBrightness((settingsManager.getBrightness() + 10) % 110); break;
+  }
+  ClockSettings settings = settingsManager.getSettings();
+  StaticString<TZ_NAME_LENGTH> timezoneName;
+  settingsManager.getCurrentTimezoneDisplayName(timezoneName);
+  StaticString<48> timezoneStr;
+  timezoneStr.printf("Timezone: %s", timezoneName.c_str());
+  StaticString<30> dstStr;
+  dstStr.printf("DST: %s", settingsManager.hasTimezoneName() ? "Zone Rules" : settingsManager.getDSTRulesDisplayName(settings.dstRules));
+  StaticString<30> brightnessStr;
+  brightnessStr.printf("Brightness: %d%%", settings.brightness);
+  StaticString<80> status;
+  settingsManager.getStatusString(status);
+  displaySettingsMenu(tft, i % 4, timezoneStr.c_str(), dstStr.c_str(), brightnessStr.c_str(), "Save & Exit");
+}
+
+// As the password entry state: type, delete, redraw
+static StaticString<64> password;
+static void typePassword(int i) {
+  if (i % 5 == 4) {
+    password.truncate(password.length() - 1);
+  } else {
+    password.append((char)('a' + i % 26));
+  }
+  displayPasswordEntry(tft, matrix, "HomeNetwork", password.c_str(), 'a' + i % 26);
+}
+
+int main() {
+  settingsManager.initialize();
+  matrixRenderer.begin(matrix);
+  tft.setRotation(3);
+  // 2024-03-10 06:59:00 UTC: the WordClock run crosses the US DST change
+  timeManager.setHoldoverTime(fixedFromMicros(1710053940ULL * 1000000), hostNowUs());
+
+  long n;
+  n = allocationsIn(200, drawClock);
+  CHECK(n == 0, "clock screen: %ld allocations in 200 refreshes", n);
+
+  n = allocationsIn(200, drawWordClock);
+  CHECK(n == 0, "WordClock screen: %ld allocations in 200 refreshes", n);
+
+  n = allocationsIn(300, drawSettings);
+  CHECK(n == 0, "settings menu: %ld allocations in 300 changes", n);
+
+  n = allocationsIn(100, typePassword);
+  CHECK(n == 0, "password entry: %ld allocations in 100 keys", n);
+  CHECK(password.length() == 61, "password is %u characters", (unsigned)password.length());
+
+  // Sanity: the counter does see a String copy
+  counting = true;
+  allocations = 0;
+  String ssid = getSelectedSSID();
+  counting = false;
+  CHECK(allocations > 0 && ssid.length() == 0, "String copy not counted");
+
+  return TEST_RESULT("test_alloc");
+}
@@ -0,0 +1,193 @@
+// Button traces replayed through the pin interrupts: every file in
+// traces/ lists timed edges and the gestures they must decode to. The
+// loop is simulated as in main.cpp: it waits for buttonWaitMs() or the
+// next interrupt, or, with "loop <ms>", is busy that long on each pass.
+//
+//   # comment
+//   loop 200                  each pass takes this long (default 0)
+//   <ms> <A|B|C> <down|up>    edge at ms after the trace starts
+//   expect <ms> <A|B|C> <short|double|long|repeat>
+//
+// Expected events must come in order, with the time they report.
+
+#include "test_check.h"
+#include "host.h"
+#include <dirent.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../include/button_handler.h"
+#include "../include/event_loop.h"   // EVENT_WAIT_MAX_MS
+
+// Pins as main.cpp has them
+const int BUTTON_A = 0;
+const int BUTTON_B = 1;
+const int BUTTON_C = 2;
+
+static const int pinOf[BUTTON_COUNT] = {BUTTON_A, BUTTON_B, BUTTON_C};
+static const int pressedLevel[BUTTON_COUNT] = {LOW, HIGH, HIGH};
+static const char* const gestureNames[] = {"short", "double", "long", "repeat"};
+
+struct TraceEdge {
+  uint32_t ms;
+  int button;
+  bool pressed;
+};
+
+struct TraceEvent {
+  uint32_t ms;
+  int button;
+  int gesture;
+};
+
+struct Trace {
+  uint32_t loopMs;
+  std::vector<TraceEdge> edges;
+  std::vector<TraceEvent> expected;
+};
+
+static int buttonIndex(const char* name) {
+  return name[0] >= 'A' && name[0] <= 'C' && name[1] == '\0' ? name[0] - 'A' : -1;
+}
+
+static int gestureIndex(const char* name) {
+  for (int g = 0; g < 4; g++) {
+    if (strcmp(name, gestureNames[g]) == 0) return g;
+  }
+  return -1;
+}
+
+static bool loadTrace(const std::string& path, Trace& trace) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f) return false;
+  trace.loopMs = 0;
+  char line[128];
+  int lineNumber = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), f)) {
+    lineNumber++;
+    char* hash = strchr(line, '#');
+    if (hash) *hash = '\0';
+    char a[16], b[16], c[16], d[16];
+    int n = sscanf(line, "%15s %15s %15s %15s", a, b, c, d);
+    if (n <= 0) continue;
+    if (n == 2 && strcmp(a, "loop") == 0) {
+      trace.loopMs = (uint32_t)atoi(b);
+    } else if (n == 3 && buttonIndex(b) >= 0 && (strcmp(c, "down") == 0 || strcmp(c, "up") == 0)) {
+      TraceEdge edge = {(uint32_t)atoi(a), buttonIndex(b), strcmp(c, "down") == 0};
+      trace.edges.push_back(edge);
+    } else if (n == 4 && strcmp(a, "expect") == 0 && buttonIndex(c) >= 0 && gestureIndex(d) >= 0) {
+      TraceEvent event = {(uint32_t)atoi(b), buttonIndex(c), gestureIndex(d)};
+      trace.expected.push_back(event);
+    } else {
+      printf("  %s:%d: can't read \"%s\"\n", path.c_str(), lineNumber, a);
+      ok = false;
+    }
+  }
+  fclose(f);
+  std::stable_sort(trace.edges.begin(), trace.edges.end(),
+                   [](const TraceEdge& x, const TraceEdge& y) { return x.ms < y.ms; });
+  return ok;
+}
+
+static void releaseAll() {
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    hostSetPin(pinOf[b], pressedLevel[b] == HIGH ? LOW : HIGH);
+  }
+}
+
+// Plays the edges on the pins and collects what the loop decodes
+static std::vector<TraceEvent> replay(const Trace& trace) {
+  std::vector<TraceEvent> events;
+  uint64_t startUs = hostNowUs();
+  uint64_t wakeUs = startUs;
+  uint64_t passUs = startUs;
+  size_t next = 0;
+  for (;;) {
+    uint64_t nowUs = hostNowUs();
+    if (nowUs >= wakeUs) {
+      // One loop pass: take every event, then block as loop() would
+      passUs = nowUs;
+      ButtonEvent event;
+      while (nextButtonEvent(event)) {
+        TraceEvent e = {(uint32_t)((event.timeUs - startUs) / 1000), event.button, event.gesture};
+        events.push_back(e);
+      }
+      uint32_t waitMs = max(buttonWaitMs(), trace.loopMs);
+      if (next == trace.edges.size() && waitMs >= EVENT_WAIT_MAX_MS) break;
+      wakeUs = passUs + waitMs * 1000ULL;
+    }
+
+    uint64_t edgeUs = next < trace.edges.size() ? startUs + trace.edges[next].ms * 1000ULL : UINT64_MAX;
+    hostAdvanceUs(min(wakeUs, edgeUs) - nowUs);
+    while (next < trace.edges.size() && startUs + trace.edges[next].ms * 1000ULL <= hostNowUs()) {
+      const TraceEdge& edge = trace.edges[next++];
+      int level = pressedLevel[edge.button];
+      hostSetPin(pinOf[edge.button], edge.pressed ? level : (level == HIGH ? LOW : HIGH));
+      // The interrupt wakes a waiting loop; a busy one finishes its pass
+      wakeUs = max(hostNowUs(), passUs + trace.loopMs * (uint64_t)1000);
+    }
+  }
+  return events;
+}
+
+static bool sameEvents(const std::vector<TraceEvent>& a, const std::vector<TraceEvent>& b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i].ms != b[i].ms || a[i].button != b[i].button || a[i].gesture != b[i].gesture) return false;
+  }
+  return true;
+}
+
+static void printEvents(const char* label, const std::vector<TraceEvent>& events) {
+  printf("  %s:", label);
+  for (size_t i = 0; i < events.size(); i++) {
+    printf(" %lu %c %s,", (unsigned long)events[i].ms, 'A' + events[i].button, gestureNames[events[i].gesture]);
+  }
+  printf("\n");
+}
+
+int main() {
+  releaseAll();
+  initializeButtons();
+
+  std::vector<std::string> names;
+  DIR* dir = opendir("traces");
+  CHECK(dir != nullptr, "no traces directory");
+  if (dir) {
+    while (struct dirent* entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name.size() > 6 && name.compare(name.size() - 6, 6, ".trace") == 0) names.push_back(name);
+    }
+    closedir(dir);
+  }
+  std::sort(names.begin(), names.end());
+  CHECK(!names.empty(), "no trace files");
+
+  for (size_t i = 0; i < names.size(); i++) {
+    Trace trace;
+    std::string path = "traces/" + names[i];
+    if (!loadTrace(path, trace)) {
+      CHECK(false, "%s does not load", path.c_str());
+      continue;
+    }
+
+    // Start each trace from idle buttons
+    releaseAll();
+    hostAdvanceMs(1000);
+    initializeButtons();
+    ButtonEvent stale;
+    while (nextButtonEvent(stale)) {}
+
+    std::vector<TraceEvent> events = replay(trace);
+    bool same = sameEvents(events, trace.expected);
+    CHECK(same, "%s decoded differently", names[i].c_str());
+    if (!same) {
+      printEvents("expected", trace.expected);
+      printEvents("decoded", events);
+    }
+  }
+  CHECK(getButtonOverflows() == 0, "%lu edges lost", (unsigned long)getButtonOverflows());
+
+  return TEST_RESULT("test_buttons");
+}
@@ -0,0 +1,27 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+// Minimal check macros for the host tests: print each failure, count
+// them, and return the count from main() through TEST_RESULT().
+
+#include <stdio.h>
+
+static int testFailures = 0;
+static int testChecks = 0;
+
+#define CHECK(cond, ...)                                      \
+  do {                                                        \
+    testChecks++;                                             \
+    if (!(cond)) {                                            \
+      testFailures++;                                         \
+      printf("FAIL %s:%d: %s: ", __FILE__, __LINE__, #cond);  \
+      printf(__VA_ARGS__);                                    \
+      printf("\n");                                           \
+    }                                                         \
+  } while (0)
+
+#define TEST_RESULT(name)                                                   \
+  (printf("%s: %d checks, %d failed\n", name, testChecks, testFailures),    \
+   testFailures ? 1 : 0)
+
+#endif // TEST_CHECK_H
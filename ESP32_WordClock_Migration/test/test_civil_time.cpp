@@ -0,0 +1,65 @@
+// civil_time.h against gmtime_r()/timegm(): the last and first second of
+// every day from 1900 to 2200, the round trip through tmToEpoch(), and
+// the day counts at year boundaries.
+
+#include "test_check.h"
+#include <time.h>
+#include "../include/civil_time.h"
+
+static bool sameTm(const struct tm& a, const struct tm& b) {
+  return a.tm_sec == b.tm_sec && a.tm_min == b.tm_min && a.tm_hour == b.tm_hour &&
+         a.tm_mday == b.tm_mday && a.tm_mon == b.tm_mon && a.tm_year == b.tm_year &&
+         a.tm_wday == b.tm_wday && a.tm_yday == b.tm_yday;
+}
+
+// epochToTm() and tmToEpoch() for one second, reporting the first few failures
+static int failures = 0;
+static void checkSecond(int64_t epoch) {
+  time_t t = (time_t)epoch;
+  struct tm expected, actual;
+  gmtime_r(&t, &expected);
+  epochToTm(epoch, actual);
+  if (!sameTm(actual, expected) || tmToEpoch(actual) != epoch) {
+    if (failures++ < 5) {
+      printf("  at %lld: %04d-%02d-%02d %02d:%02d:%02d wday %d yday %d, round trip %lld\n", (long long)epoch,
+             actual.tm_year + 1900, actual.tm_mon + 1, actual.tm_mday, actual.tm_hour, actual.tm_min,
+             actual.tm_sec, actual.tm_wday, actual.tm_yday, (long long)tmToEpoch(actual));
+    }
+  }
+}
+
+int main() {
+  const int64_t firstDay = daysFromCivil(1900, 1, 1);
+  const int64_t endDay = daysFromCivil(2201, 1, 1);
+  int badDates = 0;
+  for (int64_t day = firstDay; day < endDay; day++) {
+    checkSecond(day * 86400);
+    checkSecond(day * 86400 + 86399);
+    CivilDate date = civilFromDays(day);
+    if (daysFromCivil(date.year, date.month, date.day) != day || daysFromEpoch(day * 86400 + 43200) != day) {
+      badDates++;
+    }
+  }
+  CHECK(failures == 0, "%d seconds differ from gmtime_r", failures);
+  CHECK(badDates == 0, "%d days do not round trip", badDates);
+
+  // Year lengths and Gregorian leap years
+  int badYears = 0;
+  for (int year = 1900; year <= 2200; year++) {
+    int64_t length = daysFromCivil(year + 1, 1, 1) - daysFromCivil(year, 1, 1);
+    if (length != (isLeapYear(year) ? 366 : 365)) badYears++;
+  }
+  CHECK(badYears == 0, "%d years with the wrong length", badYears);
+  CHECK(!isLeapYear(1900) && isLeapYear(2000) && !isLeapYear(2100) && isLeapYear(2104), "leap years");
+
+  // Past the 32-bit limits: 2038-01-19 and 2106-02-07
+  struct tm t;
+  epochToTm(2147483648LL, t);
+  CHECK(t.tm_year == 138 && t.tm_mon == 0 && t.tm_mday == 19 && t.tm_hour == 3 && t.tm_min == 14 && t.tm_sec == 8,
+        "2^31 s is %04d-%02d-%02d %02d:%02d:%02d", t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec);
+  epochToTm(4294967296LL, t);
+  CHECK(t.tm_year == 206 && t.tm_mon == 1 && t.tm_mday == 7 && t.tm_hour == 6 && t.tm_min == 28 && t.tm_sec == 16,
+        "2^32 s is %04d-%02d-%02d %02d:%02d:%02d", t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec);
+
+  return TEST_RESULT("test_civil_time");
+}
@@ -0,0 +1,134 @@
+// NTP sync against simulated servers on the host network: server lookups
+// are kept across failed syncs and refreshed daily, only replies that echo the request's nonce are used,
+// replies from unsynchronized servers are rejected, a falseticker is
+// outvoted, and the clock discipline learns the oscillator's error.
+
+#include "test_check.h"
+#include "fake_ntp.h"
+
+int main() {
+  addFakeServers();
+
+  // Each server is looked up once and sent one request by address
+  CHECK(timeManager.startSync(), "sync did not start");
+  CHECK(hostLookups() == NTP_SERVER_COUNT, "%d lookups for the first round", hostLookups());
+  CHECK(hostSentPackets().size() == NTP_SERVER_COUNT, "%d requests sent", (int)hostSentPackets().size());
+
+  // Replies that don't echo the nonce are ignored: the round times out
+  // and is sent again, without new lookups
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) servers[i].wrongNonce = true;
+  answerRequests();
+  CHECK(timeManager.poll() == NTP_POLL_PENDING, "sync ended on replies with the wrong nonce");
+  CHECK(!timeManager.isTimeValid(), "time taken from a reply with the wrong nonce");
+  hostAdvanceMs(1500);
+  CHECK(timeManager.poll() == NTP_POLL_PENDING, "no second round");
+  CHECK(hostSentPackets().size() == NTP_SERVER_COUNT, "%d requests in the second round", (int)hostSentPackets().size());
+  CHECK(hostLookups() == NTP_SERVER_COUNT, "%d lookups after the second round", hostLookups());
+
+  // One good reply is enough
+  servers[1].wrongNonce = false;
+  answerRequests();
+  CHECK(finishSync() == NTP_POLL_SUCCESS, "sync with one matching reply failed");
+  int64_t errorUs = clockErrorUs();
+  CHECK(errorUs > -1000 && errorUs < 1000, "clock off by %lld us after sync", (long long)errorUs);
+
+  // Later syncs reuse the addresses
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) servers[i].wrongNonce = false;
+  hostAdvanceMs(60000);
+  CHECK(timeManager.forceSync(), "second sync did not start");
+  answerRequests();
+  CHECK(finishSync() == NTP_POLL_SUCCESS, "second sync failed");
+  CHECK(hostLookups() == NTP_SERVER_COUNT, "%d lookups after the second sync", hostLookups());
+
+  // A failed sync keeps the addresses: with the uplink down, lookups
+  // would only wait out their timeouts on every retry
+  timeManager.forceSync();
+  hostSentPackets().clear();
+  CHECK(finishSync() == NTP_POLL_FAILED, "sync without replies did not fail");
+  timeManager.forceSync();
+  CHECK(hostLookups() == NTP_SERVER_COUNT, "%d lookups after a failed sync", hostLookups());
+  answerRequests();
+  CHECK(finishSync() == NTP_POLL_SUCCESS, "sync after the failure failed");
+
+  // A day on they are looked up again
+  hostAdvanceMs(86400000);
+  CHECK(sync() == NTP_POLL_SUCCESS, "sync a day later failed");
+  CHECK(hostLookups() == 2 * NTP_SERVER_COUNT, "%d lookups a day later", hostLookups());
+
+  // A name that does not resolve is tried again next sync, the others
+  // are not; the sync goes on without it
+  timeManager.setNTPServer("unknown.example");
+  hostAdvanceMs(60000);
+  CHECK(sync() == NTP_POLL_SUCCESS, "sync without the configured server failed");
+  CHECK(timeManager.getServersQueried() == NTP_SERVER_COUNT - 1, "%d servers queried without the configured one",
+        timeManager.getServersQueried());
+  CHECK(hostLookups() == 2 * NTP_SERVER_COUNT + 1, "%d lookups for an unknown name", hostLookups());
+  hostAdvanceMs(60000);
+  CHECK(sync() == NTP_POLL_SUCCESS, "second sync without the configured server failed");
+  CHECK(hostLookups() == 2 * NTP_SERVER_COUNT + 2, "%d lookups after the unknown name failed again", hostLookups());
+  timeManager.setNTPServer(servers[0].name);
+  hostAdvanceMs(60000);
+  CHECK(sync() == NTP_POLL_SUCCESS, "sync with the configured server back failed");
+  CHECK(timeManager.getServersQueried() == NTP_SERVER_COUNT, "%d servers queried", timeManager.getServersQueried());
+
+  // Replies from unsynchronized servers never set the clock: a sync where
+  // every server has the fault fails, one good server is enough
+  struct { const char* fault; uint8_t leap; uint8_t stratum; bool zeroTransmit; } faults[] = {
+    {"stratum 0", 0, 0, false},
+    {"leap indicator 3", 3, 2, false},
+    {"stratum 16", 0, 16, false},
+    {"zero transmit timestamp", 0, 2, true},
+  };
+  for (size_t f = 0; f < sizeof(faults) / sizeof(faults[0]); f++) {
+    for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+      servers[i].leap = faults[f].leap;
+      servers[i].stratum = faults[f].stratum;
+      servers[i].zeroTransmit = faults[f].zeroTransmit;
+    }
+    hostAdvanceMs(60000);
+    uint64_t lastSync = timeManager.getLastSyncTime();
+    CHECK(sync() == NTP_POLL_FAILED, "%s accepted", faults[f].fault);
+    CHECK(timeManager.getLastSyncTime() == lastSync, "%s moved the sync time", faults[f].fault);
+
+    servers[2].leap = 0;
+    servers[2].stratum = 2;
+    servers[2].zeroTransmit = false;
+    hostAdvanceMs(60000);
+    CHECK(sync() == NTP_POLL_SUCCESS, "%s from two servers stopped the sync", faults[f].fault);
+  }
+  for (int i = 0; i < NTP_SERVER_COUNT; i++) {
+    servers[i].stratum = 2;
+    servers[i].zeroTransmit = false;
+  }
+
+  // A server 5 s off is a falseticker even with the smallest error bound:
+  // the other two agree, and one of them is used
+  servers[0].errorUs = 5000000;
+  servers[0].dispersion = 0;
+  hostAdvanceMs(60000);
+  CHECK(sync() == NTP_POLL_SUCCESS, "sync with a falseticker failed");
+  errorUs = clockErrorUs();
+  CHECK(errorUs > -1000 && errorUs < 1000, "clock off by %lld us after a falseticker", (long long)errorUs);
+  CHECK(strcmp(timeManager.getSelectedServer(), "pool.ntp.org") != 0, "falseticker selected");
+  CHECK(timeManager.getServersReplied() == 3 && timeManager.getServersQueried() == 3,
+        "%d of %d replied", timeManager.getServersReplied(), timeManager.getServersQueried());
+  servers[0].errorUs = 0;
+  servers[0].dispersion = 0x40;
+
+  // The local clock runs 50 ppm slow: syncs at the adapted interval teach
+  // the discipline the error, and then the clock keeps time between them
+  localSlowPpm = 50;
+  int64_t worstUs = 0;
+  for (int i = 0; i < 12; i++) {
+    hostAdvanceMs(timeManager.getSyncInterval());
+    int64_t beforeUs = clockErrorUs();
+    if (i >= 8 && (beforeUs < -worstUs || beforeUs > worstUs)) worstUs = beforeUs < 0 ? -beforeUs : beforeUs;
+    CHECK(sync() == NTP_POLL_SUCCESS, "drift sync %d failed", i);
+  }
+  int32_t drift = timeManager.getDriftPpb();
+  CHECK(drift > 49000 && drift < 51000, "drift %ld ppb, expected 50000", (long)drift);
+  CHECK(worstUs < 100000, "clock off by %lld us before a sync once trained", (long long)worstUs);
+  CHECK(timeManager.getSyncInterval() > 3600000UL, "poll interval still %lu ms", timeManager.getSyncInterval());
+
+  return TEST_RESULT("test_ntp");
+}
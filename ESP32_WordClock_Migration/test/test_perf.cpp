@@ -0,0 +1,96 @@
+// PerfCounters histogram and percentiles: bucket edges around 16 and
+// 32 us, the open-ended last bucket, and p50/p99 of known distributions,
+// which report the upper bound of their bucket, never above the maximum.
+
+#include "test_check.h"
+#include "../include/perf_counters.h"
+
+// Bucket a single sample of us lands in
+static int bucketOf(uint32_t us) {
+  PerfCounters perf;
+  perf.record(PERF_TFT_DRAW, us);
+  PerfProbeStats stats = perf.getStats(PERF_TFT_DRAW);
+  for (int b = 0; b < PERF_HISTOGRAM_BUCKETS; b++) {
+    if (stats.buckets[b]) return b;
+  }
+  return -1;
+}
+
+// count samples of us each
+static void recordMany(PerfCounters& perf, uint32_t us, int count) {
+  for (int i = 0; i < count; i++) perf.record(PERF_TFT_DRAW, us);
+}
+
+int main() {
+  // Bucket 0 is under 16 us, then bucket b holds [8 << b, 16 << b)
+  const struct { uint32_t us; int bucket; } edges[] = {
+    {0, 0}, {15, 0}, {16, 1}, {31, 1}, {32, 2}, {63, 2}, {64, 3},
+    {(8UL << 18) - 1, 17}, {8UL << 18, 18}, {(8UL << 19) - 1, 18},
+  };
+  for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+    int bucket = bucketOf(edges[i].us);
+    CHECK(bucket == edges[i].bucket, "%lu us in bucket %d, not %d", (unsigned long)edges[i].us, bucket,
+          edges[i].bucket);
+  }
+
+  // The last bucket is open ended, from 4.2 s
+  const int last = PERF_HISTOGRAM_BUCKETS - 1;
+  const uint32_t openEnded[] = {8UL << last, 10000000, UINT32_MAX};
+  for (size_t i = 0; i < sizeof(openEnded) / sizeof(openEnded[0]); i++) {
+    int bucket = bucketOf(openEnded[i]);
+    CHECK(bucket == last, "%lu us in bucket %d, not the last", (unsigned long)openEnded[i], bucket);
+  }
+
+  // No samples
+  PerfCounters perf;
+  CHECK(PerfCounters::percentileUs(perf.getStats(PERF_TFT_DRAW), 50) == 0, "percentile without samples");
+
+  // 50 fast, 49 medium, one slow: p50 is the first bucket's bound, p99
+  // the medium one's, p100 the maximum rather than the slow bucket's bound
+  recordMany(perf, 10, 50);
+  recordMany(perf, 100, 49);
+  recordMany(perf, 5000, 1);
+  PerfProbeStats stats = perf.getStats(PERF_TFT_DRAW);
+  CHECK(stats.count == 100 && stats.minUs == 10 && stats.maxUs == 5000, "count %lu, min %lu, max %lu",
+        (unsigned long)stats.count, (unsigned long)stats.minUs, (unsigned long)stats.maxUs);
+  CHECK(PerfCounters::percentileUs(stats, 50) == 16, "p50 %lu, not 16", (unsigned long)PerfCounters::percentileUs(stats, 50));
+  CHECK(PerfCounters::percentileUs(stats, 51) == 128, "p51 %lu, not 128", (unsigned long)PerfCounters::percentileUs(stats, 51));
+  CHECK(PerfCounters::percentileUs(stats, 99) == 128, "p99 %lu, not 128", (unsigned long)PerfCounters::percentileUs(stats, 99));
+  CHECK(PerfCounters::percentileUs(stats, 100) == 5000, "p100 %lu, not 5000", (unsigned long)PerfCounters::percentileUs(stats, 100));
+
+  // The rank rounds up: of 3 samples p50 is the second
+  perf.reset();
+  recordMany(perf, 20, 1);
+  recordMany(perf, 40, 1);
+  recordMany(perf, 80, 1);
+  stats = perf.getStats(PERF_TFT_DRAW);
+  CHECK(PerfCounters::percentileUs(stats, 50) == 64, "p50 of 3 is %lu, not 64", (unsigned long)PerfCounters::percentileUs(stats, 50));
+  CHECK(PerfCounters::percentileUs(stats, 1) == 32, "p1 of 3 is %lu, not 32", (unsigned long)PerfCounters::percentileUs(stats, 1));
+
+  // A bucket's bound is capped at the largest sample
+  perf.reset();
+  recordMany(perf, 20, 10);
+  stats = perf.getStats(PERF_TFT_DRAW);
+  CHECK(PerfCounters::percentileUs(stats, 50) == 20 && PerfCounters::percentileUs(stats, 99) == 20,
+        "p50 %lu, p99 %lu of a constant 20 us", (unsigned long)PerfCounters::percentileUs(stats, 50),
+        (unsigned long)PerfCounters::percentileUs(stats, 99));
+
+  // Everything in the open-ended bucket: only the maximum is known
+  perf.reset();
+  recordMany(perf, 5000000, 98);
+  recordMany(perf, 60000000, 2);
+  stats = perf.getStats(PERF_TFT_DRAW);
+  CHECK(stats.buckets[last] == 100, "%lu samples in the last bucket", (unsigned long)stats.buckets[last]);
+  CHECK(PerfCounters::percentileUs(stats, 50) == 60000000, "p50 %lu in the last bucket, not the maximum",
+        (unsigned long)PerfCounters::percentileUs(stats, 50));
+  CHECK(PerfCounters::percentileUs(stats, 99) == 60000000, "p99 %lu in the last bucket, not the maximum",
+        (unsigned long)PerfCounters::percentileUs(stats, 99));
+
+  // Cycles are converted at the CPU clock (240 MHz on the host)
+  perf.reset();
+  perf.recordCycles(PERF_TFT_DRAW, 240 * 100);
+  stats = perf.getStats(PERF_TFT_DRAW);
+  CHECK(stats.maxUs == 100 && stats.buckets[3] == 1, "24000 cycles recorded as %lu us", (unsigned long)stats.maxUs);
+
+  return TEST_RESULT("test_perf");
+}
@@ -0,0 +1,78 @@
+// drawRLEImage(): decodes runs and literals into the address window, and
+// never reads past the end of the data. Truncated images are placed right
+// before an inaccessible page, so a read past the end crashes the test.
+
+#include "test_check.h"
+#include "host.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <Adafruit_ST7789.h>
+#include "../include/rle_image.h"
+
+static Adafruit_ST7789 tft(TFT_CS, TFT_DC, TFT_RST);
+
+// 4x3: a run of 5 red, literal green/blue/white, a run of 4 black
+static const uint8_t imageData[] = {
+  0x84, 0xF8, 0x00,
+  0x02, 0x07, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
+  0x83, 0x00, 0x00
+};
+static const uint16_t imagePixels[12] = {
+  0xF800, 0xF800, 0xF800, 0xF800,
+  0xF800, 0x07E0, 0x001F, 0xFFFF,
+  0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// Copy of the first size bytes of imageData, ending at a guard page
+static const uint8_t* guarded(size_t size) {
+  static uint8_t* pages = nullptr;
+  long page = sysconf(_SC_PAGESIZE);
+  if (!pages) {
+    pages = (uint8_t*)mmap(nullptr, page * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    mprotect(pages + page, page, PROT_NONE);
+  }
+  uint8_t* copy = pages + page - size;
+  memcpy(copy, imageData, size);
+  return copy;
+}
+
+// Pixels that match the image, -1 if anything outside it was touched
+static int matchingPixels(int16_t x, int16_t y) {
+  int matching = 0;
+  for (int16_t py = 0; py < tft.height(); py++) {
+    for (int16_t px = 0; px < tft.width(); px++) {
+      bool inside = px >= x && px < x + 4 && py >= y && py < y + 3;
+      uint16_t color = tft.getPixel(px, py);
+      if (!inside && color != 0x1234) return -1;
+      if (inside && color == imagePixels[(py - y) * 4 + (px - x)]) matching++;
+    }
+  }
+  return matching;
+}
+
+int main() {
+  RLEImage image = {4, 3, imageData, sizeof(imageData)};
+
+  tft.fillScreen(0x1234);
+  drawRLEImage(tft, 10, 20, image);
+  CHECK(matchingPixels(10, 20) == 12, "whole image: %d of 12 pixels", matchingPixels(10, 20));
+
+  // Cut after a header, inside a color, and between packets: everything
+  // up to the last whole color is drawn (the last run's black would match
+  // an undrawn pixel, so the fill color isn't black)
+  const size_t cuts[] = {1, 2, 3, 4, 9, 10, 12};
+  const int expected[] = {0, 0, 5, 5, 7, 8, 8};
+  for (int i = 0; i < 7; i++) {
+    RLEImage cut = {4, 3, guarded(cuts[i]), (uint32_t)cuts[i]};
+    tft.fillScreen(0x1234);
+    drawRLEImage(tft, 10, 20, cut);
+    int drawn = matchingPixels(10, 20);
+    CHECK(drawn == expected[i], "cut at %u bytes: %d pixels drawn, %d expected", (unsigned)cuts[i], drawn, expected[i]);
+  }
+
+  tft.fillScreen(0x1234);
+  drawRLEImage(tft, tft.width() - 3, 0, image);
+  CHECK(matchingPixels(-10, -10) == 0, "off screen image drawn");
+
+  return TEST_RESULT("test_rle_image");
+}
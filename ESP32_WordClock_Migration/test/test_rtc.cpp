@@ -0,0 +1,88 @@
+// RtcClock against simulated DS3231 and PCF8523 chips on the I2C bus
+// stub: holdover time at boot, setting a chip that lost power, and
+// trimming a chip's frequency error from NTP time.
+
+#include "test_check.h"
+#include "fake_ntp.h"
+#include "host_rtc.h"
+#include "../include/rtc_clock.h"
+
+static HostRTC* rtc = nullptr;
+
+// update() every millisecond while the RTC wants it, as the main loop does
+static void serviceRTC() {
+  rtcClock.update();
+  for (int i = 0; i < 5000 && rtcClock.isMeasuring(); i++) {
+    hostAdvanceMs(1);
+    rtcClock.update();
+  }
+}
+
+// Hours of running, with an NTP sync and an RTC comparison each hour
+static void runHours(int hours) {
+  for (int i = 0; i < hours; i++) {
+    hostAdvanceMs(3600000);
+    sync();
+    serviceRTC();
+  }
+}
+
+static int64_t rtcErrorUs() {
+  return rtc->nowUs() - (int64_t)trueUtcUs();
+}
+
+int main() {
+  addFakeServers();
+  hostAdvanceMs(1234);
+
+  // Nothing on the bus
+  CHECK(!rtcClock.begin(RTC_CHIP_DS3231) && !rtcClock.isPresent(), "RTC found on an empty bus");
+
+  // A set DS3231 gives holdover time at boot, to within the rollover wait
+  rtc = new HostRTC(HOST_RTC_DS3231);
+  rtc->setTime(trueUtcUs());
+  hostAttachI2C(0x68, rtc);
+  CHECK(rtcClock.begin(RTC_CHIP_DS3231) && rtcClock.isPresent(), "DS3231 not found");
+  CHECK(timeManager.getTimeSource() == TIME_SOURCE_RTC, "no holdover time from the DS3231");
+  int64_t errorUs = clockErrorUs();
+  CHECK(errorUs > -2000 && errorUs < 2000, "holdover time off by %lld us", (long long)errorUs);
+
+  // 2 ppm fast: after the calibration baseline the aging register takes
+  // 20 steps of 0.1 ppm, and the RTC then keeps time
+  rtc->setFastPpb(2000);
+  CHECK(sync() == NTP_POLL_SUCCESS, "NTP sync failed");
+  serviceRTC();
+  runHours(13);
+  CHECK(rtcClock.readTrim() == 20, "DS3231 aging %d, expected 20", rtcClock.readTrim());
+  CHECK((rtc->registerValue(0x0E) & 0x20) == 0, "no temperature conversion to apply the aging");
+  int64_t startUs = rtcErrorUs();
+  runHours(24);
+  int64_t growthUs = rtcErrorUs() - startUs;
+  CHECK(growthUs > -5000 && growthUs < 5000, "trimmed DS3231 drifted %lld us in a day", (long long)growthUs);
+  CHECK(rtcClock.readTrim() == 20, "DS3231 aging moved to %d", rtcClock.readTrim());
+  int32_t lastErrorMs = rtcClock.getLastErrorMs();
+  CHECK(lastErrorMs > -50 && lastErrorMs < 50, "DS3231 error %ld ms", (long)lastErrorMs);
+
+  // A PCF8523 that lost power is set from NTP just after a second
+  // boundary, then its 8.7 ppm slow crystal is trimmed by two offset steps
+  delete rtc;
+  rtc = new HostRTC(HOST_RTC_PCF8523);
+  rtc->setFastPpb(-8680);
+  hostAttachI2C(0x68, rtc);
+  CHECK(rtcClock.begin(RTC_CHIP_PCF8523), "PCF8523 not found");
+  serviceRTC();
+  errorUs = rtcErrorUs();
+  CHECK(errorUs > -25000 && errorUs <= 0, "PCF8523 set %lld us off", (long long)errorUs);
+  CHECK((rtc->registerValue(0x03) & 0x80) == 0, "oscillator stop flag still set");
+  runHours(26);
+  CHECK(rtcClock.readTrim() == -2, "PCF8523 offset %d, expected -2", rtcClock.readTrim());
+  CHECK(rtc->registerValue(0x0E) == 0x7E, "offset register 0x%02X, expected two hour mode -2", rtc->registerValue(0x0E));
+  startUs = rtcErrorUs();
+  runHours(24);
+  growthUs = rtcErrorUs() - startUs;
+  CHECK(growthUs > -50000 && growthUs < 50000, "trimmed PCF8523 drifted %lld us in a day", (long long)growthUs);
+
+  hostAttachI2C(0x68, nullptr);
+  delete rtc;
+  return TEST_RESULT("test_rtc");
+}
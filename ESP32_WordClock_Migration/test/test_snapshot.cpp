@@ -0,0 +1,70 @@
+// TimeManager::snapshot() against gmtime_r(): the first call after a time
+// is set converts with epochToTm(), later ones step the cached fields with
+// advanceSecond(). Both are checked across every local midnight from 1970
+// until FixedTime runs out (whole seconds are 32 bits, so 2106-02-07),
+// and second by second through two whole days, one of them a leap day.
+
+#include "test_check.h"
+#include "host.h"
+#include "../include/settings_manager.h"
+#include "../include/time_manager.h"
+
+// Compares snapshot() with gmtime_r() of the local time for UTC second utc
+static bool snapshotMatches(int64_t utc) {
+  time_t local = (time_t)(utc + settingsManager.getUTCOffsetAt(utc));
+  struct tm expected;
+  gmtime_r(&local, &expected);
+  const struct tm& t = timeManager.snapshot();
+  bool same = t.tm_sec == expected.tm_sec && t.tm_min == expected.tm_min &&
+              t.tm_hour == expected.tm_hour && t.tm_mday == expected.tm_mday &&
+              t.tm_mon == expected.tm_mon && t.tm_year == expected.tm_year &&
+              t.tm_wday == expected.tm_wday && t.tm_yday == expected.tm_yday;
+  if (!same) {
+    printf("  at %lld: %04d-%02d-%02d %02d:%02d:%02d wday %d yday %d, expected %04d-%02d-%02d %02d:%02d:%02d wday %d yday %d\n",
+           (long long)utc, t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec, t.tm_wday, t.tm_yday,
+           expected.tm_year + 1900, expected.tm_mon + 1, expected.tm_mday, expected.tm_hour, expected.tm_min,
+           expected.tm_sec, expected.tm_wday, expected.tm_yday);
+  }
+  return same;
+}
+
+// Sets the time to utc, then checks seconds seconds of snapshots from there
+static int walk(int64_t utc, int seconds) {
+  timeManager.setHoldoverTime((FixedTime)utc << 32, hostNowUs());
+  int mismatches = 0;
+  for (int i = 0; i < seconds; i++) {
+    if (!snapshotMatches(utc + i) && ++mismatches > 5) break;
+    hostAdvanceMs(1000);
+  }
+  return mismatches;
+}
+
+int main() {
+  settingsManager.initialize();
+
+  // 23:59:58 to 00:00:02 local around every midnight
+  const int64_t lastDay = daysFromCivil(2106, 2, 6);
+  int badDays = 0;
+  for (int64_t day = 1; day <= lastDay && badDays <= 5; day++) {
+    int64_t midnight = day * 86400;
+    if (walk(midnight - settingsManager.getUTCOffsetAt(midnight) - 2, 5) > 0) badDays++;
+  }
+  CHECK(badDays == 0, "%d midnights wrong", badDays);
+
+  // Every second of 2023-12-31 and 2024-02-29 (one resync each)
+  int n = walk(daysFromCivil(2023, 12, 31) * 86400, 86400 + 2);
+  CHECK(n == 0, "%d seconds wrong around the new year", n);
+  n = walk(daysFromCivil(2024, 2, 29) * 86400, 86400 + 2);
+  CHECK(n == 0, "%d seconds wrong on the leap day", n);
+
+  // Larger steps fall back to a full conversion
+  int64_t utc = daysFromCivil(2000, 2, 28) * 86400 + 86000;
+  timeManager.setHoldoverTime((FixedTime)utc << 32, hostNowUs());
+  CHECK(snapshotMatches(utc), "first snapshot");
+  hostAdvanceMs(61000);
+  CHECK(snapshotMatches(utc + 61), "61 s step");
+  hostAdvanceMs(86400000);
+  CHECK(snapshotMatches(utc + 61 + 86400), "one day step");
+
+  return TEST_RESULT("test_snapshot");
+}
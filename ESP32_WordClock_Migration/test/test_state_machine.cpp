@@ -0,0 +1,261 @@
+// main.cpp's setup() and loop() on the simulated board, each boot in a
+// child process (hostBoot()) so it starts as from a reset:
+//
+//  - first boot: through the WiFi screens to a time sync that fails; the
+//    clock screen, which has no valid time and so no clock ticks, must
+//    come back by itself and retry the sync
+//  - reset with the time kept in RTC memory: straight to the clock, in
+//    the saved zone; a corrupt, foreign or stale record is not used
+//  - power on with the time in the RTC: the clock, in the saved zone,
+//    without the WiFi screens
+
+#include "test_check.h"
+#include "fake_ntp.h"
+#include "host_rtc.h"
+#include <Preferences.h>
+#include "../main.cpp"
+
+// RetainedTime in time_manager.cpp
+#define RECORD_UTC 0
+#define RECORD_CLOCK_US 8
+#define RECORD_MAGIC 16
+#define RECORD_CHECKSUM 44
+#define RETAINED_MAX_AGE_S 86400
+
+// The retained clock's reading at each reset boot, seconds
+static const uint64_t RESET_CLOCK_S = 1000000;
+
+// Berlin is UTC+2 in June; the default settings would give UTC-5
+static const char SAVED_ZONE[] = "Europe/Berlin";
+static const int SAVED_ZONE_OFFSET_S = 7200;
+
+static const HostNetwork networks[] = {{"HomeNet", -50, WIFI_AUTH_OPEN}};
+
+static void releaseButtons() {
+  hostSetPin(BUTTON_A, HIGH);   // A pulls low when pressed, B and C high
+  hostSetPin(BUTTON_B, LOW);
+  hostSetPin(BUTTON_C, LOW);
+}
+
+// loop() passes for ms of simulated time
+static void runFor(uint32_t ms) {
+  uint64_t endUs = hostNowUs() + ms * 1000ULL;
+  hostWakeBy(endUs);
+  while (hostNowUs() < endUs) {
+    loop();
+  }
+  hostWakeBy(0);
+}
+
+// A 100 ms press of B or C, through the pin interrupt
+static void press(int pin) {
+  hostSetPin(pin, HIGH);
+  runFor(100);
+  hostSetPin(pin, LOW);
+  runFor(500);
+}
+
+// Local time minus UTC on the clock
+static int zoneOffsetS() {
+  return (int)(timeManager.getCurrentEpoch() - (timeManager.getCurrentFixedTime() >> 32));
+}
+
+static int bootResult(const char* name) {
+  char label[64];
+  snprintf(label, sizeof(label), "test_state_machine %s", name);
+  return TEST_RESULT(label);
+}
+
+static int firstBoot() {
+  addFakeServers();
+  releaseButtons();
+  WiFi.networks = networks;
+  WiFi.networkCount = 1;
+
+  // Logo, startup message, scan, then B joins the open network and B
+  // again continues to the first time settings, which C saves
+  setup();
+  runFor(10000);
+  CHECK(stateMachine.getCurrentState() == STATE_WIFI_DISPLAY, "in state %d, not the network list",
+        stateMachine.getCurrentState());
+  press(BUTTON_B);
+  CHECK(stateMachine.getCurrentState() == STATE_WIFI_SUCCESS, "in state %d, not connected",
+        stateMachine.getCurrentState());
+  press(BUTTON_B);
+  press(BUTTON_C);
+  CHECK(stateMachine.getCurrentState() == STATE_TIME_SYNC, "in state %d, not syncing",
+        stateMachine.getCurrentState());
+
+  // No server answers: the sync fails and the clock shows without time
+  uint64_t syncUs = hostNowUs();
+  hostSentPackets().clear();
+  runFor(10000);
+  CHECK(stateMachine.getCurrentState() == STATE_CLOCK_DISPLAY, "in state %d after the failed sync",
+        stateMachine.getCurrentState());
+  CHECK(!timeManager.isTimeValid(), "time valid without a reply");
+
+  // Each failure is retried NTP_RETRY_INTERVAL_MS later: the first retry
+  // fails as well, the second one is answered
+  for (int retry = 1; retry <= 2; retry++) {
+    hostSentPackets().clear();
+    uint64_t failedUs = syncUs;
+    while (hostSentPackets().empty() && hostNowUs() - failedUs < 3 * NTP_RETRY_INTERVAL_MS * 1000ULL) {
+      runFor(1);  // Answered as soon as it is sent
+    }
+    CHECK(!hostSentPackets().empty(), "no retry %d after a failed sync", retry);
+    uint32_t gapMs = (uint32_t)((hostNowUs() - syncUs) / 1000);
+    CHECK(gapMs >= NTP_RETRY_INTERVAL_MS && gapMs <= NTP_RETRY_INTERVAL_MS + 10000,
+          "retry %d came %lu ms after the sync before", retry, (unsigned long)gapMs);
+    syncUs = hostNowUs();
+    if (retry == 1) {
+      runFor(10000);
+      CHECK(!timeManager.isTimeValid(), "time valid without a reply");
+    }
+  }
+  CHECK(answerRequests() == NTP_SERVER_COUNT, "retry sent to %d servers", (int)hostSentPackets().size());
+  runFor(100);
+  CHECK(timeManager.isTimeValid(), "retried sync did not set the time");
+  int64_t errorUs = clockErrorUs();
+  CHECK(errorUs > -5000 && errorUs < 5000, "clock off by %lld us after the retry", (long long)errorUs);
+
+  // Now the clock ticks every second
+  EventLoopStats before = eventLoop.getStats();
+  runFor(5000);
+  EventLoopStats after = eventLoop.getStats();
+  uint32_t ticks = after.events[EVENT_TICK] - before.events[EVENT_TICK];
+  CHECK(ticks >= 4 && ticks <= 6, "%lu clock ticks in 5 s", (unsigned long)ticks);
+
+  return bootResult("first boot");
+}
+
+// The retained record must be used: clock at once, in the saved zone
+static int warmBoot() {
+  releaseButtons();
+  setup();
+  CHECK(stateMachine.getCurrentState() == STATE_CLOCK_DISPLAY, "in state %d after a reset, not the clock",
+        stateMachine.getCurrentState());
+  CHECK(timeManager.getTimeSource() == TIME_SOURCE_RETAINED, "time source %d, not the retained time",
+        timeManager.getTimeSource());
+  int64_t errorUs = clockErrorUs();
+  CHECK(errorUs > -5000 && errorUs < 5000, "retained time off by %lld us", (long long)errorUs);
+  runFor(3000);
+  CHECK(zoneOffsetS() == SAVED_ZONE_OFFSET_S, "clock at UTC%+d s, not the saved zone", zoneOffsetS());
+  CHECK(strcmp(settingsManager.getTimezoneName(), SAVED_ZONE) == 0, "zone %s, not the saved one",
+        settingsManager.getTimezoneName());
+  CHECK(settingsManager.saveSettings(), "settings can't be saved after a reset");
+  return bootResult("warm boot");
+}
+
+// The record must be ignored: a cold start, logo first, no time
+static int coldBoot() {
+  releaseButtons();
+  setup();
+  CHECK(stateMachine.getCurrentState() == STATE_LOGO_DISPLAY, "in state %d, not the logo",
+        stateMachine.getCurrentState());
+  CHECK(timeManager.getTimeSource() == TIME_SOURCE_NONE, "time source %d from a bad record",
+        timeManager.getTimeSource());
+  return bootResult("cold boot");
+}
+
+// No RTC memory, the DS3231 has the time: logo, startup message, clock
+static int rtcBoot() {
+  releaseButtons();
+  HostRTC rtc(HOST_RTC_DS3231);
+  rtc.setTime(trueUtcUs());
+  hostAttachI2C(0x68, &rtc);
+  WiFi.networks = networks;
+  WiFi.networkCount = 1;
+
+  setup();
+  CHECK(timeManager.getTimeSource() == TIME_SOURCE_RTC, "time source %d, not the RTC",
+        timeManager.getTimeSource());
+  CHECK(stateMachine.getCurrentState() == STATE_LOGO_DISPLAY, "in state %d, not the logo",
+        stateMachine.getCurrentState());
+  runFor(10000);
+  CHECK(stateMachine.getCurrentState() == STATE_CLOCK_DISPLAY, "in state %d, not the clock",
+        stateMachine.getCurrentState());
+  int64_t errorUs = clockErrorUs();
+  CHECK(errorUs > -5000 && errorUs < 5000, "RTC time off by %lld us", (long long)errorUs);
+  CHECK(zoneOffsetS() == SAVED_ZONE_OFFSET_S, "clock at UTC%+d s, not the saved zone", zoneOffsetS());
+  CHECK(settingsManager.saveSettings(), "settings can't be saved after an RTC boot");
+  hostAttachI2C(0x68, nullptr);
+  return bootResult("RTC boot");
+}
+
+static uint32_t crc32(const uint8_t* data, size_t size) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < size; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// The record first boot left, saved ageS before the next boot at the
+// time trueUtcUs() will give then, checksum sealed
+static void ageRecord(uint8_t* record, int64_t ageS) {
+  uint64_t clockUs = (uint64_t)((int64_t)RESET_CLOCK_S - ageS) * 1000000;
+  FixedTime utc = fixedFromMicros((uint64_t)((int64_t)BOOT_UTC_US - ageS * 1000000));
+  memcpy(record + RECORD_UTC, &utc, sizeof(utc));
+  memcpy(record + RECORD_CLOCK_US, &clockUs, sizeof(clockUs));
+  uint32_t checksum = crc32(record, RECORD_CHECKSUM);
+  memcpy(record + RECORD_CHECKSUM, &checksum, sizeof(checksum));
+}
+
+int main() {
+  int failed = 0;
+  failed += hostBoot(firstBoot);
+
+  size_t size;
+  uint8_t* memory = hostRetainedMemory(&size);
+  CHECK(size == 48, "%lu bytes of RTC memory, not one RetainedTime", (unsigned long)size);
+  if (size != 48) return TEST_RESULT("test_state_machine");
+  uint8_t record[48];
+  memcpy(record, memory, size);
+
+  // Flash as the first boot's settings screen would leave it, with a zone
+  Preferences flash;
+  flash.begin("clocksettings", false);
+  flash.putInt("timezone", 1);
+  flash.putInt("dstRules", DST_EU);
+  flash.putString("tzName", SAVED_ZONE);
+  flash.putInt("brightness", 50);
+  flash.putBool("firstTime", false);
+  flash.end();
+
+  // Resets within the record's age, the last one just inside it
+  hostSetRetainedBase(RESET_CLOCK_S);
+  const int64_t usedAges[] = {30, RETAINED_MAX_AGE_S - 60};
+  for (int i = 0; i < 2; i++) {
+    ageRecord(memory, usedAges[i]);
+    failed += hostBoot(warmBoot);
+    memcpy(memory, record, size);
+  }
+
+  // Corrupt, from another firmware layout, too old, and from the future
+  // (the RTC timer restarted, so its reading is meaningless)
+  for (int i = 0; i < 4; i++) {
+    ageRecord(memory, 30);
+    if (i == 0) {
+      memory[RECORD_UTC + 4] ^= 0x10;
+    } else if (i == 1) {
+      memory[RECORD_MAGIC] ^= 0x01;
+      uint32_t checksum = crc32(memory, RECORD_CHECKSUM);
+      memcpy(memory + RECORD_CHECKSUM, &checksum, sizeof(checksum));
+    } else {
+      ageRecord(memory, i == 2 ? RETAINED_MAX_AGE_S + 60 : -60);
+    }
+    failed += hostBoot(coldBoot);
+    memcpy(memory, record, size);
+  }
+
+  // Power on: RTC memory holds garbage, the RTC has the time
+  memset(memory, 0xA5, size);
+  hostSetRetainedBase(0);
+  failed += hostBoot(rtcBoot);
+
+  printf("test_state_machine: %d boot(s) failed\n", failed);
+  return failed ? 1 : 0;
+}
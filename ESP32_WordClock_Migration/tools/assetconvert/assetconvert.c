@@ -0,0 +1,159 @@
+/*
+PNG to run-length encoded RGB565 image converter for the WordClock TFT.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool for preprocessing
+logos and icons into RLEImage structures (see include/rle_image.h).
+
+For UNIX-like systems.  Outputs to stdout; redirect to a header file, e.g.:
+  ./assetconvert ../../assets/clock_logo.png clockLogo > clock_logo.h
+
+The optional second argument names the image (default: file name without
+extension).  Alpha is composited over black, matching the TFT background.
+
+REQUIRES LIBPNG.  www.libpng.org
+*/
+#ifndef ARDUINO
+
+#include <ctype.h>
+#include <png.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PACKET 128 // Pixels per run or literal packet
+
+static uint32_t outBytes = 0;
+
+// Write one byte of the data table, 12 per line
+static void enbyte(uint8_t value) {
+  if (outBytes) {
+    printf((outBytes % 12) ? ", " : ",\n  ");
+  }
+  printf("0x%02X", value);
+  outBytes++;
+}
+
+static void encolor(uint16_t color) {
+  enbyte(color >> 8);
+  enbyte(color & 0xFF);
+}
+
+// Encode pixels as run and literal packets.  Runs of 2 or more are
+// worth a packet of their own (3 bytes vs 4 for two literals).
+static void enpixels(const uint16_t *pixels, uint32_t count) {
+  uint32_t i = 0;
+  while (i < count) {
+    uint32_t run = 1;
+    while (i + run < count && run < MAX_PACKET &&
+           pixels[i + run] == pixels[i]) {
+      run++;
+    }
+    if (run >= 2) {
+      enbyte(0x80 | (run - 1));
+      encolor(pixels[i]);
+      i += run;
+      continue;
+    }
+
+    // Literal: extend until the next run of 2 begins
+    uint32_t len = 1;
+    while (i + len < count && len < MAX_PACKET &&
+           !(i + len + 1 < count && pixels[i + len] == pixels[i + len + 1])) {
+      len++;
+    }
+    enbyte(len - 1);
+    for (uint32_t j = 0; j < len; j++) {
+      encolor(pixels[i + j]);
+    }
+    i += len;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  char name[64], *ptr;
+  FILE *fp;
+
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s pngfile [name]\n", argv[0]);
+    return 1;
+  }
+
+  if (argc > 2) {
+    strncpy(name, argv[2], sizeof(name) - 1);
+  } else {
+    // Derive name from file name: strip path and extension
+    ptr = strrchr(argv[1], '/');
+    strncpy(name, ptr ? &ptr[1] : argv[1], sizeof(name) - 1);
+    if ((ptr = strrchr(name, '.')))
+      *ptr = 0;
+  }
+  name[sizeof(name) - 1] = 0;
+  for (ptr = name; *ptr; ptr++) {
+    if (!isalnum((unsigned char)*ptr))
+      *ptr = '_';
+  }
+
+  if (!(fp = fopen(argv[1], "rb"))) {
+    fprintf(stderr, "Can't open %s\n", argv[1]);
+    return 1;
+  }
+
+  png_structp png =
+      png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+  png_infop info = png ? png_create_info_struct(png) : NULL;
+  if (!info || setjmp(png_jmpbuf(png))) {
+    fprintf(stderr, "PNG decode error in %s\n", argv[1]);
+    fclose(fp);
+    return 1;
+  }
+
+  // Normalize every PNG flavor to 8-bit RGBA
+  png_init_io(png, fp);
+  png_read_info(png, info);
+  png_set_expand(png);
+  png_set_strip_16(png);
+  png_set_gray_to_rgb(png);
+  png_set_filler(png, 0xFF, PNG_FILLER_AFTER);
+  png_read_update_info(png, info);
+
+  uint32_t width = png_get_image_width(png, info);
+  uint32_t height = png_get_image_height(png, info);
+  if (width > 0xFFFF || height > 0xFFFF) {
+    fprintf(stderr, "%s is too large\n", argv[1]);
+    fclose(fp);
+    return 1;
+  }
+
+  png_bytep rgba = malloc(width * height * 4);
+  png_bytep *rows = malloc(height * sizeof(png_bytep));
+  uint16_t *pixels = malloc(width * height * sizeof(uint16_t));
+  for (uint32_t y = 0; y < height; y++) {
+    rows[y] = &rgba[y * width * 4];
+  }
+  png_read_image(png, rows);
+  png_destroy_read_struct(&png, &info, NULL);
+  fclose(fp);
+
+  for (uint32_t i = 0; i < width * height; i++) {
+    png_bytep p = &rgba[i * 4];
+    // Composite over black, then pack to 5-6-5
+    uint8_t r = p[0] * p[3] / 255, g = p[1] * p[3] / 255,
+            b = p[2] * p[3] / 255;
+    pixels[i] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+
+  printf("const uint8_t %sData[] PROGMEM = {\n  ", name);
+  enpixels(pixels, width * height);
+  printf(" };\n\n");
+  printf("const RLEImage %s PROGMEM = {%u, %u, %sData, %u};\n", name, width,
+         height, name, outBytes);
+  printf("// %u bytes, %u raw RGB565\n\n", outBytes, width * height * 2);
+
+  free(pixels);
+  free(rows);
+  free(rgba);
+  return 0;
+}
+
+#endif /* !ARDUINO */
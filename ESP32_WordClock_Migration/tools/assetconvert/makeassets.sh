@@ -0,0 +1,28 @@
+#!/bin/bash
+
+# Regenerates include/assets.h from the PNGs in assets/.  Run after
+# editing any image; needs the assetconvert tool built (make).
+
+convert=./assetconvert
+inpath=../../assets/
+outfile=../../include/assets.h
+
+{
+  echo "#ifndef ASSETS_H"
+  echo "#define ASSETS_H"
+  echo ""
+  echo "// Generated by tools/assetconvert/makeassets.sh - do not edit"
+  echo ""
+  echo "#include \"rle_image.h\""
+  echo ""
+  $convert ${inpath}clock_logo.png clockLogo
+  for bars in 0 1 2 3 4; do
+    $convert ${inpath}signal_${bars}.png signalBars${bars}
+  done
+  echo "// Indexed by getSignalBarCount()"
+  echo "const RLEImage* const signalBarImages[] = {"
+  echo "  &signalBars0, &signalBars1, &signalBars2, &signalBars3, &signalBars4"
+  echo "};"
+  echo ""
+  echo "#endif // ASSETS_H"
+} > $outfile
@@ -0,0 +1,472 @@
+/*
+Telemetry stream decoder for the WordClock.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that picks the binary
+telemetry frames (see include/telemetry_frames.h) out of the board's
+serial output, prints them as they arrive and a summary at the end
+(end of file or Ctrl-C).  The firmware streams them when built with
+TELEMETRY 1 in main.cpp, or after 't' is sent over serial.
+
+For Linux.  Reads a serial device, a file recorded from one, or stdin:
+  ./telemetry /dev/ttyACM0
+  ./telemetry -q -c frames.csv capture.bin
+
+Options:
+  -c file   Also write every field to a CSV file: time_ms,frame,field,value
+  -t        Pass the text log through to stdout
+  -q        No per-frame output, summary only
+  -b baud   Serial speed (default 115200, ignored by USB CDC)
+
+Frames that fail the CRC are counted and skipped; the decoder resyncs on
+the next sync byte.
+*/
+#ifndef ARDUINO
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../../include/telemetry_frames.h"
+
+#define MAX_FIELDS 8
+
+// In SystemState order (include/state_machine.h)
+static const char *const stateNames[] = {
+  "INIT", "LOGO_DISPLAY", "STARTUP_MESSAGE", "WIFI_SCAN", "WIFI_DISPLAY",
+  "PASSWORD_ENTRY", "WIFI_CONNECTING", "WIFI_SUCCESS", "WIFI_FAILURE",
+  "WIFI_CONNECT", "SETTINGS", "TIME_SYNC", "CLOCK_DISPLAY", "WORDCLOCK_DISPLAY"
+};
+#define STATE_NAMES (sizeof(stateNames) / sizeof(stateNames[0]))
+
+// In PerfProbe order (include/perf_counters.h)
+static const char *const probeNames[] = {
+  "state.update", "state.enter", "state.tick", "state.input",
+  "tft.draw", "matrix.frame", "matrix.show", "ntp.sync"
+};
+#define PROBE_NAMES (sizeof(probeNames) / sizeof(probeNames[0]))
+
+static const char *const frameNames[] = {
+  "?", "HELLO", "STATE", "HEAP", "SYNC", "RENDER", "PROBE"
+};
+#define FRAME_NAMES (sizeof(frameNames) / sizeof(frameNames[0]))
+
+static FILE *csv = NULL;
+static int showText = 0, quiet = 0;
+static volatile sig_atomic_t stop = 0;
+
+// One decoded frame, as name/value text
+static struct {
+  const char *name;
+  char value[32];
+} fields[MAX_FIELDS];
+static int fieldCount;
+
+// Running summary
+static struct {
+  uint32_t frames[FRAME_NAMES], crcErrors, textBytes, restarts;
+  char firmware[16];
+  uint32_t lastUptimeMs;
+
+  uint32_t transitions;
+  int state;                      // -1 until the first STATE frame
+  uint32_t stateSinceMs;
+  uint64_t stateMs[STATE_NAMES];
+
+  uint32_t heapFree, heapMinFree, largestBlockMin, uiStackMin, renderStackMin;
+
+  uint32_t syncOk, syncFailed, syncMaxMs;
+  uint64_t syncTotalMs;
+  int32_t offsetMs, offsetMaxMs, driftPpb;
+
+  uint32_t renderFrames, renderOverruns, renderDropped, renderLateMaxUs;
+  uint32_t renderUptimeMs;
+  double frameRate;
+
+  uint32_t probe[PROBE_NAMES][5];  // count, min, avg, max, p99
+  int probeSeen[PROBE_NAMES];
+} sum;
+
+static uint32_t get32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void field(const char *name, const char *format, ...) {
+  va_list args;
+  if (fieldCount >= MAX_FIELDS) return;
+  fields[fieldCount].name = name;
+  va_start(args, format);
+  vsnprintf(fields[fieldCount].value, sizeof(fields[0].value), format, args);
+  va_end(args);
+  fieldCount++;
+}
+
+static const char *stateName(uint8_t state) {
+  return state < STATE_NAMES ? stateNames[state] : "?";
+}
+
+// Time spent in the state being left
+static void leaveState(uint32_t uptimeMs) {
+  if (sum.state >= 0 && sum.state < (int)STATE_NAMES && uptimeMs >= sum.stateSinceMs) {
+    sum.stateMs[sum.state] += uptimeMs - sum.stateSinceMs;
+  }
+}
+
+// Payload length of each known frame type, 0 for types newer firmware added
+static uint8_t frameLength(uint8_t type) {
+  switch (type) {
+    case TELEMETRY_HELLO: return sizeof(TelemetryHello);
+    case TELEMETRY_STATE: return sizeof(TelemetryState);
+    case TELEMETRY_HEAP: return sizeof(TelemetryHeap);
+    case TELEMETRY_SYNC: return sizeof(TelemetrySync);
+    case TELEMETRY_RENDER: return sizeof(TelemetryRender);
+    case TELEMETRY_PROBE: return sizeof(TelemetryProbe);
+    default: return 0;
+  }
+}
+
+// Fill fields[] and the summary from one frame; 0 if the type is unknown
+// or the payload is the wrong size for it
+static int decodeFrame(uint8_t type, const uint8_t *p, uint8_t length) {
+  // Skip unknown types and wrong lengths before reading anything, so
+  // their uptime can't count as a restart
+  if (frameLength(type) == 0 || length != frameLength(type)) return 0;
+
+  uint32_t uptimeMs = get32(p);
+  fieldCount = 0;
+
+  // Uptime going back: the board restarted, dwell times start over
+  if (uptimeMs < sum.lastUptimeMs) {
+    sum.restarts++;
+    leaveState(sum.lastUptimeMs);
+    sum.state = -1;
+  }
+
+  switch (type) {
+    case TELEMETRY_HELLO: {
+      memcpy(sum.firmware, p + 5, 12);
+      sum.firmware[12] = '\0';
+      field("protocol", "%u", p[4]);
+      field("firmware", "%s", sum.firmware);
+      break;
+    }
+
+    case TELEMETRY_STATE: {
+      leaveState(uptimeMs);
+      sum.transitions++;
+      sum.state = p[5];
+      sum.stateSinceMs = uptimeMs;
+      field("from", "%s", stateName(p[4]));
+      field("to", "%s", stateName(p[5]));
+      field("free_heap", "%u", get32(p + 6));
+      break;
+    }
+
+    case TELEMETRY_HEAP: {
+      uint32_t largest = get32(p + 12), uiStack = get32(p + 16), renderStack = get32(p + 20);
+      int first = sum.frames[TELEMETRY_HEAP] == 0;
+      sum.heapFree = get32(p + 4);
+      sum.heapMinFree = get32(p + 8);
+      if (first || largest < sum.largestBlockMin) sum.largestBlockMin = largest;
+      if (first || uiStack < sum.uiStackMin) sum.uiStackMin = uiStack;
+      if (first || renderStack < sum.renderStackMin) sum.renderStackMin = renderStack;
+      field("free", "%u", sum.heapFree);
+      field("min_free", "%u", sum.heapMinFree);
+      field("largest_block", "%u", largest);
+      field("ui_stack_free", "%u", uiStack);
+      field("render_stack_free", "%u", renderStack);
+      break;
+    }
+
+    case TELEMETRY_SYNC: {
+      uint32_t durationMs = get32(p + 5);
+      int32_t offsetMs = (int32_t)get32(p + 9);
+      if (p[4]) {
+        sum.syncOk++;
+        sum.offsetMs = offsetMs;
+        if (abs(offsetMs) > abs(sum.offsetMaxMs)) sum.offsetMaxMs = offsetMs;
+      } else {
+        sum.syncFailed++;
+      }
+      sum.syncTotalMs += durationMs;
+      if (durationMs > sum.syncMaxMs) sum.syncMaxMs = durationMs;
+      sum.driftPpb = (int32_t)get32(p + 17);
+      field("success", "%u", p[4]);
+      field("duration_ms", "%u", durationMs);
+      field("offset_ms", "%d", offsetMs);
+      field("delay_ms", "%u", get32(p + 13));
+      field("drift_ppb", "%d", sum.driftPpb);
+      break;
+    }
+
+    case TELEMETRY_RENDER: {
+      uint32_t frames = get32(p + 4);
+      // Rate from consecutive reports; the counters reset now and then
+      if (sum.frames[TELEMETRY_RENDER] && frames >= sum.renderFrames && uptimeMs > sum.renderUptimeMs) {
+        sum.frameRate = (frames - sum.renderFrames) * 1000.0 / (uptimeMs - sum.renderUptimeMs);
+      }
+      sum.renderFrames = frames;
+      sum.renderUptimeMs = uptimeMs;
+      sum.renderOverruns = get32(p + 8);
+      sum.renderDropped = get32(p + 12);
+      sum.renderLateMaxUs = get32(p + 20);
+      field("frames", "%u", frames);
+      field("overruns", "%u", sum.renderOverruns);
+      field("dropped", "%u", sum.renderDropped);
+      field("late_avg_us", "%u", get32(p + 16));
+      field("late_max_us", "%u", sum.renderLateMaxUs);
+      break;
+    }
+
+    case TELEMETRY_PROBE: {
+      uint8_t probe = p[4];
+      if (probe < PROBE_NAMES) {
+        for (int i = 0; i < 5; i++) {
+          sum.probe[probe][i] = get32(p + 5 + 4 * i);
+        }
+        sum.probeSeen[probe] = 1;
+        field("probe", "%s", probeNames[probe]);
+      } else {
+        field("probe", "%u", probe);
+      }
+      field("count", "%u", get32(p + 5));
+      field("min_us", "%u", get32(p + 9));
+      field("avg_us", "%u", get32(p + 13));
+      field("max_us", "%u", get32(p + 17));
+      field("p99_us", "%u", get32(p + 21));
+      break;
+    }
+
+    default:
+      break;
+  }
+
+  sum.lastUptimeMs = uptimeMs;
+  return 1;
+}
+
+static void handleFrame(uint8_t type, const uint8_t *payload, uint8_t length) {
+  if (length < 4 || !decodeFrame(type, payload, length)) {
+    sum.frames[0]++;
+    return;
+  }
+  sum.frames[type]++;
+
+  uint32_t uptimeMs = get32(payload);
+  if (!quiet) {
+    printf("%9u.%03u %-6s", uptimeMs / 1000, uptimeMs % 1000, frameNames[type]);
+    for (int i = 0; i < fieldCount; i++) {
+      printf(" %s=%s", fields[i].name, fields[i].value);
+    }
+    printf("\n");
+    fflush(stdout);
+  }
+  if (csv) {
+    for (int i = 0; i < fieldCount; i++) {
+      fprintf(csv, "%u,%s,%s,%s\n", uptimeMs, frameNames[type], fields[i].name, fields[i].value);
+    }
+  }
+}
+
+// Log text; bytes of broken frames that aren't ASCII are left out
+static void handleText(uint8_t c) {
+  sum.textBytes++;
+  if (showText && (c == '\n' || c == '\t' || (c >= ' ' && c < 0x7F))) {
+    putchar(c);
+    if (c == '\n') fflush(stdout);
+  }
+}
+
+// Decode what's buffered; returns the bytes used, the rest waits for more
+// input (or is text at the end of the stream)
+static size_t decode(const uint8_t *buf, size_t size, int final) {
+  size_t pos = 0;
+
+  while (pos < size) {
+    if (buf[pos] != TELEMETRY_SYNC_BYTE) {
+      handleText(buf[pos++]);
+      continue;
+    }
+    if (size - pos < 3) {
+      if (!final) break;  // Header still coming
+      pos++;
+      continue;
+    }
+
+    uint8_t length = buf[pos + 2];
+    if (length > TELEMETRY_MAX_PAYLOAD) {
+      sum.crcErrors++;  // Can't be a frame
+      pos++;
+      continue;
+    }
+    if (size - pos < (size_t)length + TELEMETRY_FRAME_OVERHEAD) {
+      if (!final) break;
+      sum.crcErrors++;  // Cut off at the end of the capture
+      pos++;
+      continue;
+    }
+
+    const uint8_t *crcBytes = &buf[pos + 3 + length];
+    uint16_t crc = telemetryCrc16(&buf[pos + 1], length + 2, 0xFFFF);
+    if (crc != (crcBytes[0] | (crcBytes[1] << 8))) {
+      sum.crcErrors++;
+      pos++;  // Resync on the next sync byte
+      continue;
+    }
+    handleFrame(buf[pos + 1], &buf[pos + 3], length);
+    pos += length + TELEMETRY_FRAME_OVERHEAD;
+  }
+  return pos;
+}
+
+static void printSummary(void) {
+  printf("\n== Summary ==\n");
+  printf("Firmware %s, last uptime %u s, %u restart(s)\n", sum.firmware[0] ? sum.firmware : "?",
+         sum.lastUptimeMs / 1000, sum.restarts);
+  printf("Frames:");
+  for (unsigned i = 1; i < FRAME_NAMES; i++) {
+    printf(" %s %u,", frameNames[i], sum.frames[i]);
+  }
+  printf(" unknown %u, bad %u; text %u bytes\n", sum.frames[0], sum.crcErrors, sum.textBytes);
+
+  if (sum.transitions) {
+    leaveState(sum.lastUptimeMs);
+    sum.stateSinceMs = sum.lastUptimeMs;
+    printf("States: %u transitions, now %s\n", sum.transitions,
+           sum.state >= 0 ? stateName(sum.state) : "?");
+    for (unsigned i = 0; i < STATE_NAMES; i++) {
+      if (sum.stateMs[i]) {
+        printf("  %-18s %10.1f s\n", stateNames[i], sum.stateMs[i] / 1000.0);
+      }
+    }
+  }
+
+  if (sum.frames[TELEMETRY_HEAP]) {
+    printf("Heap: free %u, min free %u, smallest largest block %u\n", sum.heapFree, sum.heapMinFree,
+           sum.largestBlockMin);
+    printf("Stack free: UI %u, render %u\n", sum.uiStackMin, sum.renderStackMin);
+  }
+
+  if (sum.syncOk + sum.syncFailed) {
+    printf("NTP: %u ok, %u failed, avg %u ms, max %u ms; offset last %d ms, largest %d ms; drift %d ppb\n",
+           sum.syncOk, sum.syncFailed, (uint32_t)(sum.syncTotalMs / (sum.syncOk + sum.syncFailed)),
+           sum.syncMaxMs, sum.offsetMs, sum.offsetMaxMs, sum.driftPpb);
+  }
+
+  if (sum.frames[TELEMETRY_RENDER]) {
+    printf("Matrix: %u frames (%.1f/s), %u overruns, %u dropped, late max %u us\n", sum.renderFrames,
+           sum.frameRate, sum.renderOverruns, sum.renderDropped, sum.renderLateMaxUs);
+  }
+
+  for (unsigned i = 0; i < PROBE_NAMES; i++) {
+    if (!sum.probeSeen[i]) continue;
+    printf("  %-13s %8u, min %u us, avg %u us, max %u us, p99 <=%u us\n", probeNames[i], sum.probe[i][0],
+           sum.probe[i][1], sum.probe[i][2], sum.probe[i][3], sum.probe[i][4]);
+  }
+}
+
+static speed_t baudRate(long baud) {
+  switch (baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+    default: return 0;
+  }
+}
+
+static void onSignal(int sig) {
+  (void)sig;
+  stop = 1;
+}
+
+int main(int argc, char *argv[]) {
+  const char *csvName = NULL;
+  long baud = 115200;
+  int opt, fd;
+
+  while ((opt = getopt(argc, argv, "c:tqb:")) != -1) {
+    switch (opt) {
+      case 'c': csvName = optarg; break;
+      case 't': showText = 1; break;
+      case 'q': quiet = 1; break;
+      case 'b': baud = strtol(optarg, NULL, 10); break;
+      default: optind = argc + 1; break;
+    }
+  }
+  if (optind != argc - 1) {
+    fprintf(stderr, "Usage: %s [-c csvfile] [-t] [-q] [-b baud] device|file|-\n", argv[0]);
+    return 1;
+  }
+
+  if (!strcmp(argv[optind], "-")) {
+    fd = STDIN_FILENO;
+  } else if ((fd = open(argv[optind], O_RDONLY | O_NOCTTY)) < 0) {
+    fprintf(stderr, "Can't open %s: %s\n", argv[optind], strerror(errno));
+    return 1;
+  }
+
+  // A serial port: raw bytes, no echo or line editing
+  if (isatty(fd)) {
+    struct termios tio;
+    speed_t speed = baudRate(baud);
+    if (!speed) {
+      fprintf(stderr, "Unsupported baud rate %ld\n", baud);
+      return 1;
+    }
+    if (tcgetattr(fd, &tio) == 0) {
+      cfmakeraw(&tio);
+      cfsetispeed(&tio, speed);
+      cfsetospeed(&tio, speed);
+      tio.c_cflag |= CLOCAL | CREAD;
+      tio.c_cc[VMIN] = 1;
+      tio.c_cc[VTIME] = 0;
+      tcsetattr(fd, TCSANOW, &tio);
+    }
+  }
+
+  if (csvName) {
+    if (!(csv = fopen(csvName, "w"))) {
+      fprintf(stderr, "Can't create %s: %s\n", csvName, strerror(errno));
+      return 1;
+    }
+    fprintf(csv, "time_ms,frame,field,value\n");
+  }
+
+  // No SA_RESTART: Ctrl-C ends a blocked read
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+
+  sum.state = -1;
+  uint8_t buf[4096];
+  size_t fill = 0;
+  while (!stop) {
+    ssize_t n = read(fd, buf + fill, sizeof(buf) - fill);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    fill += n;
+    size_t used = decode(buf, fill, 0);
+    memmove(buf, buf + used, fill - used);
+    fill -= used;
+  }
+  decode(buf, fill, 1);
+
+  if (csv) fclose(csv);
+  printSummary();
+  return 0;
+}
+
+#endif // !ARDUINO
@@ -0,0 +1,39 @@
+#!/bin/bash
+
+# Regenerates include/tz_zones.h from zones.txt.  Each zone's rule is the
+# POSIX TZ footer of its compiled tzdata file (the last line of a TZif v2+
+# file), so the table follows whatever tzdata release the host has.
+
+zoneinfo=${ZONEINFO:-/usr/share/zoneinfo}
+outfile=../../include/tz_zones.h
+
+# findTimezone() binary searches with strcmp, so sort bytewise
+zones=$(grep -v '^#' zones.txt | grep -v '^$' | LC_ALL=C sort -u)
+
+for zone in $zones; do
+  if [ ! -f "$zoneinfo/$zone" ]; then
+    echo "Unknown zone $zone" >&2
+    exit 1
+  fi
+done
+
+{
+  echo "#ifndef TZ_ZONES_H"
+  echo "#define TZ_ZONES_H"
+  echo ""
+  echo "// Generated by tools/tzcompile/makezones.sh - do not edit"
+  echo ""
+  echo "#include \"tz_rules.h\""
+  echo ""
+  echo "// Sorted by name for findTimezone()"
+  echo "const TZZone tzZones[] PROGMEM = {"
+  for zone in $zones; do
+    rule=$(tail -n 1 "$zoneinfo/$zone")
+    echo "  {\"$zone\", \"$rule\"},"
+  done
+  echo "};"
+  echo ""
+  echo "const int tzZoneCount = sizeof(tzZones) / sizeof(tzZones[0]);"
+  echo ""
+  echo "#endif // TZ_ZONES_H"
+} > $outfile
@@ -90,6 +90,60 @@ inline uint8_t *pgm_read_bitmap_ptr(const GFXfont *gfxFont) {
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #endif
 
+// Sequential reader for GFXFONT_RLE glyph data (see fontconvert.c): a
+// nibble stream of alternating off/on run lengths in raster order,
+// starting with an 'off' run. Nibbles 0-14 are literal lengths; 15 is
+// followed by two more nibbles (high first) holding length - 15.
+class GFXrleReader {
+public:
+  GFXrleReader(const uint8_t *p, uint16_t nib = 0)
+      : start(p), ptr(p + (nib >> 1)), hi(!(nib & 1)) {}
+  uint16_t run(void) {
+    uint8_t n = nibble();
+    if (n < 15)
+      return n;
+    n = nibble() << 4;
+    return 15 + (n | nibble());
+  }
+  uint16_t offset(void) const { // Nibbles read so far
+    return (uint16_t)((ptr - start) * 2 + (hi ? 0 : 1));
+  }
+
+private:
+  uint8_t nibble(void) {
+    uint8_t b = pgm_read_byte(ptr);
+    if (hi) {
+      hi = false;
+      return b >> 4;
+    }
+    hi = true;
+    ptr++;
+    return b & 0x0F;
+  }
+  const uint8_t *start;
+  const uint8_t *ptr;
+  bool hi;
+};
+
+// Where drawTextLine() is in an RLE glyph: the 'on' run [pos, end) in
+// raster bits and the nibble after it. Rows are drawn top to bottom, so
+// the glyph is decoded once rather than from its start for every row.
+struct GFXrleCursor {
+  uint16_t nibble, pos, end;
+};
+
+// Read runs until the 'on' run ends past bit 'until' or the glyph ends
+static void rleAdvance(const uint8_t *glyph, GFXrleCursor &c, uint16_t until,
+                       uint16_t total) {
+  GFXrleReader r(glyph, c.nibble);
+  while ((c.end <= until) && (c.pos < total)) {
+    c.pos = c.end + r.run(); // Skip 'off' run
+    c.end = (c.pos < total) ? c.pos + r.run() : c.pos;
+  }
+  c.nibble = r.offset();
+}
+
+
 #ifndef _swap_int16_t
 #define _swap_int16_t(a, b)                                                    \
   {                                                                            \
@@ -244,6 +298,23 @@ void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
   fillRect(x, y, w, h, color);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Write one horizontal run of individually-colored pixels,
+   overwrite in subclasses that can push a pixel burst in one go!
+    @param    x   Left-most x coordinate
+    @param    y   Row y coordinate
+    @param    colors  Array of w 16-bit 5-6-5 colors, left to right
+    @param    w   Width in pixels
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeScanline(int16_t x, int16_t y, uint16_t *colors,
+                                 int16_t w) {
+  // Overwrite in subclasses if startWrite is defined!
+  for (int16_t i = 0; i < w; i++)
+    writePixel(x + i, y, colors[i]);
+}
+
 /**************************************************************************/
 /*!
    @brief    End a display-writing routine, overwrite in subclasses if
@@ -1212,6 +1283,31 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    if (pgm_read_byte(&gfxFont->flags) & GFXFONT_RLE) {
+      // Run-length glyph: one line per run of set pixels in each row
+      GFXrleReader rle(&bitmap[bo]);
+      uint16_t pos = 0, total = (uint16_t)w * h;
+      startWrite();
+      while ((pos += rle.run()) < total) { // Skip 'off' run
+        uint16_t len = rle.run();          // 'On' run, may span rows
+        while (len && (pos < total)) {
+          yy = pos / w;
+          xx = pos % w;
+          uint8_t seg = (len < (uint16_t)(w - xx)) ? len : (w - xx);
+          if (size_x == 1 && size_y == 1) {
+            writeFastHLine(x + xo + xx, y + yo + yy, seg, color);
+          } else {
+            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
+                          seg * size_x, size_y, color);
+          }
+          pos += seg;
+          len -= seg;
+        }
+      }
+      endWrite();
+      return;
+    }
+
     startWrite();
     for (yy = 0; yy < h; yy++) {
       for (xx = 0; xx < w; xx++) {
@@ -1285,6 +1381,187 @@ size_t Adafruit_GFX::write(uint8_t c) {
   return 1;
 }
 
+/**************************************************************************/
+/*!
+    @brief  Draw one line of text a scanline at a time. Each row of the
+            string is rasterized into a small line buffer with the current
+            text color, background and magnification applied, then pushed
+            with a single writeScanline() (opaque background) or one
+            writeFastHLine() per run of set pixels (transparent). This
+            replaces the per-pixel writePixel()/writeFillRect() traffic
+            of drawChar() with a handful of bursts per row, and gives
+            custom fonts a working background fill. Stops at the first
+            newline; text is clipped, never wrapped.
+    @param  x    Left edge ('classic' font: top-left corner, custom font:
+                 cursor position on the baseline, same as drawChar())
+    @param  y    Top edge (classic) or baseline (custom font)
+    @param  str  The ASCII string to draw
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawTextLine(int16_t x, int16_t y, const char *str) {
+  int16_t tsx = textsize_x, tsy = textsize_y;
+  bool opaque = (textbgcolor != textcolor);
+  uint8_t n = 0; // Printable length up to the first newline
+
+  while (str[n] && (str[n] != '\n') && (n < 255))
+    n++;
+
+  // Bounding box of the whole line, in screen coordinates
+  int16_t left = x, right, top, bottom, advance;
+  uint8_t first = 0, last = 0;
+  uint8_t *bitmap = NULL;
+  bool rle = false;
+
+  if (!gfxFont) {
+    advance = n * 6 * tsx;
+    right = x + advance;
+    top = y;
+    bottom = y + 8 * tsy;
+  } else {
+    first = pgm_read_byte(&gfxFont->first);
+    last = pgm_read_byte(&gfxFont->last);
+    bitmap = pgm_read_bitmap_ptr(gfxFont);
+    rle = pgm_read_byte(&gfxFont->flags) & GFXFONT_RLE;
+    int16_t cx = x;
+    right = x;
+    top = 0x7FFF;
+    bottom = -0x7FFF;
+    for (uint8_t i = 0; i < n; i++) {
+      uint8_t c = str[i];
+      if ((c < first) || (c > last))
+        continue;
+      GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+      uint8_t gw = pgm_read_byte(&glyph->width),
+              gh = pgm_read_byte(&glyph->height);
+      int8_t xo = pgm_read_byte(&glyph->xOffset),
+             yo = pgm_read_byte(&glyph->yOffset);
+      if (gw && gh) { // Glyphs may overhang their advance either side
+        if (cx + xo * tsx < left)
+          left = cx + xo * tsx;
+        if (cx + (xo + gw) * tsx > right)
+          right = cx + (xo + gw) * tsx;
+        if (y + yo * tsy < top)
+          top = y + yo * tsy;
+        if (y + (yo + gh) * tsy > bottom)
+          bottom = y + (yo + gh) * tsy;
+      }
+      cx += (uint8_t)pgm_read_byte(&glyph->xAdvance) * tsx;
+    }
+    advance = cx - x;
+    if (x + advance > right)
+      right = x + advance;
+  }
+
+  cursor_x = x + advance;
+  cursor_y = y;
+
+  // Clip the box to the screen
+  if (left < 0)
+    left = 0;
+  if (top < 0)
+    top = 0;
+  if (right > _width)
+    right = _width;
+  if (bottom > _height)
+    bottom = _height;
+  if ((left >= right) || (top >= bottom))
+    return;
+
+  uint8_t on[GFX_SCANLINE_PIXELS];     // 1 = foreground pixel
+  uint16_t line[GFX_SCANLINE_PIXELS];  // Colors pushed for opaque text
+  GFXrleCursor cursor[GFX_RLE_GLYPHS]; // RLE glyphs, by position in str
+  memset(cursor, 0, sizeof(cursor));
+
+  startWrite();
+  for (int16_t row = top; row < bottom; row++) {
+    for (int16_t x0 = left; x0 < right; x0 += GFX_SCANLINE_PIXELS) {
+      int16_t x1 = x0 + GFX_SCANLINE_PIXELS;
+      if (x1 > right)
+        x1 = right;
+      memset(on, 0, x1 - x0);
+
+      if (!gfxFont) { // 'Classic' font: fixed 6x8 cells
+        int16_t cw = 6 * tsx;
+        uint8_t fr = (row - y) / tsy; // Font row, 0-7
+        for (int16_t px = x0; px < x1; px++) {
+          int16_t rel = px - x;
+          uint8_t col = (rel % cw) / tsx;
+          if (col < 5) {
+            unsigned char c = str[rel / cw];
+            if (!_cp437 && (c >= 176))
+              c++; // Handle 'classic' charset behavior
+            if ((pgm_read_byte(&font[c * 5 + col]) >> fr) & 1)
+              on[px - x0] = 1;
+          }
+        }
+      } else { // Custom font: bit-packed glyphs of varying size
+        int16_t cx = x;
+        for (uint8_t i = 0; i < n; i++) {
+          uint8_t c = str[i];
+          if ((c < first) || (c > last))
+            continue;
+          GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+          uint8_t gw = pgm_read_byte(&glyph->width),
+                  gh = pgm_read_byte(&glyph->height);
+          int16_t gx = cx + (int8_t)pgm_read_byte(&glyph->xOffset) * tsx,
+                  gy = y + (int8_t)pgm_read_byte(&glyph->yOffset) * tsy;
+          cx += (uint8_t)pgm_read_byte(&glyph->xAdvance) * tsx;
+          if ((row < gy) || (row >= gy + gh * tsy) || (gx >= x1) ||
+              (gx + gw * tsx <= x0))
+            continue;
+          uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+          uint16_t rowbit = ((row - gy) / tsy) * gw;
+          int16_t px = (gx > x0) ? gx : x0,
+                  pe = (gx + gw * tsx < x1) ? gx + gw * tsx : x1;
+          if (rle) { // Runs of this glyph row, from where the last row ended
+            uint16_t rowend = rowbit + gw, total = (uint16_t)gw * gh;
+            GFXrleCursor start = {0, 0, 0};
+            GFXrleCursor &kept = (i < GFX_RLE_GLYPHS) ? cursor[i] : start;
+            rleAdvance(&bitmap[bo], kept, rowbit, total);
+            GFXrleCursor c = kept; // Kept at the row start for size_y > 1
+            for (;;) {
+              for (uint16_t b = (c.pos > rowbit) ? c.pos : rowbit;
+                   (b < c.end) && (b < rowend); b++) {
+                int16_t sx = gx + (b - rowbit) * tsx;
+                for (int16_t k = 0; k < tsx; k++, sx++)
+                  if ((sx >= px) && (sx < pe))
+                    on[sx - x0] = 1;
+              }
+              if ((c.end >= rowend) || (c.pos >= total))
+                break;
+              rleAdvance(&bitmap[bo], c, c.end, total);
+            }
+            continue;
+          }
+          for (; px < pe; px++) {
+            uint16_t b = rowbit + (px - gx) / tsx;
+            if (pgm_read_byte(&bitmap[bo + (b >> 3)]) & (0x80 >> (b & 7)))
+              on[px - x0] = 1;
+          }
+        }
+      }
+
+      if (opaque) {
+        for (int16_t i = 0; i < x1 - x0; i++)
+          line[i] = on[i] ? textcolor : textbgcolor;
+        writeScanline(x0, row, line, x1 - x0);
+      } else {
+        for (int16_t i = 0; i < x1 - x0;) {
+          if (!on[i]) {
+            i++;
+            continue;
+          }
+          int16_t run = i;
+          while ((i < x1 - x0) && on[i])
+            i++;
+          writeFastHLine(x0 + run, row, i - run, textcolor);
+        }
+      }
+    }
+  }
+  endWrite();
+}
+
 /**************************************************************************/
 /*!
     @brief   Set text 'magnification' size. Each increase in s makes 1 pixel
@@ -2668,3 +2945,165 @@ void GFXcanvas16::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
     buffer[i] = color;
   }
 }
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate a GFX paletted 8-bit canvas context for graphics.
+             Each pixel stores a palette index, halving the memory of a
+             GFXcanvas16 of the same size. Drawing calls still take 565
+             colors; these are mapped to indices as they are drawn.
+   @param    w   Display width, in pixels
+   @param    h   Display height, in pixels
+*/
+/**************************************************************************/
+GFXcanvas8Palette::GFXcanvas8Palette(uint16_t w, uint16_t h)
+    : GFXcanvas8(w, h) {
+  // A fresh (zeroed) buffer is index 0, which starts out as black
+  palette[0] = 0x0000;
+  paletteSize = 1;
+  lastColor = 0x0000;
+  lastIndex = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Replace the palette. Pixels already drawn keep their index, so
+             this can also be used to recolor the whole canvas at once.
+   @param    colors  Array of 565 colors
+   @param    n       Number of colors, 1 to 256 (extra entries ignored)
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::setPalette(const uint16_t *colors, uint16_t n) {
+  if (n < 1)
+    return;
+  if (n > 256)
+    n = 256;
+  memcpy(palette, colors, n * sizeof(uint16_t));
+  paletteSize = n;
+  lastColor = palette[0];
+  lastIndex = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Find the palette index for a 565 color. Colors not yet in the
+             palette are appended; once all 256 entries are taken, unknown
+             colors map to index 0.
+   @param    color  16-bit 5-6-5 Color
+   @returns  Palette index for color
+*/
+/**************************************************************************/
+uint8_t GFXcanvas8Palette::colorIndex(uint16_t color) {
+  // Runs of identical colors are the common case, skip the search
+  if (color == lastColor)
+    return lastIndex;
+
+  uint16_t i;
+  for (i = 0; i < paletteSize; i++) {
+    if (palette[i] == color)
+      break;
+  }
+  if (i == paletteSize) {
+    if (paletteSize == 256)
+      return 0; // Full; don't cache so a later setPalette() can match it
+    palette[paletteSize++] = color;
+  }
+  lastColor = color;
+  lastIndex = i;
+  return i;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draw a pixel to the canvas framebuffer
+    @param  x   x coordinate
+    @param  y   y coordinate
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  GFXcanvas8::drawPixel(x, y, colorIndex(color));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fill the framebuffer completely with one color
+    @param  color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::fillScreen(uint16_t color) {
+  GFXcanvas8::fillScreen(colorIndex(color));
+}
+
+/**************************************************************************/
+/*!
+   @brief  Speed optimized vertical line drawing
+   @param  x      Line horizontal start point
+   @param  y      Line vertical start point
+   @param  h      Length of vertical line to be drawn, including first point
+   @param  color  16-bit 5-6-5 Color to draw line with
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                      uint16_t color) {
+  GFXcanvas8::drawFastVLine(x, y, h, colorIndex(color));
+}
+
+/**************************************************************************/
+/*!
+   @brief  Speed optimized horizontal line drawing
+   @param  x      Line horizontal start point
+   @param  y      Line vertical start point
+   @param  w      Length of horizontal line to be drawn, including first point
+   @param  color  16-bit 5-6-5 Color to draw line with
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                      uint16_t color) {
+  GFXcanvas8::drawFastHLine(x, y, w, colorIndex(color));
+}
+
+/**********************************************************************/
+/*!
+        @brief    Get the 565 color of the pixel at a given coordinate
+        @param    x   x coordinate
+        @param    y   y coordinate
+        @returns  The desired pixel's 16-bit 5-6-5 color value
+*/
+/**********************************************************************/
+uint16_t GFXcanvas8Palette::getPixelColor(int16_t x, int16_t y) const {
+  return palette[getPixel(x, y)];
+}
+
+/**************************************************************************/
+/*!
+   @brief    Copy the canvas to another display, expanding palette indices
+             to 565 one scanline chunk (GFX_SCANLINE_PIXELS) at a time so
+             no full 16-bit copy of the frame is ever held in RAM. The
+             unrotated buffer is sent, as with drawRGBBitmap(getBuffer()).
+   @param    dst  Display (or canvas) to draw into
+   @param    x    Left edge on dst
+   @param    y    Top edge on dst
+*/
+/**************************************************************************/
+void GFXcanvas8Palette::flush(Adafruit_GFX &dst, int16_t x, int16_t y) {
+  uint8_t *buf = getBuffer();
+  if (!buf)
+    return;
+
+  uint16_t line[GFX_SCANLINE_PIXELS];
+  dst.startWrite();
+  for (int16_t row = 0; row < HEIGHT; row++) {
+    uint8_t *src = &buf[(uint32_t)row * WIDTH];
+    for (int16_t col = 0; col < WIDTH; col += GFX_SCANLINE_PIXELS) {
+      int16_t n = WIDTH - col;
+      if (n > GFX_SCANLINE_PIXELS)
+        n = GFX_SCANLINE_PIXELS;
+      for (int16_t i = 0; i < n; i++) {
+        line[i] = palette[src[col + i]];
+      }
+      dst.writeScanline(x + col, y + row, line, n);
+    }
+  }
+  dst.endWrite();
+}
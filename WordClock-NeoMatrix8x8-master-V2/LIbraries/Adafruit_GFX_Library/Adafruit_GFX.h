@@ -9,6 +9,22 @@
 #endif
 #include "gfxfont.h"
 
+#ifndef GFX_SCANLINE_PIXELS
+#ifdef __AVR__
+#define GFX_SCANLINE_PIXELS 32 ///< Pixels per drawTextLine() burst (AVR)
+#else
+#define GFX_SCANLINE_PIXELS 320 ///< Pixels per drawTextLine() burst
+#endif
+#endif
+
+#ifndef GFX_RLE_GLYPHS
+#ifdef __AVR__
+#define GFX_RLE_GLYPHS 8 ///< RLE glyphs drawTextLine() decodes once (AVR)
+#else
+#define GFX_RLE_GLYPHS 64 ///< RLE glyphs drawTextLine() decodes once
+#endif
+#endif
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -39,6 +55,8 @@ public:
   virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                          uint16_t color);
+  virtual void writeScanline(int16_t x, int16_t y, uint16_t *colors,
+                             int16_t w);
   virtual void endWrite(void);
 
   // CONTROL API
@@ -108,6 +126,7 @@ public:
                 uint16_t bg, uint8_t size);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
                 uint16_t bg, uint8_t size_x, uint8_t size_y);
+  void drawTextLine(int16_t x, int16_t y, const char *str);
   void getTextBounds(const char *string, int16_t x, int16_t y, int16_t *x1,
                      int16_t *y1, uint16_t *w, uint16_t *h);
   void getTextBounds(const __FlashStringHelper *s, int16_t x, int16_t y,
@@ -390,4 +409,31 @@ private:
   uint16_t *buffer;
 };
 
+///  A GFX 8-bit canvas whose pixels index a palette of 565 colors
+class GFXcanvas8Palette : public GFXcanvas8 {
+public:
+  GFXcanvas8Palette(uint16_t w, uint16_t h);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void setPalette(const uint16_t *colors, uint16_t n);
+  uint8_t colorIndex(uint16_t color);
+  uint16_t getPixelColor(int16_t x, int16_t y) const;
+  void flush(Adafruit_GFX &dst, int16_t x, int16_t y);
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of palette entries currently in use
+    @returns  Palette entry count, 1 to 256
+  */
+  /**********************************************************************/
+  uint16_t getPaletteSize(void) const { return paletteSize; }
+
+private:
+  uint16_t palette[256]; ///< 565 color for each index
+  uint16_t paletteSize;  ///< Entries in use
+  uint16_t lastColor;    ///< Most recently mapped 565 color
+  uint8_t lastIndex;     ///< Index that lastColor mapped to
+};
+
 #endif // _ADAFRUIT_GFX_H
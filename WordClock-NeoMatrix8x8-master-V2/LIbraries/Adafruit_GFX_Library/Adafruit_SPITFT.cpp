@@ -1564,6 +1564,34 @@ void inline Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h,
   }
 }
 
+/*!
+    @brief  Push one horizontal run of individually-colored pixels as a
+            single address window + pixel burst. Performs edge clipping
+            and rejection. Not self-contained; should follow startWrite().
+            Used by Adafruit_GFX::drawTextLine() to send a whole text
+            scanline at once instead of one window per pixel.
+    @param  x       Horizontal position of first pixel.
+    @param  y       Vertical position of the row.
+    @param  colors  Array of w 16-bit pixel colors in '565' RGB format.
+                    Must remain valid until the push completes (blocking).
+    @param  w       Width in pixels.
+*/
+void Adafruit_SPITFT::writeScanline(int16_t x, int16_t y, uint16_t *colors,
+                                    int16_t w) {
+  if ((y < 0) || (y >= _height) || (w <= 0) || (x >= _width) ||
+      (x + w <= 0))
+    return;
+  if (x < 0) { // Clip left
+    colors -= x;
+    w += x;
+    x = 0;
+  }
+  if (x + w > _width)
+    w = _width - x; // Clip right
+  setAddrWindow(x, y, w, 1);
+  writePixels(colors, w);
+}
+
 /*!
     @brief  A lower-level version of writeFillRect(). This version requires
             all inputs are in-bounds, that width and height are positive,
@@ -0,0 +1,508 @@
+const uint8_t FreeSans24pt7bRLEBitmaps[] PROGMEM = {
+  0x00, 0x0F, 0x41, 0x13, 0x12, 0x22, 0x22, 0x22, 0x22, 0xDF, 0x05, 0x00,
+  0x04, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x12, 0x52,
+  0x22, 0x52, 0x22, 0x52, 0x10, 0x93, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4,
+  0x63, 0xB4, 0x54, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x63, 0x5F,
+  0x08, 0x1F, 0x08, 0x1F, 0x08, 0x64, 0x63, 0xB4, 0x63, 0xB4, 0x63, 0xB3,
+  0x64, 0xB3, 0x64, 0xB3, 0x64, 0xA4, 0x63, 0xB4, 0x63, 0x6F, 0x08, 0x1F,
+  0x08, 0x1F, 0x08, 0x54, 0x63, 0xB4, 0x63, 0xB4, 0x54, 0xB3, 0x64, 0xB3,
+  0x64, 0xA4, 0x63, 0xB4, 0x63, 0xB4, 0x63, 0xB3, 0x64, 0xB3, 0x64, 0x80,
+  0xA3, 0xF0, 0x37, 0xDC, 0xAE, 0x8F, 0x01, 0x66, 0x23, 0x25, 0x55, 0x33,
+  0x34, 0x45, 0x43, 0x44, 0x34, 0x53, 0x53, 0x34, 0x53, 0x53, 0x34, 0x53,
+  0x53, 0x34, 0x53, 0xB4, 0x53, 0xB5, 0x43, 0xC5, 0x33, 0xC7, 0x13, 0xDA,
+  0xED, 0xCD, 0xCC, 0xDB, 0xC3, 0x36, 0xB3, 0x45, 0xB3, 0x55, 0xA3, 0x67,
+  0x73, 0x67, 0x73, 0x68, 0x63, 0x68, 0x63, 0x64, 0x14, 0x53, 0x54, 0x25,
+  0x43, 0x54, 0x25, 0x43, 0x45, 0x36, 0x23, 0x26, 0x5F, 0x02, 0x7E, 0xC9,
+  0xF0, 0x23, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xA0, 0xF0,
+  0xC3, 0xE6, 0xF0, 0x04, 0xD9, 0xD3, 0xCC, 0xB3, 0xDD, 0xA3, 0xC5, 0x45,
+  0x93, 0xC4, 0x84, 0x83, 0xC3, 0xA3, 0x73, 0xD3, 0xA3, 0x64, 0xD3, 0xA3,
+  0x63, 0xE3, 0xA3, 0x54, 0xE4, 0x84, 0x53, 0xF0, 0x15, 0x45, 0x54, 0xF0,
+  0x2D, 0x53, 0xF0, 0x3C, 0x54, 0xF0, 0x4A, 0x63, 0xF0, 0x76, 0x73, 0xF1,
+  0x53, 0xF1, 0x43, 0x86, 0xF0, 0x73, 0x79, 0xF0, 0x43, 0x6C, 0xF0, 0x24,
+  0x6D, 0xF0, 0x13, 0x65, 0x45, 0xF0, 0x04, 0x54, 0x84, 0xE3, 0x63, 0xA3,
+  0xD4, 0x63, 0xA3, 0xD3, 0x73, 0xA3, 0xC4, 0x73, 0xA3, 0xC3, 0x84, 0x84,
+  0xB3, 0xA5, 0x45, 0xC3, 0xBD, 0xB3, 0xCC, 0xC3, 0xE9, 0xC3, 0xF0, 0x16,
+  0x50, 0x96, 0xF0, 0x59, 0xF0, 0x3B, 0xF0, 0x1D, 0xF0, 0x05, 0x44, 0xE5,
+  0x64, 0xD4, 0x83, 0xD4, 0x83, 0xD4, 0x83, 0xD4, 0x83, 0xE4, 0x64, 0xE5,
+  0x44, 0xF0, 0x15, 0x15, 0xF0, 0x39, 0xF0, 0x48, 0xF0, 0x56, 0xF0, 0x68,
+  0xF0, 0x3B, 0xF0, 0x15, 0x34, 0x64, 0x55, 0x54, 0x54, 0x45, 0x65, 0x35,
+  0x44, 0x85, 0x24, 0x44, 0xAA, 0x44, 0xB8, 0x54, 0xC7, 0x54, 0xC6, 0x64,
+  0xD6, 0x55, 0xB8, 0x55, 0x99, 0x57, 0x55, 0x16, 0x5F, 0x00, 0x36, 0x5D,
+  0x56, 0x5B, 0x75, 0x77, 0xF0, 0x00, 0x0F, 0x15, 0x12, 0x22, 0x22, 0x10,
+  0x73, 0x73, 0x63, 0x63, 0x73, 0x64, 0x63, 0x64, 0x63, 0x73, 0x64, 0x63,
+  0x64, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x73, 0x74, 0x64, 0x64, 0x73, 0x74, 0x64, 0x73,
+  0x74, 0x73, 0x73, 0x83, 0x73, 0x83, 0x82, 0x83, 0x00, 0x03, 0x73, 0x83,
+  0x73, 0x83, 0x74, 0x73, 0x74, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74, 0x64,
+  0x64, 0x73, 0x74, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x54, 0x64, 0x64, 0x64, 0x63, 0x64, 0x64, 0x63, 0x64, 0x63, 0x73,
+  0x63, 0x73, 0x63, 0x72, 0x73, 0x70, 0x62, 0xC2, 0xC2, 0xC2, 0x72, 0x32,
+  0x32, 0x1F, 0x0D, 0x46, 0x94, 0x96, 0x73, 0x23, 0x63, 0x24, 0x43, 0x43,
+  0x61, 0x41, 0x40, 0xA3, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53,
+  0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xAF, 0x4D, 0xA3, 0xF0,
+  0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0, 0x53, 0xF0,
+  0x53, 0xF0, 0x53, 0xA0, 0x0F, 0x05, 0x22, 0x22, 0x22, 0x22, 0x12, 0x13,
+  0x12, 0x20, 0x0F, 0x1D, 0x00, 0x0F, 0x05, 0x00, 0xA3, 0xA3, 0xA2, 0xA3,
+  0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xB2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2,
+  0xB2, 0xA3, 0xA2, 0xB2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xB2, 0xA3,
+  0xA3, 0xA2, 0xA3, 0xA3, 0xA2, 0xA3, 0xA3, 0xA0, 0x86, 0xEA, 0xAE, 0x7F,
+  0x01, 0x66, 0x46, 0x55, 0x85, 0x44, 0xA4, 0x35, 0xA5, 0x24, 0xC4, 0x24,
+  0xC4, 0x24, 0xC4, 0x14, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE4, 0x14, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x25, 0xA5,
+  0x34, 0xA4, 0x45, 0x85, 0x55, 0x56, 0x6F, 0x01, 0x7E, 0xAA, 0xE6, 0x80,
+  0x92, 0x83, 0x83, 0x74, 0x65, 0x3F, 0x1A, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x00, 0x78, 0xCC, 0x8F, 0x01,
+  0x5F, 0x03, 0x46, 0x67, 0x25, 0xA5, 0x24, 0xCA, 0xC9, 0xE8, 0xE8, 0xE4,
+  0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x25, 0xF0, 0x15, 0xF0, 0x15, 0xF0, 0x07,
+  0xD8, 0xC8, 0xD8, 0xC8, 0xD7, 0xE6, 0xF0, 0x05, 0xF0, 0x15, 0xF0, 0x23,
+  0xF0, 0x34, 0xF0, 0x33, 0xF0, 0x43, 0xF0, 0x3F, 0x49, 0x00, 0x87, 0xDD,
+  0x9F, 0x00, 0x7F, 0x02, 0x56, 0x76, 0x45, 0x95, 0x35, 0xB5, 0x24, 0xD4,
+  0x24, 0xD4, 0x24, 0xD4, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x34, 0xF0, 0x17,
+  0xBB, 0xC9, 0xEA, 0xDC, 0xF0, 0x27, 0xF0, 0x35, 0xF0, 0x45, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x48, 0xF0, 0x08, 0xF0, 0x09, 0xD5, 0x14, 0xD4, 0x25,
+  0xB5, 0x36, 0x76, 0x4F, 0x04, 0x5F, 0x02, 0x8D, 0xC8, 0x80, 0xF0, 0x03,
+  0xF0, 0x44, 0xF0, 0x35, 0xF0, 0x26, 0xF0, 0x26, 0xF0, 0x17, 0xF0, 0x08,
+  0xE9, 0xE4, 0x14, 0xD4, 0x24, 0xC4, 0x34, 0xC4, 0x34, 0xB4, 0x44, 0xA4,
+  0x54, 0x94, 0x64, 0x94, 0x64, 0x84, 0x74, 0x74, 0x84, 0x64, 0x94, 0x64,
+  0x94, 0x54, 0xA4, 0x5F, 0x4D, 0xE4, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0x50, 0x3F, 0x02, 0x5F,
+  0x02, 0x5F, 0x02, 0x5F, 0x02, 0x44, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x25, 0x27, 0x84, 0x1B, 0x6F,
+  0x02, 0x5F, 0x03, 0x46, 0x76, 0x34, 0xA6, 0xF0, 0x25, 0xF0, 0x35, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x38, 0xE9,
+  0xC4, 0x24, 0xC4, 0x25, 0xA4, 0x37, 0x66, 0x4F, 0x02, 0x6F, 0x00, 0x8D,
+  0xC7, 0x80, 0x87, 0xDB, 0xAD, 0x8F, 0x00, 0x66, 0x56, 0x45, 0x85, 0x44,
+  0xA5, 0x34, 0xB4, 0x24, 0xC4, 0x24, 0xF0, 0x33, 0xF0, 0x34, 0xF0, 0x34,
+  0x47, 0x74, 0x2B, 0x54, 0x1E, 0x3F, 0x05, 0x28, 0x66, 0x26, 0xA5, 0x15,
+  0xC4, 0x15, 0xC9, 0xE8, 0xE8, 0xE8, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x14,
+  0xC4, 0x25, 0xA5, 0x35, 0x95, 0x36, 0x66, 0x5F, 0x01, 0x7E, 0x9C, 0xC8,
+  0x70, 0x0F, 0x45, 0xF0, 0x23, 0xF0, 0x24, 0xF0, 0x14, 0xF0, 0x23, 0xF0,
+  0x24, 0xF0, 0x14, 0xF0, 0x23, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x24, 0xF0,
+  0x23, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x24, 0xF0,
+  0x23, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x23, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x23, 0xF0, 0x24, 0xF0,
+  0x24, 0xD0, 0x78, 0xCC, 0x9E, 0x7F, 0x01, 0x56, 0x66, 0x35, 0xA4, 0x35,
+  0xA5, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xB5, 0x34, 0xA4, 0x46,
+  0x66, 0x5F, 0x01, 0x8C, 0x9E, 0x7F, 0x01, 0x56, 0x66, 0x35, 0xA5, 0x24,
+  0xC4, 0x15, 0xC9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE9, 0xC5, 0x14, 0xC4, 0x25,
+  0xA5, 0x36, 0x66, 0x4F, 0x03, 0x5F, 0x01, 0x8C, 0xC8, 0x70, 0x77, 0xCB,
+  0x9D, 0x7F, 0x00, 0x56, 0x56, 0x35, 0x94, 0x34, 0xA5, 0x24, 0xB4, 0x14,
+  0xD3, 0x14, 0xD3, 0x14, 0xD8, 0xD8, 0xD8, 0xD9, 0xB5, 0x14, 0xB5, 0x15,
+  0x96, 0x26, 0x58, 0x2F, 0x04, 0x3D, 0x14, 0x4B, 0x24, 0x76, 0x44, 0xF0,
+  0x24, 0xF0, 0x23, 0xF0, 0x24, 0xF0, 0x24, 0x24, 0xB4, 0x24, 0xA4, 0x35,
+  0x85, 0x45, 0x65, 0x5F, 0x00, 0x7D, 0x9B, 0xC7, 0x80, 0x0F, 0x05, 0xF2,
+  0xDF, 0x05, 0x00, 0x0F, 0x05, 0xF2, 0xDF, 0x05, 0x22, 0x22, 0x22, 0x22,
+  0x12, 0x13, 0x12, 0x20, 0xF1, 0xC3, 0xF0, 0x35, 0xF0, 0x17, 0xD9, 0xC8,
+  0xC9, 0xC9, 0xC8, 0xC9, 0xD7, 0xF0, 0x15, 0xF0, 0x37, 0xF0, 0x28, 0xF0,
+  0x29, 0xF0, 0x19, 0xF0, 0x28, 0xF0, 0x29, 0xF0, 0x19, 0xF0, 0x28, 0xF0,
+  0x26, 0xF0, 0x53, 0xF0, 0x71, 0x00, 0x0F, 0x4D, 0xF4, 0xDF, 0x4D, 0x00,
+  0x01, 0xF0, 0x73, 0xF0, 0x56, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x29, 0xF0,
+  0x19, 0xF0, 0x28, 0xF0, 0x29, 0xF0, 0x28, 0xF0, 0x27, 0xF0, 0x35, 0xF0,
+  0x26, 0xF0, 0x08, 0xC8, 0xD8, 0xC9, 0xC8, 0xC9, 0xC9, 0xE6, 0xF0, 0x24,
+  0xF0, 0x42, 0xF0, 0x60, 0x67, 0xBC, 0x7E, 0x5F, 0x01, 0x36, 0x57, 0x24,
+  0x95, 0x24, 0xA9, 0xC8, 0xC8, 0xC8, 0xC4, 0xF0, 0x05, 0xF0, 0x04, 0xF0,
+  0x05, 0xE5, 0xE5, 0xD6, 0xD6, 0xE5, 0xE5, 0xE5, 0xF0, 0x04, 0xF0, 0x14,
+  0xF0, 0x14, 0xF0, 0x14, 0xF0, 0x14, 0xF5, 0x14, 0xF0, 0x14, 0xF0, 0x14,
+  0xF0, 0x14, 0xF0, 0x14, 0x90, 0xF0, 0x39, 0xF0, 0xFF, 0x02, 0xF0, 0x9F,
+  0x06, 0xF0, 0x6F, 0x09, 0xF0, 0x29, 0x8A, 0xF0, 0x07, 0xE8, 0xD6, 0xF0,
+  0x37, 0xB5, 0xF0, 0x76, 0x95, 0xF0, 0x96, 0x75, 0xF0, 0xB6, 0x64, 0xB6,
+  0xB5, 0x54, 0xA9, 0x34, 0x45, 0x35, 0x8C, 0x24, 0x54, 0x34, 0x86, 0x49,
+  0x55, 0x15, 0x75, 0x77, 0x65, 0x14, 0x75, 0x96, 0x74, 0x14, 0x74, 0xA6,
+  0x74, 0x14, 0x64, 0xB5, 0x88, 0x74, 0xB5, 0x88, 0x74, 0xB5, 0x88, 0x64,
+  0xC4, 0x98, 0x64, 0xC4, 0x89, 0x64, 0xB5, 0x84, 0x14, 0x64, 0xB4, 0x94,
+  0x14, 0x64, 0xB4, 0x84, 0x24, 0x64, 0xA5, 0x75, 0x25, 0x55, 0x85, 0x84,
+  0x44, 0x65, 0x66, 0x75, 0x44, 0x66, 0x48, 0x46, 0x55, 0x6C, 0x1D, 0x74,
+  0x79, 0x3B, 0x95, 0x85, 0x77, 0xC5, 0xF1, 0x76, 0xF1, 0x76, 0xF1, 0x77,
+  0xF1, 0x67, 0xF1, 0x69, 0xA5, 0xF0, 0x6F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x8F, 0x03, 0xF0, 0xEA, 0xF0, 0x20, 0xC6, 0xF0, 0x87, 0xF0, 0x87, 0xF0,
+  0x88, 0xF0, 0x69, 0xF0, 0x64, 0x15, 0xF0, 0x54, 0x15, 0xF0, 0x45, 0x24,
+  0xF0, 0x44, 0x35, 0xF0, 0x34, 0x35, 0xF0, 0x25, 0x44, 0xF0, 0x24, 0x55,
+  0xF0, 0x05, 0x55, 0xF0, 0x04, 0x74, 0xF0, 0x04, 0x75, 0xD5, 0x75, 0xD4,
+  0x94, 0xD4, 0x95, 0xB5, 0x95, 0xB4, 0xB4, 0xBF, 0x05, 0x9F, 0x06, 0x9F,
+  0x07, 0x7F, 0x08, 0x75, 0xD5, 0x74, 0xF0, 0x05, 0x55, 0xF0, 0x05, 0x55,
+  0xF0, 0x05, 0x54, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x35, 0xF0, 0x25, 0x34,
+  0xF0, 0x45, 0x15, 0xF0, 0x45, 0x15, 0xF0, 0x54, 0x10, 0x0F, 0x02, 0x8F,
+  0x04, 0x6F, 0x06, 0x4F, 0x06, 0x44, 0xC6, 0x34, 0xE4, 0x34, 0xE5, 0x24,
+  0xF0, 0x04, 0x24, 0xF0, 0x04, 0x24, 0xF0, 0x04, 0x24, 0xF0, 0x04, 0x24,
+  0xE4, 0x34, 0xE4, 0x34, 0xC5, 0x4F, 0x05, 0x5F, 0x04, 0x6F, 0x06, 0x4F,
+  0x07, 0x34, 0xE5, 0x24, 0xF0, 0x05, 0x14, 0xF0, 0x14, 0x14, 0xF0, 0x28,
+  0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x28, 0xF0, 0x19,
+  0xF0, 0x05, 0x14, 0xE6, 0x1F, 0x08, 0x2F, 0x07, 0x3F, 0x06, 0x4F, 0x04,
+  0x60, 0xB8, 0xF0, 0x3E, 0xEF, 0x02, 0xAF, 0x05, 0x87, 0x86, 0x85, 0xC5,
+  0x65, 0xE5, 0x45, 0xF0, 0x14, 0x44, 0xF0, 0x24, 0x35, 0xF0, 0x34, 0x24,
+  0xF0, 0x44, 0x24, 0xF0, 0xA4, 0xF0, 0x94, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0, 0xA4, 0xF0,
+  0xA4, 0xF0, 0xB4, 0xF0, 0x54, 0x14, 0xF0, 0x54, 0x14, 0xF0, 0x45, 0x15,
+  0xF0, 0x34, 0x34, 0xF0, 0x34, 0x35, 0xF0, 0x15, 0x45, 0xE5, 0x65, 0xC6,
+  0x68, 0x77, 0x8F, 0x05, 0xBF, 0x02, 0xDE, 0xF0, 0x38, 0xA0, 0x0F, 0x02,
+  0xAF, 0x05, 0x7F, 0x06, 0x6F, 0x07, 0x54, 0xC7, 0x44, 0xE6, 0x34, 0xF0,
+  0x06, 0x24, 0xF0, 0x15, 0x24, 0xF0, 0x25, 0x14, 0xF0, 0x34, 0x14, 0xF0,
+  0x34, 0x14, 0xF0, 0x34, 0x14, 0xF0, 0x48, 0xF0, 0x48, 0xF0, 0x48, 0xF0,
+  0x48, 0xF0, 0x48, 0xF0, 0x48, 0xF0, 0x48, 0xF0, 0x48, 0xF0, 0x48, 0xF0,
+  0x48, 0xF0, 0x34, 0x14, 0xF0, 0x34, 0x14, 0xF0, 0x34, 0x14, 0xF0, 0x25,
+  0x14, 0xF0, 0x15, 0x24, 0xF0, 0x06, 0x24, 0xE6, 0x34, 0xC7, 0x4F, 0x07,
+  0x5F, 0x06, 0x6F, 0x05, 0x7F, 0x02, 0xA0, 0x0F, 0x08, 0x1F, 0x08, 0x1F,
+  0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x5F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x1F, 0x08, 0x14, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x5F, 0x51, 0x00, 0x0F, 0x4D,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x3F, 0x05, 0x2F,
+  0x05, 0x2F, 0x05, 0x2F, 0x05, 0x24, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x30,
+  0xC9, 0xF0, 0x4F, 0x00, 0xEF, 0x04, 0xBF, 0x06, 0x98, 0x87, 0x76, 0xD6,
+  0x56, 0xF0, 0x15, 0x45, 0xF0, 0x34, 0x35, 0xF0, 0x45, 0x24, 0xF0, 0x64,
+  0x15, 0xF0, 0xB4, 0xF0, 0xC4, 0xF0, 0xB5, 0xF0, 0xB4, 0xF0, 0xC4, 0xF0,
+  0xC4, 0xF0, 0xC4, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xF0,
+  0x89, 0xF0, 0x74, 0x14, 0xF0, 0x74, 0x14, 0xF0, 0x74, 0x15, 0xF0, 0x55,
+  0x15, 0xF0, 0x55, 0x25, 0xF0, 0x36, 0x26, 0xF0, 0x26, 0x36, 0xF0, 0x07,
+  0x46, 0xC9, 0x58, 0x76, 0x14, 0x6F, 0x04, 0x24, 0x7F, 0x02, 0x43, 0x9D,
+  0x63, 0xC8, 0xB0, 0x04, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x3F, 0x61, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0,
+  0x38, 0xF0, 0x38, 0xF0, 0x34, 0x00, 0x0F, 0x79, 0x00, 0xF0, 0x04, 0xF0,
+  0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0,
+  0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0,
+  0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0,
+  0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x08, 0xB8, 0xB8, 0xB8, 0xB8, 0xAA,
+  0x95, 0x14, 0x85, 0x26, 0x56, 0x3F, 0x00, 0x4E, 0x7B, 0xA7, 0x60, 0x04,
+  0xF0, 0x25, 0x14, 0xF0, 0x15, 0x24, 0xF0, 0x05, 0x34, 0xE5, 0x44, 0xD5,
+  0x54, 0xC5, 0x64, 0xB5, 0x74, 0xA5, 0x84, 0x95, 0x94, 0x85, 0xA4, 0x75,
+  0xB4, 0x65, 0xC4, 0x55, 0xD4, 0x45, 0xE4, 0x36, 0xE4, 0x28, 0xD4, 0x1A,
+  0xC9, 0x15, 0xC8, 0x35, 0xB7, 0x55, 0xA6, 0x65, 0xA5, 0x85, 0x94, 0xA5,
+  0x84, 0xA6, 0x74, 0xB5, 0x74, 0xC5, 0x64, 0xC6, 0x54, 0xD5, 0x54, 0xE5,
+  0x44, 0xF0, 0x05, 0x34, 0xF0, 0x05, 0x34, 0xF0, 0x15, 0x24, 0xF0, 0x25,
+  0x14, 0xF0, 0x26, 0x00, 0x04, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x2F, 0x45, 0x00, 0x06, 0xF0, 0x5C, 0xF0, 0x5D,
+  0xF0, 0x3E, 0xF0, 0x3E, 0xF0, 0x3F, 0x00, 0xF0, 0x1F, 0x01, 0xF0, 0x1C,
+  0x13, 0xF0, 0x13, 0x18, 0x14, 0xE4, 0x18, 0x14, 0xE4, 0x18, 0x24, 0xD3,
+  0x28, 0x24, 0xC4, 0x28, 0x24, 0xC4, 0x28, 0x34, 0xB3, 0x38, 0x34, 0xA4,
+  0x38, 0x34, 0xA4, 0x38, 0x44, 0x84, 0x48, 0x44, 0x84, 0x48, 0x44, 0x84,
+  0x48, 0x54, 0x64, 0x58, 0x54, 0x64, 0x58, 0x54, 0x64, 0x58, 0x64, 0x44,
+  0x68, 0x64, 0x44, 0x68, 0x64, 0x44, 0x68, 0x74, 0x24, 0x78, 0x74, 0x24,
+  0x78, 0x83, 0x24, 0x78, 0x88, 0x88, 0x88, 0x88, 0x97, 0x88, 0x96, 0x98,
+  0x96, 0x98, 0xA5, 0x94, 0x00, 0x05, 0xF0, 0x2A, 0xF0, 0x1A, 0xF0, 0x1B,
+  0xF0, 0x0B, 0xF0, 0x0C, 0xED, 0xD8, 0x14, 0xD8, 0x15, 0xC8, 0x25, 0xB8,
+  0x34, 0xB8, 0x35, 0xA8, 0x44, 0xA8, 0x45, 0x98, 0x55, 0x88, 0x64, 0x88,
+  0x65, 0x78, 0x75, 0x68, 0x84, 0x68, 0x85, 0x58, 0x94, 0x58, 0x95, 0x48,
+  0xA5, 0x38, 0xB4, 0x38, 0xB5, 0x28, 0xC5, 0x18, 0xD4, 0x18, 0xDD, 0xEC,
+  0xEC, 0xF0, 0x0B, 0xF0, 0x1A, 0xF0, 0x1A, 0xF0, 0x25, 0x00, 0xC9, 0xF0,
+  0x6F, 0x00, 0xF0, 0x1F, 0x04, 0xDF, 0x06, 0xB8, 0x78, 0x96, 0xD6, 0x76,
+  0xF0, 0x06, 0x65, 0xF0, 0x25, 0x55, 0xF0, 0x45, 0x44, 0xF0, 0x64, 0x35,
+  0xF0, 0x65, 0x24, 0xF0, 0x84, 0x24, 0xF0, 0x84, 0x15, 0xF0, 0x89, 0xF0,
+  0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0,
+  0xA8, 0xF0, 0xA8, 0xF0, 0x95, 0x14, 0xF0, 0x84, 0x24, 0xF0, 0x84, 0x25,
+  0xF0, 0x65, 0x34, 0xF0, 0x64, 0x45, 0xF0, 0x45, 0x55, 0xF0, 0x25, 0x66,
+  0xF0, 0x06, 0x76, 0xD6, 0x98, 0x78, 0xBF, 0x06, 0xDF, 0x04, 0xF0, 0x1F,
+  0x00, 0xF0, 0x69, 0xC0, 0x0F, 0x02, 0x7F, 0x05, 0x4F, 0x06, 0x3F, 0x07,
+  0x24, 0xC7, 0x14, 0xE5, 0x14, 0xF0, 0x09, 0xF0, 0x18, 0xF0, 0x18, 0xF0,
+  0x18, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x18, 0xF0, 0x09, 0xE5, 0x14, 0xC7,
+  0x1F, 0x07, 0x2F, 0x06, 0x3F, 0x05, 0x4F, 0x03, 0x64, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54, 0xF0,
+  0x50, 0xC9, 0xF0, 0x6F, 0x00, 0xF0, 0x1F, 0x03, 0xEF, 0x06, 0xB8, 0x78,
+  0x96, 0xD6, 0x76, 0xF0, 0x06, 0x65, 0xF0, 0x25, 0x55, 0xF0, 0x45, 0x44,
+  0xF0, 0x64, 0x35, 0xF0, 0x65, 0x24, 0xF0, 0x84, 0x24, 0xF0, 0x84, 0x15,
+  0xF0, 0x89, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8,
+  0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0xA8, 0xF0, 0x95, 0x14, 0xF0, 0x84, 0x24,
+  0xF0, 0x84, 0x25, 0xF0, 0x65, 0x34, 0xE3, 0x44, 0x45, 0xC5, 0x25, 0x55,
+  0xCA, 0x66, 0xC9, 0x76, 0xC7, 0x98, 0x79, 0xAF, 0x09, 0xAF, 0x09, 0xBF,
+  0x00, 0x35, 0xD9, 0x74, 0xF0, 0xF3, 0xF1, 0x01, 0x20, 0x0F, 0x04, 0x7F,
+  0x06, 0x5F, 0x07, 0x4F, 0x08, 0x34, 0xE6, 0x24, 0xF0, 0x05, 0x24, 0xF0,
+  0x15, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0,
+  0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x14, 0x24, 0xF0,
+  0x05, 0x24, 0xE5, 0x3F, 0x07, 0x4F, 0x06, 0x5F, 0x07, 0x4F, 0x08, 0x34,
+  0xE6, 0x24, 0xF0, 0x14, 0x24, 0xF0, 0x15, 0x14, 0xF0, 0x24, 0x14, 0xF0,
+  0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0,
+  0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0, 0x24, 0x14, 0xF0,
+  0x29, 0xF0, 0x25, 0x00, 0x99, 0xF0, 0x0F, 0x00, 0xBF, 0x02, 0x8F, 0x06,
+  0x66, 0x87, 0x55, 0xD5, 0x44, 0xF0, 0x04, 0x35, 0xF0, 0x05, 0x24, 0xF0,
+  0x24, 0x24, 0xF0, 0x24, 0x24, 0xF0, 0x84, 0xF0, 0x85, 0xF0, 0x86, 0xF0,
+  0x68, 0xF0, 0x5B, 0xF0, 0x2E, 0xF0, 0x0F, 0x00, 0xF0, 0x0E, 0xF0, 0x2B,
+  0xF0, 0x58, 0xF0, 0x67, 0xF0, 0x75, 0xF0, 0x85, 0xF0, 0x88, 0xF0, 0x48,
+  0xF0, 0x48, 0xF0, 0x44, 0x14, 0xF0, 0x25, 0x15, 0xF0, 0x14, 0x26, 0xE5,
+  0x38, 0x87, 0x5F, 0x06, 0x7F, 0x04, 0xAF, 0x00, 0xF0, 0x09, 0x90, 0x0F,
+  0x59, 0xB4, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74,
+  0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74,
+  0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74,
+  0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74,
+  0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0x74,
+  0xB0, 0x04, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38,
+  0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x38, 0xF0, 0x25, 0x14, 0xF0, 0x14, 0x25,
+  0xE5, 0x26, 0xC6, 0x37, 0x87, 0x5F, 0x05, 0x7F, 0x03, 0xAE, 0xE9, 0x90,
+  0x05, 0xF0, 0x44, 0x15, 0xF0, 0x35, 0x24, 0xF0, 0x35, 0x25, 0xF0, 0x24,
+  0x35, 0xF0, 0x15, 0x44, 0xF0, 0x15, 0x45, 0xF0, 0x04, 0x55, 0xE5, 0x64,
+  0xE5, 0x65, 0xD4, 0x75, 0xC5, 0x84, 0xC5, 0x85, 0xB4, 0xA4, 0xA5, 0xA4,
+  0xA5, 0xA5, 0x94, 0xC4, 0x94, 0xC5, 0x75, 0xC5, 0x74, 0xE4, 0x74, 0xE5,
+  0x54, 0xF0, 0x05, 0x54, 0xF0, 0x14, 0x54, 0xF0, 0x15, 0x34, 0xF0, 0x34,
+  0x34, 0xF0, 0x34, 0x34, 0xF0, 0x35, 0x14, 0xF0, 0x54, 0x14, 0xF0, 0x54,
+  0x14, 0xF0, 0x58, 0xF0, 0x77, 0xF0, 0x77, 0xF0, 0x76, 0xF0, 0x95, 0xC0,
+  0x05, 0xD6, 0xDA, 0xD6, 0xDA, 0xD6, 0xD5, 0x14, 0xD6, 0xD4, 0x25, 0xB8,
+  0xB5, 0x25, 0xB8, 0xB5, 0x25, 0xB8, 0xB5, 0x34, 0xB9, 0xA4, 0x45, 0x94,
+  0x24, 0x95, 0x45, 0x94, 0x24, 0x95, 0x45, 0x94, 0x24, 0x95, 0x54, 0x85,
+  0x34, 0x84, 0x65, 0x74, 0x44, 0x84, 0x65, 0x74, 0x44, 0x75, 0x74, 0x74,
+  0x44, 0x75, 0x74, 0x65, 0x54, 0x64, 0x85, 0x54, 0x64, 0x64, 0x85, 0x54,
+  0x64, 0x55, 0x94, 0x54, 0x65, 0x45, 0x94, 0x44, 0x84, 0x44, 0xA4, 0x44,
+  0x84, 0x44, 0xA5, 0x34, 0x84, 0x44, 0xB4, 0x25, 0x94, 0x25, 0xB4, 0x24,
+  0xA4, 0x24, 0xC4, 0x24, 0xA4, 0x24, 0xC5, 0x14, 0xA5, 0x14, 0xD9, 0xB9,
+  0xD8, 0xC8, 0xE8, 0xC8, 0xE8, 0xD7, 0xF0, 0x06, 0xE7, 0xF0, 0x06, 0xE6,
+  0xF0, 0x16, 0xE6, 0xF0, 0x16, 0xF0, 0x05, 0x80, 0x15, 0xF0, 0x25, 0x26,
+  0xF0, 0x06, 0x35, 0xF0, 0x05, 0x55, 0xD5, 0x75, 0xB5, 0x85, 0xB5, 0x95,
+  0x95, 0xB5, 0x75, 0xC5, 0x75, 0xD5, 0x55, 0xF0, 0x05, 0x35, 0xF0, 0x15,
+  0x35, 0xF0, 0x25, 0x15, 0xF0, 0x49, 0xF0, 0x59, 0xF0, 0x67, 0xF0, 0x85,
+  0xF0, 0x87, 0xF0, 0x68, 0xF0, 0x69, 0xF0, 0x45, 0x15, 0xF0, 0x25, 0x34,
+  0xF0, 0x25, 0x35, 0xF0, 0x05, 0x55, 0xD5, 0x75, 0xC5, 0x75, 0xB5, 0x95,
+  0x95, 0xA6, 0x85, 0xB5, 0x75, 0xD5, 0x55, 0xE6, 0x36, 0xF0, 0x05, 0x35,
+  0xF0, 0x25, 0x15, 0xF0, 0x36, 0x00, 0x06, 0xF0, 0x36, 0x15, 0xF0, 0x35,
+  0x26, 0xF0, 0x15, 0x45, 0xF0, 0x15, 0x55, 0xE5, 0x65, 0xD5, 0x85, 0xC5,
+  0x95, 0xA5, 0xA5, 0xA5, 0xB5, 0x85, 0xD4, 0x84, 0xE5, 0x65, 0xF0, 0x05,
+  0x45, 0xF0, 0x15, 0x44, 0xF0, 0x35, 0x25, 0xF0, 0x44, 0x24, 0xF0, 0x5A,
+  0xF0, 0x68, 0xF0, 0x86, 0xF0, 0x96, 0xF0, 0xA4, 0xF0, 0xB4, 0xF0, 0xB4,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4,
+  0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0xD0, 0x2F,
+  0x09, 0x3F, 0x09, 0x3F, 0x09, 0x3F, 0x09, 0xF0, 0x75, 0xF0, 0x65, 0xF0,
+  0x66, 0xF0, 0x56, 0xF0, 0x56, 0xF0, 0x65, 0xF0, 0x65, 0xF0, 0x66, 0xF0,
+  0x56, 0xF0, 0x56, 0xF0, 0x65, 0xF0, 0x65, 0xF0, 0x66, 0xF0, 0x56, 0xF0,
+  0x56, 0xF0, 0x65, 0xF0, 0x65, 0xF0, 0x66, 0xF0, 0x56, 0xF0, 0x65, 0xF0,
+  0x65, 0xF0, 0x65, 0xF0, 0x66, 0xF0, 0x56, 0xF0, 0x65, 0xF0, 0x65, 0xF0,
+  0x6F, 0x5D, 0x00, 0x0F, 0x15, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x4F, 0x11, 0x00, 0x03, 0xA3, 0xB2, 0xB3, 0xA3,
+  0xB2, 0xB3, 0xA3, 0xB2, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB2,
+  0xB3, 0xB2, 0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0xB2, 0xB2, 0xB3, 0xA3,
+  0xB2, 0xB3, 0xA3, 0xB2, 0xB3, 0xA3, 0x00, 0x0F, 0x11, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4F, 0x15, 0x00, 0x74,
+  0xE4, 0xD6, 0xC6, 0xB8, 0xA3, 0x23, 0xA3, 0x23, 0x94, 0x33, 0x83, 0x43,
+  0x74, 0x44, 0x63, 0x63, 0x63, 0x63, 0x53, 0x83, 0x43, 0x83, 0x34, 0x84,
+  0x23, 0xA3, 0x23, 0xA3, 0x13, 0xC3, 0x00, 0x0F, 0x29, 0x00, 0x06, 0x64,
+  0x74, 0x74, 0x73, 0x83, 0x83, 0x00, 0x79, 0xCE, 0x9F, 0x01, 0x7F, 0x03,
+  0x56, 0x77, 0x45, 0xA5, 0x44, 0xC4, 0xF0, 0x54, 0xF0, 0x54, 0xF0, 0x54,
+  0xF0, 0x45, 0xF0, 0x27, 0xBD, 0x7F, 0x02, 0x5D, 0x24, 0x48, 0x84, 0x36,
+  0xB4, 0x35, 0xC4, 0x34, 0xD4, 0x34, 0xC5, 0x34, 0xC5, 0x35, 0x97, 0x46,
+  0x59, 0x4F, 0x00, 0x17, 0x2D, 0x36, 0x3B, 0x46, 0x56, 0x85, 0x00, 0x04,
+  0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34,
+  0xF0, 0x34, 0xF0, 0x34, 0x56, 0x74, 0x3A, 0x54, 0x1D, 0x44, 0x1E, 0x38,
+  0x57, 0x27, 0x85, 0x26, 0xA5, 0x15, 0xC4, 0x15, 0xC4, 0x15, 0xC9, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xDA, 0xC4, 0x15, 0xC4, 0x16, 0xA5,
+  0x17, 0x85, 0x28, 0x57, 0x23, 0x1F, 0x00, 0x33, 0x2D, 0x43, 0x3B, 0xD7,
+  0x70, 0x87, 0xBC, 0x8E, 0x6F, 0x01, 0x46, 0x66, 0x35, 0x85, 0x25, 0xA4,
+  0x24, 0xC4, 0x14, 0xF0, 0x15, 0xF0, 0x14, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
+  0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x34, 0xC4,
+  0x14, 0xC4, 0x15, 0xA5, 0x25, 0x85, 0x36, 0x66, 0x4F, 0x01, 0x6E, 0x8C,
+  0xB7, 0x70, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0x77, 0x54, 0x5B, 0x34, 0x4E, 0x14,
+  0x3F, 0x05, 0x27, 0x59, 0x25, 0x97, 0x15, 0xB6, 0x15, 0xC5, 0x14, 0xDA,
+  0xD9, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0,
+  0x08, 0xF0, 0x09, 0xD5, 0x14, 0xD5, 0x14, 0xD5, 0x15, 0xB6, 0x25, 0x97,
+  0x27, 0x59, 0x3F, 0x01, 0x13, 0x4E, 0x23, 0x5C, 0x33, 0x78, 0x80, 0x87,
+  0xDB, 0x9E, 0x7F, 0x01, 0x66, 0x56, 0x45, 0x85, 0x35, 0xA5, 0x24, 0xC4,
+  0x24, 0xC4, 0x14, 0xE8, 0xE8, 0xEF, 0x3B, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x44, 0xF0, 0x34, 0xC4, 0x25, 0xB4, 0x35, 0x95, 0x36, 0x66, 0x5F, 0x01,
+  0x7F, 0x00, 0x8C, 0xD7, 0x70, 0x64, 0x46, 0x46, 0x37, 0x35, 0x54, 0x64,
+  0x64, 0x64, 0x3F, 0x0F, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x30, 0x86, 0xDA, 0x34, 0x4D, 0x14, 0x3F, 0x04, 0x27, 0x58,
+  0x25, 0x87, 0x15, 0xA6, 0x14, 0xC5, 0x14, 0xCA, 0xD8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xE8, 0xE8, 0xE8, 0xE4, 0x14, 0xC5, 0x14, 0xC5, 0x15, 0xA6, 0x25,
+  0x87, 0x27, 0x58, 0x3E, 0x14, 0x4C, 0x24, 0x5A, 0x34, 0x76, 0x54, 0xF0,
+  0x34, 0xF0, 0x24, 0x24, 0xC4, 0x25, 0xA5, 0x35, 0x76, 0x4F, 0x03, 0x5F,
+  0x01, 0x7E, 0xB8, 0x70, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0,
+  0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0xF0, 0x04, 0x47, 0x44, 0x39,
+  0x34, 0x2C, 0x14, 0x1D, 0x18, 0x4D, 0x8B, 0x99, 0xA9, 0xA8, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+  0xB8, 0xB8, 0xB4, 0x00, 0x0F, 0x05, 0xF0, 0x1F, 0x55, 0x00, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0xF1, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x05,
+  0x17, 0x15, 0x30, 0x04, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24,
+  0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xA5, 0x24,
+  0x95, 0x34, 0x85, 0x44, 0x75, 0x54, 0x65, 0x64, 0x55, 0x74, 0x45, 0x84,
+  0x35, 0x94, 0x25, 0xA4, 0x16, 0xAC, 0x9D, 0x87, 0x15, 0x86, 0x35, 0x75,
+  0x55, 0x64, 0x65, 0x64, 0x75, 0x54, 0x84, 0x54, 0x85, 0x44, 0x95, 0x34,
+  0x95, 0x34, 0xA5, 0x24, 0xB4, 0x24, 0xB5, 0x14, 0xC5, 0x00, 0x0F, 0x79,
+  0x00, 0x86, 0x86, 0x43, 0x39, 0x5A, 0x23, 0x2B, 0x3C, 0x13, 0x1D, 0x1D,
+  0x17, 0x59, 0x5C, 0x77, 0x7A, 0x95, 0x99, 0x95, 0x98, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4,
+  0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x00, 0x96, 0x53,
+  0x4A, 0x33, 0x2D, 0x23, 0x1F, 0x00, 0x13, 0x14, 0x5E, 0x8B, 0x9A, 0xB9,
+  0xB8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC4, 0x00, 0x87, 0xEB, 0xAF, 0x00, 0x7F,
+  0x02, 0x57, 0x57, 0x45, 0x95, 0x35, 0xB5, 0x24, 0xD4, 0x24, 0xD4, 0x15,
+  0xD9, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0,
+  0x08, 0xF0, 0x09, 0xD5, 0x14, 0xD4, 0x24, 0xD4, 0x25, 0xB5, 0x35, 0x95,
+  0x47, 0x57, 0x5F, 0x02, 0x7F, 0x00, 0x9D, 0xD7, 0x80, 0x87, 0x73, 0x3B,
+  0x53, 0x2D, 0x43, 0x1F, 0x00, 0x39, 0x47, 0x27, 0x85, 0x26, 0xA5, 0x15,
+  0xC4, 0x15, 0xC4, 0x15, 0xC9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xDA, 0xC4, 0x15, 0xC4, 0x16, 0xA5, 0x17, 0x85, 0x28, 0x57, 0x2F, 0x04,
+  0x34, 0x1D, 0x44, 0x3A, 0x54, 0x56, 0x74, 0xF0, 0x34, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x34, 0xF0, 0x30, 0x87,
+  0xEB, 0x33, 0x4E, 0x23, 0x3F, 0x01, 0x13, 0x27, 0x59, 0x25, 0x97, 0x15,
+  0xB6, 0x15, 0xC5, 0x14, 0xDA, 0xD9, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08,
+  0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x08, 0xF0, 0x09, 0xD5, 0x14, 0xD5, 0x14,
+  0xD5, 0x15, 0xB6, 0x25, 0x97, 0x27, 0x59, 0x3F, 0x00, 0x14, 0x4E, 0x14,
+  0x5B, 0x34, 0x77, 0x54, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44,
+  0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0xF0, 0x44, 0x00, 0x87, 0x48, 0x2A,
+  0x1F, 0x02, 0x36, 0x65, 0x75, 0x75, 0x74, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x80,
+  0x77, 0xAC, 0x7E, 0x5F, 0x01, 0x45, 0x66, 0x25, 0x85, 0x24, 0xA4, 0x24,
+  0xF0, 0x14, 0xF0, 0x15, 0xF0, 0x06, 0xF0, 0x08, 0xDB, 0xAD, 0x9C, 0xC9,
+  0xF0, 0x06, 0xF0, 0x05, 0xF0, 0x18, 0xC8, 0xC9, 0xA5, 0x16, 0x66, 0x2F,
+  0x03, 0x3F, 0x01, 0x5D, 0xA8, 0x60, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x3F, 0x0F, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x67, 0x37, 0x46,
+  0x55, 0x00, 0x04, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+  0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xB9, 0xB9, 0xAB, 0x8E,
+  0x58, 0x1F, 0x00, 0x13, 0x1E, 0x23, 0x3B, 0x33, 0x56, 0x90, 0x14, 0xD5,
+  0x14, 0xD4, 0x25, 0xC4, 0x34, 0xB5, 0x34, 0xB4, 0x45, 0xA4, 0x54, 0x94,
+  0x64, 0x94, 0x65, 0x75, 0x74, 0x74, 0x84, 0x74, 0x85, 0x55, 0x94, 0x54,
+  0xA4, 0x54, 0xA5, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xD4, 0x14, 0xE4, 0x14,
+  0xE4, 0x13, 0xF0, 0x17, 0xF0, 0x17, 0xF0, 0x16, 0xF0, 0x35, 0xF0, 0x35,
+  0x90, 0x05, 0x95, 0xA4, 0x24, 0x96, 0x94, 0x24, 0x96, 0x94, 0x25, 0x86,
+  0x85, 0x34, 0x77, 0x84, 0x44, 0x78, 0x74, 0x44, 0x78, 0x74, 0x54, 0x63,
+  0x14, 0x64, 0x64, 0x54, 0x23, 0x64, 0x64, 0x54, 0x24, 0x54, 0x64, 0x54,
+  0x24, 0x54, 0x74, 0x43, 0x34, 0x44, 0x84, 0x34, 0x43, 0x44, 0x84, 0x34,
+  0x44, 0x34, 0x93, 0x34, 0x44, 0x33, 0xA4, 0x23, 0x54, 0x24, 0xA4, 0x14,
+  0x63, 0x24, 0xA4, 0x14, 0x64, 0x14, 0xB3, 0x14, 0x64, 0x13, 0xC7, 0x78,
+  0xC7, 0x87, 0xD6, 0x86, 0xE6, 0x86, 0xE5, 0x96, 0xE5, 0xA4, 0x80, 0x15,
+  0xB4, 0x34, 0xA5, 0x44, 0x94, 0x55, 0x74, 0x74, 0x65, 0x84, 0x54, 0x95,
+  0x34, 0xB4, 0x25, 0xC4, 0x14, 0xD8, 0xF0, 0x06, 0xF0, 0x25, 0xF0, 0x25,
+  0xF0, 0x16, 0xF0, 0x17, 0xE9, 0xC4, 0x24, 0xC4, 0x34, 0xA4, 0x45, 0x85,
+  0x54, 0x84, 0x65, 0x64, 0x85, 0x45, 0x94, 0x35, 0xA5, 0x24, 0xC5, 0x00,
+  0x14, 0xD4, 0x14, 0xC5, 0x14, 0xC4, 0x34, 0xB4, 0x34, 0xA4, 0x44, 0xA4,
+  0x54, 0x94, 0x54, 0x84, 0x64, 0x84, 0x74, 0x74, 0x74, 0x64, 0x84, 0x64,
+  0x94, 0x45, 0x94, 0x44, 0xA4, 0x44, 0xB4, 0x24, 0xC4, 0x24, 0xC4, 0x24,
+  0xD8, 0xE8, 0xE8, 0xF0, 0x06, 0xF0, 0x16, 0xF0, 0x15, 0xF0, 0x34, 0xF0,
+  0x34, 0xF0, 0x24, 0xF0, 0x34, 0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x25, 0xD8,
+  0xE8, 0xE7, 0xF0, 0x14, 0xF0, 0x00, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0xF0, 0x04, 0xF0, 0x05, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xF0,
+  0x04, 0xF0, 0x05, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xF0, 0x04, 0xF0,
+  0x05, 0xEF, 0x41, 0x00, 0x74, 0x56, 0x56, 0x44, 0x73, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74, 0x64,
+  0x55, 0x64, 0x74, 0x75, 0x84, 0x83, 0x93, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x86, 0x56, 0x74,
+  0x00, 0x0F, 0x75, 0x00, 0x04, 0x76, 0x56, 0x84, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x93, 0x84,
+  0x85, 0x74, 0x74, 0x65, 0x54, 0x73, 0x73, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x74, 0x46, 0x56, 0x54,
+  0x70, 0x25, 0xD8, 0x82, 0x19, 0x75, 0x45, 0x45, 0x6A, 0x12, 0x88, 0xD5,
+  0x20 };
+
+const GFXglyph FreeSans24pt7bRLEGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
+  {     1,   4,  34,  16,    6,  -33 },   // 0x21 '!'
+  {    12,  11,  12,  16,    2,  -32 },   // 0x22 '"'
+  {    29,  24,  33,  26,    1,  -31 },   // 0x23 '#'
+  {    96,  23,  41,  26,    1,  -34 },   // 0x24 '$'
+  {   179,  39,  34,  42,    1,  -32 },   // 0x25 '%'
+  {   277,  28,  34,  31,    2,  -32 },   // 0x26 '&'
+  {   354,   4,  12,   9,    2,  -32 },   // 0x27 '''
+  {   360,  10,  44,  16,    3,  -33 },   // 0x28 '('
+  {   405,  10,  44,  16,    2,  -33 },   // 0x29 ')'
+  {   450,  14,  14,  18,    2,  -33 },   // 0x2A '*'
+  {   471,  23,  22,  27,    2,  -21 },   // 0x2B '+'
+  {   508,   4,  12,  13,    4,   -4 },   // 0x2C ','
+  {   518,  11,   4,  16,    2,  -14 },   // 0x2D '-'
+  {   521,   4,   5,  12,    4,   -4 },   // 0x2E '.'
+  {   524,  13,  35,  13,    0,  -33 },   // 0x2F '/'
+  {   560,  22,  34,  26,    2,  -32 },   // 0x30 '0'
+  {   612,  11,  33,  26,    5,  -32 },   // 0x31 '1'
+  {   644,  22,  33,  26,    2,  -32 },   // 0x32 '2'
+  {   694,  23,  34,  26,    1,  -32 },   // 0x33 '3'
+  {   754,  23,  33,  26,    1,  -32 },   // 0x34 '4'
+  {   813,  22,  34,  26,    2,  -32 },   // 0x35 '5'
+  {   878,  22,  34,  26,    2,  -32 },   // 0x36 '6'
+  {   937,  21,  33,  26,    2,  -32 },   // 0x37 '7'
+  {   998,  22,  34,  26,    2,  -32 },   // 0x38 '8'
+  {  1054,  21,  34,  26,    2,  -32 },   // 0x39 '9'
+  {  1113,   4,  25,  12,    4,  -24 },   // 0x3A ':'
+  {  1119,   4,  32,  12,    4,  -24 },   // 0x3B ';'
+  {  1132,  23,  23,  27,    2,  -22 },   // 0x3C '<'
+  {  1170,  23,  12,  27,    2,  -16 },   // 0x3D '='
+  {  1176,  23,  23,  27,    2,  -22 },   // 0x3E '>'
+  {  1216,  20,  35,  26,    4,  -34 },   // 0x3F '?'
+  {  1265,  43,  42,  48,    2,  -34 },   // 0x40 '@'
+  {  1398,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  1485,  25,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  1561,  29,  36,  33,    2,  -34 },   // 0x43 'C'
+  {  1642,  27,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  1723,  24,  34,  30,    4,  -33 },   // 0x45 'E'
+  {  1786,  22,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  1848,  31,  36,  36,    2,  -34 },   // 0x47 'G'
+  {  1935,  26,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  1998,   4,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  2001,  19,  35,  25,    2,  -33 },   // 0x4A 'J'
+  {  2063,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
+  {  2140,  21,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  2203,  32,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  2297,  26,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  2362,  33,  36,  37,    2,  -34 },   // 0x4F 'O'
+  {  2452,  24,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  2521,  33,  38,  37,    2,  -34 },   // 0x51 'Q'
+  {  2613,  26,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  2704,  27,  36,  31,    2,  -34 },   // 0x53 'S'
+  {  2783,  26,  34,  30,    2,  -33 },   // 0x54 'T'
+  {  2845,  26,  35,  34,    4,  -33 },   // 0x55 'U'
+  {  2916,  29,  34,  30,    1,  -33 },   // 0x56 'V'
+  {  3000,  42,  34,  44,    1,  -33 },   // 0x57 'W'
+  {  3116,  29,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  3198,  30,  34,  32,    1,  -33 },   // 0x59 'Y'
+  {  3275,  27,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  3339,   8,  44,  13,    3,  -33 },   // 0x5B '['
+  {  3379,  13,  35,  13,    0,  -33 },   // 0x5C '\'
+  {  3415,   8,  44,  13,    1,  -33 },   // 0x5D ']'
+  {  3455,  18,  18,  22,    2,  -32 },   // 0x5E '^'
+  {  3487,  28,   2,  26,   -1,    7 },   // 0x5F '_'
+  {  3490,  10,   7,  12,    1,  -34 },   // 0x60 '`'
+  {  3498,  24,  27,  26,    1,  -25 },   // 0x61 'a'
+  {  3551,  22,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  3613,  21,  27,  24,    1,  -25 },   // 0x63 'c'
+  {  3662,  23,  35,  26,    1,  -33 },   // 0x64 'd'
+  {  3731,  22,  27,  25,    1,  -25 },   // 0x65 'e'
+  {  3773,  10,  34,  13,    1,  -33 },   // 0x66 'f'
+  {  3807,  22,  36,  26,    1,  -25 },   // 0x67 'g'
+  {  3868,  19,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  3916,   4,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  3922,   8,  44,  11,    0,  -33 },   // 0x6A 'j'
+  {  3963,  21,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  4030,   4,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  4033,  32,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  4090,  20,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  4123,  23,  27,  25,    1,  -25 },   // 0x6F 'o'
+  {  4173,  22,  35,  26,    3,  -25 },   // 0x70 'p'
+  {  4235,  23,  35,  26,    1,  -25 },   // 0x71 'q'
+  {  4305,  12,  26,  16,    3,  -25 },   // 0x72 'r'
+  {  4332,  20,  27,  23,    1,  -25 },   // 0x73 's'
+  {  4374,  10,  32,  13,    1,  -30 },   // 0x74 't'
+  {  4406,  20,  26,  25,    3,  -24 },   // 0x75 'u'
+  {  4438,  23,  25,  23,    0,  -24 },   // 0x76 'v'
+  {  4489,  34,  25,  34,    0,  -24 },   // 0x77 'w'
+  {  4571,  22,  25,  22,    0,  -24 },   // 0x78 'x'
+  {  4620,  22,  35,  22,    0,  -24 },   // 0x79 'y'
+  {  4686,  20,  25,  23,    1,  -24 },   // 0x7A 'z'
+  {  4720,  11,  44,  16,    2,  -33 },   // 0x7B '{'
+  {  4765,   3,  44,  12,    4,  -33 },   // 0x7C '|'
+  {  4768,  11,  44,  16,    2,  -33 },   // 0x7D '}'
+  {  4813,  19,   7,  24,    2,  -19 } }; // 0x7E '~'
+
+const GFXfont FreeSans24pt7bRLE PROGMEM = {
+  (uint8_t  *)FreeSans24pt7bRLEBitmaps,
+  (GFXglyph *)FreeSans24pt7bRLEGlyphs,
+  0x20, 0x7E, 56, GFXFONT_RLE };
+
+// Approx. 5497 bytes
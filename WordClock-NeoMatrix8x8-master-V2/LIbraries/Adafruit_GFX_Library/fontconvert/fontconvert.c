@@ -8,6 +8,12 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -r, glyphs are run-length encoded instead of bit-packed (font name
+gets an 'RLE' suffix and the GFXFONT_RLE flag).  This is ~30-40% smaller
+for 18pt and up, and Adafruit_GFX draws each run as one line instead of
+unpacking pixel by pixel; for 12pt and below plain bitmaps are smaller:
+  ./fontconvert -r ~/Library/Fonts/FreeSans.ttf 24 > FreeSans24pt7bRLE.h
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -26,30 +32,10 @@ See notes at end for glyph nomenclature & other tidbits.
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
 #include "../gfxfont.h" // Adafruit_GFX font structures
+#include "glyphrle.h"   // Bit and run-length output shared with rleconvert
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
-// Accumulate bits for output, with periodic hexadecimal byte write
-void enbit(uint8_t value) {
-  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
-  if (value)
-    sum |= bit;          // Set bit if needed
-  if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
-    if (!firstCall) {    // Format output table nicely
-      if (++row >= 12) { // Last entry on line?
-        printf(",\n  "); //   Newline format output
-        row = 0;         //   Reset row counter
-      } else {           // Not end of line
-        printf(", ");    //   Simple comma delim
-      }
-    }
-    printf("0x%02X", sum); // Write byte value
-    sum = 0;               // Clear for next byte
-    bit = 0x80;            // Reset bit counter
-    firstCall = 0;         // Formatting flag
-  }
-}
-
 int main(int argc, char *argv[]) {
   int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
   char *fontName, c, *ptr;
@@ -60,16 +46,24 @@ int main(int argc, char *argv[]) {
   FT_BitmapGlyphRec *g;
   GFXglyph *table;
   uint8_t bit;
+  int rle = 0;
 
   // Parse command line.  Valid syntaxes are:
-  //   fontconvert [filename] [size]
-  //   fontconvert [filename] [size] [last char]
-  //   fontconvert [filename] [size] [first char] [last char]
+  //   fontconvert [-r] [filename] [size]
+  //   fontconvert [-r] [filename] [size] [last char]
+  //   fontconvert [-r] [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
-  // ' ' (space) and '~', respectively
+  // ' ' (space) and '~', respectively.  -r selects run-length glyphs.
+
+  if ((argc > 1) && !strcmp(argv[1], "-r")) {
+    rle = 1;
+    argv++;
+    argc--;
+  }
 
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n",
+            argv[0]);
     return 1;
   }
 
@@ -109,7 +103,7 @@ int main(int argc, char *argv[]) {
     ptr = &fontName[strlen(fontName)]; // If none, append
   // Insert font size and 7/8 bit.  fontName was alloc'd w/extra
   // space to allow this, we're not sprintfing into Forbidden Zone.
-  sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+  sprintf(ptr, "%dpt%db%s", size, (last > 127) ? 8 : 7, rle ? "RLE" : "");
   // Space and punctuation chars in name replaced w/ underscores.
   for (i = 0; (c = fontName[i]); i++) {
     if (isspace(c) || ispunct(c))
@@ -184,6 +178,13 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
+    if (rle) {
+      bitmapOffset += englyphrle(bitmap->buffer, bitmap->width, bitmap->rows,
+                                 bitmap->pitch);
+      FT_Done_Glyph(glyph);
+      continue;
+    }
+
     for (y = 0; y < bitmap->rows; y++) {
       for (x = 0; x < bitmap->width; x++) {
         byte = x / 8;
@@ -231,10 +232,11 @@ int main(int argc, char *argv[]) {
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d%s };\n\n", first, last, table[0].height,
+           rle ? ", GFXFONT_RLE" : "");
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
-           face->size->metrics.height >> 6);
+    printf("  0x%02X, 0x%02X, %ld%s };\n\n", first, last,
+           face->size->metrics.height >> 6, rle ? ", GFXFONT_RLE" : "");
   }
   printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
   // Size estimate is based on AVR struct and pointer sizes;
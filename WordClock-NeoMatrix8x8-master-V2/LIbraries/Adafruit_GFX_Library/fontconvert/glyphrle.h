@@ -0,0 +1,96 @@
+/*
+Bitmap output for fontconvert and rleconvert: packs bits into the
+hexadecimal bitmap table and encodes glyphs in the GFXFONT_RLE format.
+Both tools go through here, so a font converted from TrueType with -r and
+one re-encoded from an existing header are byte for byte the same.
+
+NOT AN ARDUINO HEADER.  Host tools only.
+*/
+#ifndef _GLYPHRLE_H_
+#define _GLYPHRLE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Accumulate bits for output, with periodic hexadecimal byte write
+static void enbit(uint8_t value) {
+  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+  if (value)
+    sum |= bit;          // Set bit if needed
+  if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
+    if (!firstCall) {    // Format output table nicely
+      if (++row >= 12) { // Last entry on line?
+        printf(",\n  "); //   Newline format output
+        row = 0;         //   Reset row counter
+      } else {           // Not end of line
+        printf(", ");    //   Simple comma delim
+      }
+    }
+    printf("0x%02X", sum); // Write byte value
+    sum = 0;               // Clear for next byte
+    bit = 0x80;            // Reset bit counter
+    firstCall = 0;         // Formatting flag
+  }
+}
+
+// Emit one 4-bit value of a run-length glyph, high bits first
+static void ennibble(uint8_t value) {
+  for (uint8_t bit = 0x08; bit; bit >>= 1)
+    enbit(value & bit);
+}
+
+// Emit one run length in GFXFONT_RLE form: 0-14 literal, else an escape
+// nibble of 15 followed by (length - 15) as two nibbles.  Runs longer than
+// 270 are split with a zero-length run of the opposite color in between.
+// Returns the number of nibbles written.
+static int enrun(int len) {
+  int nibbles = 0;
+  while (len > 270) {
+    ennibble(15);
+    ennibble(0xF);
+    ennibble(0xF);
+    ennibble(0);
+    nibbles += 4;
+    len -= 270;
+  }
+  if (len < 15) {
+    ennibble(len);
+    return nibbles + 1;
+  }
+  ennibble(15);
+  ennibble((len - 15) >> 4);
+  ennibble((len - 15) & 0xF);
+  return nibbles + 3;
+}
+
+// Emit a glyph as alternating off/on runs in raster order, starting with
+// an 'off' run and always ending with one (possibly zero-length) so the
+// decoder can stop as soon as it passes the last pixel.  The source is
+// 1 bit per pixel, MSB first, 'pitch' bytes per row.  Output is padded
+// to a byte boundary; returns the number of bytes written.
+static int englyphrle(const uint8_t *buffer, int width, int rows, int pitch) {
+  int x, y, run = 0, nibbles = 0;
+  uint8_t color = 0;
+
+  for (y = 0; y < rows; y++) {
+    for (x = 0; x < width; x++) {
+      uint8_t set = (buffer[y * pitch + x / 8] & (0x80 >> (x & 7))) != 0;
+      if (set != color) {
+        nibbles += enrun(run);
+        color = set;
+        run = 0;
+      }
+      run++;
+    }
+  }
+  nibbles += enrun(run);
+  if (color)
+    nibbles += enrun(0); // Trailing 'off' run
+  if (nibbles & 1) {
+    ennibble(0);
+    nibbles++;
+  }
+  return nibbles / 2;
+}
+
+#endif // _GLYPHRLE_H_
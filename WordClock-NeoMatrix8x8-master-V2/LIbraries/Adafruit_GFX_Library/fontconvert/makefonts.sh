@@ -36,3 +36,9 @@ do
 		done
 	done
 done
+
+# Run-length encoded variants of the large Sans sizes (smaller in flash and
+# faster to draw at 18pt and up; see fontconvert.c).  Re-encoded from the
+# headers above so they keep the same pixels; 'make test' in ../hosttest
+# checks that.
+make rlefonts
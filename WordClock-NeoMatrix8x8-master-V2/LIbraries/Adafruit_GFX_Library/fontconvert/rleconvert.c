@@ -0,0 +1,105 @@
+/*
+Re-encodes an existing Adafruit_GFX font header as GFXFONT_RLE.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool for preprocessing
+fonts to be used with the Adafruit_GFX Arduino library.
+
+fontconvert -r needs the TrueType source, which isn't in this repository;
+this works from the generated header instead, so the RLE variant always
+has exactly the pixels and metrics of the plain font.  The font is
+compiled in, one build per font ('make rlefonts' does this):
+
+  gcc -DPROGMEM= -DFONT_FILE='"../Fonts/FreeSans24pt7b.h"' \
+      -DFONT=FreeSans24pt7b rleconvert.c -o rleconvert
+  ./rleconvert > ../Fonts/FreeSans24pt7bRLE.h
+
+Output matches 'fontconvert -r' for the same font.
+*/
+#ifndef ARDUINO
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "../gfxfont.h" // Adafruit_GFX font structures
+#include "glyphrle.h"   // Bit and run-length output shared with fontconvert
+
+#include FONT_FILE
+
+#define STR2(x) #x
+#define STR(x) STR2(x)
+
+int main(void) {
+  const GFXfont *font = &FONT;
+  int i, j, x, y, bitmapOffset = 0;
+  int first = font->first, last = font->last, count = last - first + 1;
+  GFXglyph *table;
+
+  if (font->flags & GFXFONT_RLE) {
+    fprintf(stderr, "%s is already run-length encoded\n", STR(FONT));
+    return 1;
+  }
+  if (!(table = (GFXglyph *)malloc(count * sizeof(GFXglyph)))) {
+    fprintf(stderr, "Malloc error\n");
+    return 1;
+  }
+
+  printf("const uint8_t %sRLEBitmaps[] PROGMEM = {\n  ", STR(FONT));
+
+  // Unpack each glyph into whole bytes per row (GFX bitmaps are bit-packed
+  // across rows) and encode it
+  for (i = first, j = 0; i <= last; i++, j++) {
+    const GFXglyph *glyph = &font->glyph[j];
+    const uint8_t *bits = &font->bitmap[glyph->bitmapOffset];
+    int pitch = (glyph->width + 7) / 8, bit = 0;
+    uint8_t *rows = (uint8_t *)calloc(pitch * glyph->height + 1, 1);
+
+    if (!rows) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
+    for (y = 0; y < glyph->height; y++) {
+      for (x = 0; x < glyph->width; x++, bit++) {
+        if (bits[bit / 8] & (0x80 >> (bit & 7)))
+          rows[y * pitch + x / 8] |= 0x80 >> (x & 7);
+      }
+    }
+
+    table[j] = *glyph;
+    table[j].bitmapOffset = bitmapOffset;
+    bitmapOffset += englyphrle(rows, glyph->width, glyph->height, pitch);
+    free(rows);
+  }
+
+  printf(" };\n\n"); // End bitmap array
+
+  // Glyph table and font structure, formatted as fontconvert does
+  printf("const GFXglyph %sRLEGlyphs[] PROGMEM = {\n", STR(FONT));
+  for (i = first, j = 0; i <= last; i++, j++) {
+    printf("  { %5d, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset,
+           table[j].width, table[j].height, table[j].xAdvance, table[j].xOffset,
+           table[j].yOffset);
+    if (i < last) {
+      printf(",   // 0x%02X", i);
+      if ((i >= ' ') && (i <= '~')) {
+        printf(" '%c'", i);
+      }
+      putchar('\n');
+    }
+  }
+  printf(" }; // 0x%02X", last);
+  if ((last >= ' ') && (last <= '~'))
+    printf(" '%c'", last);
+  printf("\n\n");
+
+  printf("const GFXfont %sRLE PROGMEM = {\n", STR(FONT));
+  printf("  (uint8_t  *)%sRLEBitmaps,\n", STR(FONT));
+  printf("  (GFXglyph *)%sRLEGlyphs,\n", STR(FONT));
+  printf("  0x%02X, 0x%02X, %d, GFXFONT_RLE };\n\n", first, last,
+         font->yAdvance);
+  printf("// Approx. %d bytes\n", bitmapOffset + count * 7 + 7);
+
+  free(table);
+  return 0;
+}
+
+#endif /* !ARDUINO */
@@ -7,6 +7,10 @@
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
 
+/// GFXfont flag: glyph bitmaps are nibble-packed run lengths, not 1-bit
+/// pixels. Emitted by 'fontconvert -r'; see fontconvert.c for the format.
+#define GFXFONT_RLE 0x01
+
 /// Font data stored PER GLYPH
 typedef struct {
   uint16_t bitmapOffset; ///< Pointer into GFXfont->bitmap
@@ -24,6 +28,7 @@ typedef struct {
   uint16_t first;   ///< ASCII extents (first char)
   uint16_t last;    ///< ASCII extents (last char)
   uint8_t yAdvance; ///< Newline distance (y axis)
+  uint8_t flags;    ///< GFXFONT_* format flags (0 = 1-bit packed bitmaps)
 } GFXfont;
 
 #endif // _GFXFONT_H_
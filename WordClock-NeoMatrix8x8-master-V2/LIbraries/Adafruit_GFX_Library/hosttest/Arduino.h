@@ -0,0 +1,34 @@
+// Just enough of the Arduino core to build Adafruit_GFX on a PC, for the
+// host tests in this directory. Not used by sketches.
+#ifndef HOSTTEST_ARDUINO_H
+#define HOSTTEST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+typedef bool boolean;
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+class String {
+public:
+  String(const char *s = "") : str(s ? s : "") {}
+  const char *c_str() const { return str.c_str(); }
+  unsigned int length() const { return str.size(); }
+
+private:
+  std::string str;
+};
+
+#include "Print.h"
+
+#endif // HOSTTEST_ARDUINO_H
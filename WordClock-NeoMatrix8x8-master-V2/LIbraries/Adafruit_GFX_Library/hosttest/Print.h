@@ -0,0 +1,20 @@
+// Arduino Print for the host tests: write(uint8_t) is all Adafruit_GFX needs
+#ifndef HOSTTEST_PRINT_H
+#define HOSTTEST_PRINT_H
+
+#include "Arduino.h"
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--)
+      n += write(*buffer++);
+    return n;
+  }
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+};
+
+#endif // HOSTTEST_PRINT_H
@@ -0,0 +1,110 @@
+/*
+Test for GFXcanvas8Palette.
+
+NOT AN ARDUINO SKETCH.  Builds Adafruit_GFX with the stubs in this
+directory (make palettetest).
+
+The same scene is drawn into a GFXcanvas16 and a GFXcanvas8Palette; every
+pixel read back through getPixelColor(), and the frame copied out with
+flush(), must match the 16-bit canvas.  The canvas is wider than
+GFX_SCANLINE_PIXELS so flush() has to split rows.  Also covers a full
+palette (unknown colors map to index 0) and recoloring with setPalette().
+*/
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans12pt7b.h>
+
+#define W (GFX_SCANLINE_PIXELS + 40)
+#define H 60
+
+// Counts scanlines written by flush()
+class ScanlineCanvas : public GFXcanvas16 {
+public:
+  ScanlineCanvas(uint16_t w, uint16_t h) : GFXcanvas16(w, h), scanlines(0) {}
+  void writeScanline(int16_t x, int16_t y, uint16_t *colors, int16_t w) {
+    scanlines++;
+    GFXcanvas16::writeScanline(x, y, colors, w);
+  }
+  uint32_t scanlines;
+};
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+  printf("%-44s %s\n", what, ok ? "OK" : "FAIL");
+  if (!ok)
+    failures++;
+}
+
+static void scene(Adafruit_GFX &g) {
+  g.fillScreen(0x001F);
+  g.fillRect(5, 5, 50, 20, 0xF800);
+  g.drawRect(60, 5, 50, 20, 0x07E0);
+  g.drawLine(0, 0, W - 1, H - 1, 0xFFFF);
+  g.fillCircle(W - 30, 30, 20, 0xFFE0);
+  g.setFont(&FreeSans12pt7b);
+  g.setTextColor(0xF81F);
+  g.setCursor(120, 40);
+  g.print("12:34");
+  g.setFont(NULL);
+  g.setTextColor(0x07FF, 0x8410);
+  g.setCursor(10, 45);
+  g.print("Palette");
+}
+
+static uint32_t differing(GFXcanvas16 &ref, GFXcanvas8Palette &pal) {
+  uint32_t diff = 0;
+  for (int16_t y = 0; y < H; y++)
+    for (int16_t x = 0; x < W; x++)
+      if (ref.getPixel(x, y) != pal.getPixelColor(x, y))
+        diff++;
+  return diff;
+}
+
+int main(void) {
+  static GFXcanvas16 ref(W, H);
+  static GFXcanvas8Palette pal(W, H);
+  static ScanlineCanvas out(W, H);
+
+  scene(ref);
+  scene(pal);
+  expect(differing(ref, pal) == 0, "scene reads back as drawn");
+  // Black (index 0 from the start) plus the eight colors of the scene
+  expect(pal.getPaletteSize() == 9, "one palette entry per color drawn");
+
+  out.fillScreen(0);
+  pal.flush(out, 0, 0);
+  uint32_t diff = 0;
+  for (uint32_t i = 0; i < (uint32_t)W * H; i++)
+    if (out.getBuffer()[i] != ref.getBuffer()[i])
+      diff++;
+  expect(diff == 0, "flush() copies the frame");
+  expect(out.scanlines == 2UL * H, "flush() writes two chunks per row");
+
+  // Recolor: every index keeps its pixels, only the colors change
+  uint16_t colors[256];
+  for (uint16_t i = 0; i < pal.getPaletteSize(); i++)
+    colors[i] = (uint16_t)~i;
+  pal.setPalette(colors, pal.getPaletteSize());
+  uint8_t *buf = pal.getBuffer();
+  bool recolored = true;
+  for (int16_t y = 0; y < H; y++)
+    for (int16_t x = 0; x < W; x++)
+      if (pal.getPixelColor(x, y) != colors[buf[y * W + x]])
+        recolored = false;
+  expect(recolored, "setPalette() recolors existing pixels");
+
+  // Fill the palette, then one more color than fits
+  pal.fillScreen(0x0000);
+  pal.setPalette(colors, 1);
+  for (uint16_t i = 1; i < 256; i++)
+    pal.drawPixel(i % W, 0, i);
+  expect(pal.getPaletteSize() == 256, "palette grows to 256 entries");
+  pal.drawPixel(0, 1, 0x1234);
+  expect(pal.getPixel(0, 1) == 0, "unknown color maps to index 0 when full");
+  expect(pal.getPixel(255 % W, 0) == 255 && pal.getPixelColor(255 % W, 0) == 255,
+         "existing colors still map after overflow");
+
+  printf(failures ? "FAILED\n" : "OK\n");
+  return failures ? 1 : 0;
+}
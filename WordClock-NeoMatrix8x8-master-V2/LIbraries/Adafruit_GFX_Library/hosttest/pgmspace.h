@@ -0,0 +1 @@
+// Flash access is plain memory on the host; see Arduino.h
@@ -0,0 +1,122 @@
+/*
+Round trip test for the GFXFONT_RLE fonts in ../Fonts.
+
+NOT AN ARDUINO SKETCH.  Builds Adafruit_GFX with the stubs in this
+directory (make rletest).
+
+Every RLE font must draw exactly the pixels of the plain font it was
+converted from: each glyph through drawChar() at sizes 1 and 2, and all
+printable characters through drawTextLine() at sizes 1 and 2 (separate
+decoder, transparent and with a background).  Glyph metrics must match too.
+Regenerate the RLE headers with 'make rlefonts' in ../fontconvert if this
+fails.  rletest_small is the same test against a build with AVR sized
+scanline bursts and fewer glyph cursors than a line has characters.
+*/
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans18pt7bRLE.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSans24pt7bRLE.h>
+#include <string.h>
+
+#define W 320
+#define H 120
+
+static GFXcanvas16 plain(W, H), rle(W, H);
+static int failures = 0;
+
+static uint32_t differing(void) {
+  uint32_t diff = 0;
+  uint16_t *a = plain.getBuffer(), *b = rle.getBuffer();
+  for (uint32_t i = 0; i < (uint32_t)W * H; i++)
+    if (a[i] != b[i])
+      diff++;
+  return diff;
+}
+
+static void prepare(GFXcanvas16 &c, const GFXfont *f, uint8_t size,
+                    bool opaque) {
+  c.fillScreen(0);
+  c.setFont(f);
+  c.setTextSize(size);
+  c.setTextWrap(false);
+  if (opaque)
+    c.setTextColor(0xFFFF, 0x001F);
+  else
+    c.setTextColor(0xFFFF);
+}
+
+static void check(const char *label, const GFXfont *p, const GFXfont *r) {
+  int errors = 0;
+
+  if (p->first != r->first || p->last != r->last ||
+      p->yAdvance != r->yAdvance || !(r->flags & GFXFONT_RLE)) {
+    printf("%s: font header differs\n", label);
+    failures++;
+    return;
+  }
+
+  for (uint16_t c = p->first; c <= p->last; c++) {
+    const GFXglyph *a = &p->glyph[c - p->first], *b = &r->glyph[c - r->first];
+    if (a->width != b->width || a->height != b->height ||
+        a->xAdvance != b->xAdvance || a->xOffset != b->xOffset ||
+        a->yOffset != b->yOffset) {
+      printf("%s: metrics differ for 0x%02X\n", label, c);
+      errors++;
+      continue;
+    }
+    for (uint8_t size = 1; size <= 2; size++) {
+      prepare(plain, p, size, false);
+      prepare(rle, r, size, false);
+      plain.drawChar(20, 90, c, 0xFFFF, 0, size, size);
+      rle.drawChar(20, 90, c, 0xFFFF, 0, size, size);
+      uint32_t diff = differing();
+      if (diff) {
+        printf("%s: drawChar 0x%02X x%u: %u pixels differ\n", label, c, size,
+               diff);
+        errors++;
+      }
+    }
+  }
+
+  // Every printable character, a line at a time
+  char line[16];
+  for (uint16_t c = p->first; c <= p->last; c += sizeof(line) - 1) {
+    uint8_t n = 0;
+    while (n < sizeof(line) - 1 && c + n <= p->last) {
+      line[n] = c + n;
+      n++;
+    }
+    line[n] = 0;
+    for (uint8_t size = 1; size <= 2; size++) {
+      for (int opaque = 0; opaque <= 1; opaque++) {
+        prepare(plain, p, size, opaque);
+        prepare(rle, r, size, opaque);
+        plain.drawTextLine(0, size == 1 ? 60 : 95, line);
+        rle.drawTextLine(0, size == 1 ? 60 : 95, line);
+        uint32_t diff = differing();
+        if (diff) {
+          printf("%s: drawTextLine \"%s\" x%u%s: %u pixels differ\n", label,
+                 line, size, opaque ? " opaque" : "", diff);
+          errors++;
+        }
+      }
+    }
+  }
+
+  uint32_t plainBytes = p->glyph[p->last - p->first].bitmapOffset;
+  uint32_t rleBytes = r->glyph[r->last - r->first].bitmapOffset;
+  printf("%-16s bitmaps %5u -> %5u bytes  %s\n", label, plainBytes, rleBytes,
+         errors ? "FAIL" : "OK");
+  if (errors)
+    failures++;
+}
+
+int main(void) {
+  check("FreeSans18pt7b", &FreeSans18pt7b, &FreeSans18pt7bRLE);
+  check("FreeSans24pt7b", &FreeSans24pt7b, &FreeSans24pt7bRLE);
+
+  printf(failures ? "FAILED\n" : "OK\n");
+  return failures ? 1 : 0;
+}
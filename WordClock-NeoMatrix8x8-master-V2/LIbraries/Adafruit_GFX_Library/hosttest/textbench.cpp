@@ -0,0 +1,144 @@
+/*
+Host benchmark for drawTextLine() against print().
+
+NOT AN ARDUINO SKETCH.  Builds Adafruit_GFX with the stubs in this
+directory (make textbench).
+
+print() issues one drawChar() per character, drawTextLine() rasterizes the
+whole string one scanline at a time and pushes each row as one burst.  A
+GFXcanvas16 subclass counts every writePixel(), writeFillRect(),
+writeFastHLine() and writeScanline() call; on an SPI display each is one
+address window setup plus data, so the totals are a good proxy for bus
+overhead per string.  Both paths are drawn into separate canvases and
+compared pixel for pixel, and timed on the host (canvas CPU time only:
+a canvas has no bus, so the counts are the figure that carries over).
+
+Exits non-zero if drawTextLine() draws different pixels where print()
+is expected to match (classic font, or custom font without background),
+or if it needs more transactions.
+*/
+
+#include <Adafruit_GFX.h>
+#include <Fonts/FreeSans12pt7b.h>
+#include <chrono>
+
+// Counts top-level draw calls only: the canvas fallbacks call each other
+// (writeScanline() per pixel), which a display driver would not
+class CountingCanvas : public GFXcanvas16 {
+public:
+  CountingCanvas(uint16_t w, uint16_t h) : GFXcanvas16(w, h), depth(0) {
+    reset();
+  }
+  void reset(void) { pixels = rects = hlines = scanlines = 0; }
+  uint32_t total(void) const { return pixels + rects + hlines + scanlines; }
+
+  void writePixel(int16_t x, int16_t y, uint16_t color) {
+    if (!depth++)
+      pixels++;
+    GFXcanvas16::writePixel(x, y, color);
+    depth--;
+  }
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint16_t color) {
+    if (!depth++)
+      rects++;
+    GFXcanvas16::writeFillRect(x, y, w, h, color);
+    depth--;
+  }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (!depth++)
+      hlines++;
+    GFXcanvas16::writeFastHLine(x, y, w, color);
+    depth--;
+  }
+  void writeScanline(int16_t x, int16_t y, uint16_t *colors, int16_t w) {
+    if (!depth++)
+      scanlines++;
+    GFXcanvas16::writeScanline(x, y, colors, w);
+    depth--;
+  }
+
+  uint32_t pixels, rects, hlines, scanlines;
+
+private:
+  int depth;
+};
+
+static CountingCanvas perChar(240, 135), perLine(240, 135);
+static int failures = 0;
+
+static void setup(CountingCanvas &c, const GFXfont *f, uint8_t size,
+                  bool opaque) {
+  c.fillScreen(0);
+  c.setFont(f);
+  c.setTextSize(size);
+  c.setTextWrap(false);
+  if (opaque)
+    c.setTextColor(0xFFFF, 0x001F);
+  else
+    c.setTextColor(0xFFFF);
+  c.reset();
+}
+
+// Microseconds per string, over enough repetitions to be stable
+static double timeUs(CountingCanvas &c, bool line, const char *str,
+                     int16_t y) {
+  const int reps = 2000;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < reps; i++) {
+    if (line) {
+      c.drawTextLine(10, y, str);
+    } else {
+      c.setCursor(10, y);
+      c.print(str);
+    }
+  }
+  std::chrono::duration<double, std::micro> took =
+      std::chrono::steady_clock::now() - start;
+  return took.count() / reps;
+}
+
+static void report(const char *label, const char *str, const GFXfont *f,
+                   uint8_t size, bool opaque, bool mustMatch) {
+  int16_t y = f ? 40 : 10;
+
+  setup(perChar, f, size, opaque);
+  setup(perLine, f, size, opaque);
+  perChar.setCursor(10, y);
+  perChar.print(str);
+  perLine.drawTextLine(10, y, str);
+
+  uint32_t diff = 0;
+  uint16_t *a = perChar.getBuffer(), *b = perLine.getBuffer();
+  for (uint32_t i = 0; i < 240UL * 135; i++)
+    if (a[i] != b[i])
+      diff++;
+
+  uint32_t charTotal = perChar.total(), lineTotal = perLine.total();
+  uint32_t bursts = perLine.scanlines, runs = perLine.hlines;
+  double charUs = timeUs(perChar, false, str, y);
+  double lineUs = timeUs(perLine, true, str, y);
+
+  bool ok = (!mustMatch || diff == 0) && lineTotal <= charTotal;
+  if (!ok)
+    failures++;
+  printf("%-24s print(): %5u (%6.1f us)  drawTextLine(): %4u (%6.1f us, "
+         "%u bursts, %u runs)  differing pixels: %u%s\n",
+         label, charTotal, charUs, lineTotal, lineUs, bursts, runs, diff,
+         ok ? "" : "  FAIL");
+}
+
+int main(void) {
+  const char *str = "12:34:56 Synced";
+
+  printf("Draw transactions per string \"%s\"\n", str);
+  report("classic x1 transparent", str, NULL, 1, false, true);
+  report("classic x1 opaque", str, NULL, 1, true, true);
+  report("classic x3 opaque", str, NULL, 3, true, true);
+  report("FreeSans12 x1 transp.", str, &FreeSans12pt7b, 1, false, true);
+  // print() never fills a custom font's background: pixels differ
+  report("FreeSans12 x1 opaque", str, &FreeSans12pt7b, 1, true, false);
+
+  printf(failures ? "FAILED\n" : "OK\n");
+  return failures ? 1 : 0;
+}
@@ -191,22 +191,16 @@ DateTime::DateTime(uint32_t t) {
   t /= 60;
   hh = t % 24;
   uint16_t days = t / 24;
-  uint8_t leap;
-  for (yOff = 0;; ++yOff) {
-    leap = yOff % 4 == 0;
-    if (days < 365U + leap)
-      break;
-    days -= 365 + leap;
-  }
-  for (m = 1; m < 12; ++m) {
-    uint8_t daysPerMonth = pgm_read_byte(daysInMonth + m - 1);
-    if (leap && m == 2)
-      ++daysPerMonth;
-    if (days < daysPerMonth)
-      break;
-    days -= daysPerMonth;
-  }
-  d = days + 1;
+
+  // Count from 1996-03-01 so the leap day ends each 4 year cycle; every
+  // 4th year is leap within 2000--2099, no loop over years/months needed
+  uint16_t z = days + 1401;
+  uint8_t yoe = (4UL * z + 3) / 1461;            // years since 1996-03-01
+  uint16_t doy = z - (1461UL * yoe) / 4;         // 0-365, from March 1st
+  uint8_t mp = (5 * doy + 2) / 153;              // 0-11, March is 0
+  d = doy - (153 * mp + 2) / 5 + 1;
+  m = mp < 10 ? mp + 3 : mp - 9;
+  yOff = yoe + (m <= 2) - 4;
 }
 
 /**************************************************************************/